@@ -0,0 +1,390 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/benchmark/CMakeLists.txt"
+  "/root/repo/benchmark/benchncnn_param_data.h.in"
+  "/root/repo/cmake/ncnnConfig.cmake.in"
+  "/root/repo/cmake/ncnn_add_layer.cmake"
+  "/root/repo/cmake/ncnn_add_param.cmake"
+  "/root/repo/cmake/ncnn_add_shader.cmake"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/layer_declaration.h.in"
+  "/root/repo/src/layer_registry.h.in"
+  "/root/repo/src/layer_shader_registry.h.in"
+  "/root/repo/src/layer_shader_spv_data.h.in"
+  "/root/repo/src/layer_shader_type_enum.h.in"
+  "/root/repo/src/layer_type_enum.h.in"
+  "/root/repo/src/ncnn.pc.in"
+  "/root/repo/src/platform.h.in"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/perf/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Modules/exportheader.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/platform.h"
+  "src/layer_declaration.h"
+  "src/layer_registry.h"
+  "src/layer_type_enum.h"
+  "src/layer_shader_registry.h"
+  "src/layer_shader_spv_data.h"
+  "src/layer_shader_type_enum.h"
+  "src/ncnn_export.h"
+  "src/ncnnConfigVersion.cmake"
+  "src/ncnnConfig.cmake"
+  "src/ncnn.pc"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmark/benchncnn_param_data.h"
+  "benchmark/benchncnn_llm_param_data.h"
+  "benchmark/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/perf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/CMakeFiles/ncnn-generate-spirv.dir/DependInfo.cmake"
+  "src/CMakeFiles/ncnn.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/ncnn-generate-param.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/benchncnn.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/ncnn-generate-llm-param.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/benchncnn_llm.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ncnntestutil.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_mat_pixel_affine.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_mat_pixel_drawing.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_mat_pixel_rotate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_mat_pixel_resize.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_mat_pixel.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_mat_pixel_preprocess.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_squeezenet.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_c_api.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_cpu.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_expression.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_modelbin.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_paramdict.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_parallel_branch.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_parallel_create_pipeline.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_autotune.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_weightcache.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_mat_batch.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_absval.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_batchnorm.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_bias.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_binaryop.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_binaryop_1.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_binaryop_2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_binaryop_3.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_binaryop_4.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_bnll.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_cast.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_celu.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_clip.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_concat.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_concat_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_convolution.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_convolution_1.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_convolution_2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_convolution_3.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_convolution_4.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_convolution_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_convolution1d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_convolution3d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_convolutiondepthwise.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_convolutiondepthwise_1.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_convolutiondepthwise_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_convolutiondepthwise1d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_convolutiondepthwise3d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_copyto.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_copyto_1.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_crop.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_crop_1.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_crop_2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_crop_3.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_crop_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_cumulativesum.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deconvolution.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deconvolution_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deconvolution1d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deconvolution3d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deconvolutiondepthwise.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deconvolutiondepthwise_1.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deconvolutiondepthwise_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deconvolutiondepthwise1d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deconvolutiondepthwise3d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deepcopy.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deformableconv2d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deformableconv2d_1.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deformableconv2d_2.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deformableconv2d_3.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_deformableconv2d_4.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_dequantize.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_diag.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_dropout.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_einsum.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_eltwise.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_elu.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_embed.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_erf.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_exp.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_expanddims.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_flatten.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_flatten_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_flip.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_fold.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gelu.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_glu.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_0a.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_0b.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_0c.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_0d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_0e.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_0f.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_1a.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_1b.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_2a.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_2b.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_2c.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_2d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_2e.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_3.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_4.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_5.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_block_quant.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_nt.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_nt_int8.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gemm_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gridsample.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_groupnorm.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_gru.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_hardsigmoid.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_hardswish.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_innerproduct.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_innerproduct_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_input.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_instancenorm.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_interp.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_interp_1.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_inversespectrogram.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_layernorm.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_log.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_lrn.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_lstm.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_matmul.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_memorydata.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_mish.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_multiheadattention.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_multiheadattention_1.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_multiheadattention_block_quant.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_multiheadattention_kvcache.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_multiheadattention_kvcache_allocator.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_multiheadattention_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_mvn.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_noop.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_normalize.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_packing.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_padding.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_padding_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_permute.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_pixelshuffle.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_pooling.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_pooling1d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_pooling3d.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_power.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_prelu.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_priorbox.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_quantize.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_quantize_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_reduction.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_relu.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_reorg.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_requantize.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_requantize_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_reshape.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_reshape_1.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_reshape_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_rmsnorm.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_rnn.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_roipooling.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_roialign.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_rotaryembed.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_rotaryembed_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_scale.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_sdpa.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_sdpa_kvcache.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_sdpa_kvcache_session.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_sdpa_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_selu.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_shrink.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_shufflechannel.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_sigmoid.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_slice.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_slice_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_softmax.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_softmax_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_split.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_softplus.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_spectrogram.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_statisticspooling.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_squeeze.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_swish.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_tanh.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_threshold.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_tile.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_tile_oom.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_unaryop.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_unfold.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_yolov3detectionoutput.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/ncnnperfutil.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_relu.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_convolution.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_convolution1d.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_convolutiondepthwise.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_deconvolution.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_pooling.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_innerproduct.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_softmax.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_binaryop.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_concat.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_sigmoid.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_batchnorm.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_gemm.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_spectrogram.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_gru.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_mat_pixel.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_sdpa_decode.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_sdpa_kvcache.dir/DependInfo.cmake"
+  "tests/perf/CMakeFiles/perf_sdpa_prefill.dir/DependInfo.cmake"
+  )
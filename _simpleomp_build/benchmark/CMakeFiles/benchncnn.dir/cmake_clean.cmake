@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchncnn.dir/benchncnn.cpp.o"
+  "CMakeFiles/benchncnn.dir/benchncnn.cpp.o.d"
+  "benchncnn"
+  "benchncnn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchncnn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchncnn_llm.dir/benchncnn_llm.cpp.o"
+  "CMakeFiles/benchncnn_llm.dir/benchncnn_llm.cpp.o.d"
+  "benchncnn_llm"
+  "benchncnn_llm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchncnn_llm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
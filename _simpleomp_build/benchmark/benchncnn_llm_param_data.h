@@ -0,0 +1,19 @@
+// Benchncnn Param Data header
+//
+// This file is auto-generated by cmake, don't edit it.
+
+#include "param/hunyuan_0_5b_instruct_decoder_ncnn.hex.h"
+#include "param/hunyuan_0_5b_instruct_proj_out_ncnn.hex.h"
+#include "param/minicpm4_0_5b_decoder_ncnn.hex.h"
+#include "param/minicpm4_0_5b_proj_out_ncnn.hex.h"
+#include "param/qwen2_5_0_5b_decoder_ncnn.hex.h"
+#include "param/qwen2_5_0_5b_proj_out_ncnn.hex.h"
+#include "param/qwen3_0_6b_decoder_ncnn.hex.h"
+#include "param/qwen3_0_6b_proj_out_ncnn.hex.h"
+#include "param/llama3_2_1b_decoder_ncnn.hex.h"
+#include "param/llama3_2_1b_proj_out_ncnn.hex.h"
+#include "param/tinyllama_1_1b_decoder_ncnn.hex.h"
+#include "param/tinyllama_1_1b_proj_out_ncnn.hex.h"
+#include "param/youtu_llm_2b_decoder_ncnn.hex.h"
+#include "param/youtu_llm_2b_proj_out_ncnn.hex.h"
+
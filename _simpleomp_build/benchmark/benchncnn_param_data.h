@@ -0,0 +1,40 @@
+// Benchncnn Param Data header
+//
+// This file is auto-generated by cmake, don't edit it.
+
+#include "param/alexnet.hex.h"
+#include "param/blazeface.hex.h"
+#include "param/efficientnet_b0.hex.h"
+#include "param/efficientnetv2_b0.hex.h"
+#include "param/FastestDet.hex.h"
+#include "param/googlenet_int8.hex.h"
+#include "param/googlenet.hex.h"
+#include "param/mnasnet.hex.h"
+#include "param/mobilenet_int8.hex.h"
+#include "param/mobilenet_ssd_int8.hex.h"
+#include "param/mobilenet_ssd.hex.h"
+#include "param/mobilenet_v2.hex.h"
+#include "param/mobilenet_v3.hex.h"
+#include "param/mobilenet_yolo.hex.h"
+#include "param/mobilenet.hex.h"
+#include "param/mobilenetv2_yolov3.hex.h"
+#include "param/nanodet_m.hex.h"
+#include "param/proxylessnasnet.hex.h"
+#include "param/regnety_400m.hex.h"
+#include "param/resnet18_int8.hex.h"
+#include "param/resnet18.hex.h"
+#include "param/resnet50_int8.hex.h"
+#include "param/resnet50.hex.h"
+#include "param/shufflenet_v2.hex.h"
+#include "param/shufflenet.hex.h"
+#include "param/squeezenet_int8.hex.h"
+#include "param/squeezenet_ssd_int8.hex.h"
+#include "param/squeezenet_ssd.hex.h"
+#include "param/squeezenet.hex.h"
+#include "param/vgg16_int8.hex.h"
+#include "param/vgg16.hex.h"
+#include "param/vision_transformer.hex.h"
+#include "param/yolo_fastest_1_1.hex.h"
+#include "param/yolo_fastestv2.hex.h"
+#include "param/yolov4_tiny.hex.h"
+
@@ -0,0 +1 @@
+static const char shufflenet_v2_param_data[] = {0x37,0x37,0x36,0x37,0x35,0x31,0x37,0x0a,0x31,0x30,0x39,0x20,0x31,0x32,0x35,0x0a,0x49,0x6e,0x70,0x75,0x74,0x20,0x64,0x61,0x74,0x61,0x20,0x30,0x20,0x31,0x20,0x64,0x61,0x74,0x61,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x32,0x34,0x2c,0x32,0x32,0x34,0x2c,0x33,0x20,0x30,0x3d,0x32,0x32,0x34,0x20,0x31,0x3d,0x32,0x32,0x34,0x20,0x32,0x3d,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x64,0x61,0x74,0x61,0x20,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x31,0x32,0x2c,0x31,0x31,0x32,0x2c,0x32,0x34,0x20,0x30,0x3d,0x32,0x34,0x20,0x31,0x3d,0x33,0x20,0x33,0x3d,0x32,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x36,0x34,0x38,0x20,0x39,0x3d,0x31,0x0a,0x50,0x6f,0x6f,0x6c,0x69,0x6e,0x67,0x20,0x70,0x6f,0x6f,0x6c,0x31,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x70,0x6f,0x6f,0x6c,0x31,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x35,0x36,0x2c,0x35,0x36,0x2c,0x32,0x34,0x20,0x31,0x3d,0x33,0x20,0x32,0x3d,0x32,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x31,0x20,0x32,0x20,0x70,0x6f,0x6f,0x6c,0x31,0x20,0x70,0x6f,0x6f,0x6c,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x70,0x6f,0x6f,0x6c,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x35,0x36,0x2c,0x35,0x36,0x2c,0x32,0x34,0x2c,0x33,0x2c,0x35,0x36,0x2c,0x35,0x36,0x2c,0x32,0x34,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x70,0x6f,0x6f,0x6c,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x32,0x34,0x20,0x30,0x3d,0x32,0x34,0x20,0x31,0x3d,0x33,0x20,0x33,0x3d,0x32,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x32,0x31,0x36,0x20,0x37,0x3d,0x32,0x34,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x30,0x3d,0x35,0x38,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x39,0x32,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x70,0x6f,0x6f,0x6c,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x35,0x36,0x2c,0x35,0x36,0x2c,0x35,0x38,0x20,0x30,0x3d,0x35,0x38,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x39,0x32,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x30,0x3d,0x35,0x38,0x20,0x31,0x3d,0x33,0x20,0x33,0x3d,0x32,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x35,0x32,0x32,0x20,0x37,0x3d,0x35,0x38,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x30,0x3d,0x35,0x38,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x33,0x33,0x36,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x31,0x31,0x36,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x32,0x0a,0x53,0x6c,0x69,0x63,0x65,0x20,0x73,0x6c,0x69,0x63,0x65,0x32,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x2d,0x32,0x33,0x33,0x30,0x30,0x3d,0x32,0x2c,0x35,0x38,0x2c,0x2d,0x32,0x33,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x30,0x3d,0x35,0x38,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x33,0x33,0x36,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x30,0x3d,0x35,0x38,0x20,0x31,0x3d,0x33,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x35,0x32,0x32,0x20,0x37,0x3d,0x35,0x38,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x30,0x3d,0x35,0x38,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x33,0x33,0x36,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x32,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x31,0x31,0x36,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x32,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x32,0x0a,0x53,0x6c,0x69,0x63,0x65,0x20,0x73,0x6c,0x69,0x63,0x65,0x33,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x2d,0x32,0x33,0x33,0x30,0x30,0x3d,0x32,0x2c,0x35,0x38,0x2c,0x2d,0x32,0x33,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x30,0x3d,0x35,0x38,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x33,0x33,0x36,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x30,0x3d,0x35,0x38,0x20,0x31,0x3d,0x33,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x35,0x32,0x32,0x20,0x37,0x3d,0x35,0x38,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x30,0x3d,0x35,0x38,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x33,0x33,0x36,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x33,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x33,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x31,0x31,0x36,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x33,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x33,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x33,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x32,0x0a,0x53,0x6c,0x69,0x63,0x65,0x20,0x73,0x6c,0x69,0x63,0x65,0x34,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x33,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x2d,0x32,0x33,0x33,0x30,0x30,0x3d,0x32,0x2c,0x35,0x38,0x2c,0x2d,0x32,0x33,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x30,0x3d,0x35,0x38,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x33,0x33,0x36,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x30,0x3d,0x35,0x38,0x20,0x31,0x3d,0x33,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x35,0x32,0x32,0x20,0x37,0x3d,0x35,0x38,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x35,0x38,0x20,0x30,0x3d,0x35,0x38,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x33,0x33,0x36,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x34,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x34,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x31,0x31,0x36,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x34,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x34,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x34,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x32,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x34,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x31,0x31,0x36,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x31,0x31,0x36,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x33,0x20,0x33,0x3d,0x32,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x30,0x34,0x34,0x20,0x37,0x3d,0x31,0x31,0x36,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x32,0x38,0x2c,0x32,0x38,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x33,0x20,0x33,0x3d,0x32,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x30,0x34,0x34,0x20,0x37,0x3d,0x31,0x31,0x36,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x35,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x35,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x35,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x35,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x35,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x0a,0x53,0x6c,0x69,0x63,0x65,0x20,0x73,0x6c,0x69,0x63,0x65,0x36,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x35,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x2d,0x32,0x33,0x33,0x30,0x30,0x3d,0x32,0x2c,0x31,0x31,0x36,0x2c,0x2d,0x32,0x33,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x33,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x30,0x34,0x34,0x20,0x37,0x3d,0x31,0x31,0x36,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x36,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x36,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x36,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x36,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x36,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x0a,0x53,0x6c,0x69,0x63,0x65,0x20,0x73,0x6c,0x69,0x63,0x65,0x37,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x36,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x2d,0x32,0x33,0x33,0x30,0x30,0x3d,0x32,0x2c,0x31,0x31,0x36,0x2c,0x2d,0x32,0x33,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x33,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x30,0x34,0x34,0x20,0x37,0x3d,0x31,0x31,0x36,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x37,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x37,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x37,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x37,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x37,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x37,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x0a,0x53,0x6c,0x69,0x63,0x65,0x20,0x73,0x6c,0x69,0x63,0x65,0x38,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x37,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x2d,0x32,0x33,0x33,0x30,0x30,0x3d,0x32,0x2c,0x31,0x31,0x36,0x2c,0x2d,0x32,0x33,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x33,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x30,0x34,0x34,0x20,0x37,0x3d,0x31,0x31,0x36,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x38,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x38,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x38,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x38,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x38,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x38,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x0a,0x53,0x6c,0x69,0x63,0x65,0x20,0x73,0x6c,0x69,0x63,0x65,0x39,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x38,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x2d,0x32,0x33,0x33,0x30,0x30,0x3d,0x32,0x2c,0x31,0x31,0x36,0x2c,0x2d,0x32,0x33,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x33,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x30,0x34,0x34,0x20,0x37,0x3d,0x31,0x31,0x36,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x39,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x39,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x39,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x39,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x39,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x39,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x0a,0x53,0x6c,0x69,0x63,0x65,0x20,0x73,0x6c,0x69,0x63,0x65,0x31,0x30,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x39,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x2d,0x32,0x33,0x33,0x30,0x30,0x3d,0x32,0x2c,0x31,0x31,0x36,0x2c,0x2d,0x32,0x33,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x33,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x30,0x34,0x34,0x20,0x37,0x3d,0x31,0x31,0x36,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x30,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x30,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x30,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x30,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x30,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x30,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x0a,0x53,0x6c,0x69,0x63,0x65,0x20,0x73,0x6c,0x69,0x63,0x65,0x31,0x31,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x30,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x2d,0x32,0x33,0x33,0x30,0x30,0x3d,0x32,0x2c,0x31,0x31,0x36,0x2c,0x2d,0x32,0x33,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x33,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x30,0x34,0x34,0x20,0x37,0x3d,0x31,0x31,0x36,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x31,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x31,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x31,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x31,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x31,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x31,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x0a,0x53,0x6c,0x69,0x63,0x65,0x20,0x73,0x6c,0x69,0x63,0x65,0x31,0x32,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x2d,0x32,0x33,0x33,0x30,0x30,0x3d,0x32,0x2c,0x31,0x31,0x36,0x2c,0x2d,0x32,0x33,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x33,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x30,0x34,0x34,0x20,0x37,0x3d,0x31,0x31,0x36,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x31,0x31,0x36,0x20,0x30,0x3d,0x31,0x31,0x36,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x33,0x34,0x35,0x36,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x32,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x32,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x32,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x33,0x20,0x33,0x3d,0x32,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x32,0x30,0x38,0x38,0x20,0x37,0x3d,0x32,0x33,0x32,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x35,0x33,0x38,0x32,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x31,0x34,0x2c,0x31,0x34,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x35,0x33,0x38,0x32,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x33,0x20,0x33,0x3d,0x32,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x32,0x30,0x38,0x38,0x20,0x37,0x3d,0x32,0x33,0x32,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x35,0x33,0x38,0x32,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x33,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x31,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x33,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x33,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x34,0x36,0x34,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x33,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x33,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x33,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x34,0x36,0x34,0x20,0x30,0x3d,0x32,0x0a,0x53,0x6c,0x69,0x63,0x65,0x20,0x73,0x6c,0x69,0x63,0x65,0x31,0x34,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x33,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x2d,0x32,0x33,0x33,0x30,0x30,0x3d,0x32,0x2c,0x32,0x33,0x32,0x2c,0x2d,0x32,0x33,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x35,0x33,0x38,0x32,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x33,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x32,0x30,0x38,0x38,0x20,0x37,0x3d,0x32,0x33,0x32,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x35,0x33,0x38,0x32,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x34,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x34,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x34,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x34,0x36,0x34,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x34,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x34,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x34,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x34,0x36,0x34,0x20,0x30,0x3d,0x32,0x0a,0x53,0x6c,0x69,0x63,0x65,0x20,0x73,0x6c,0x69,0x63,0x65,0x31,0x35,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x34,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x2d,0x32,0x33,0x33,0x30,0x30,0x3d,0x32,0x2c,0x32,0x33,0x32,0x2c,0x2d,0x32,0x33,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x35,0x33,0x38,0x32,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x33,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x32,0x30,0x38,0x38,0x20,0x37,0x3d,0x32,0x33,0x32,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x35,0x33,0x38,0x32,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x35,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x35,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x35,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x34,0x36,0x34,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x35,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x35,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x35,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x34,0x36,0x34,0x20,0x30,0x3d,0x32,0x0a,0x53,0x6c,0x69,0x63,0x65,0x20,0x73,0x6c,0x69,0x63,0x65,0x31,0x36,0x20,0x31,0x20,0x32,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x35,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x38,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x2d,0x32,0x33,0x33,0x30,0x30,0x3d,0x32,0x2c,0x32,0x33,0x32,0x2c,0x2d,0x32,0x33,0x33,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x35,0x33,0x38,0x32,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x44,0x65,0x70,0x74,0x68,0x57,0x69,0x73,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x31,0x5f,0x72,0x65,0x6c,0x75,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x33,0x20,0x34,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x32,0x30,0x38,0x38,0x20,0x37,0x3d,0x32,0x33,0x32,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x20,0x31,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x32,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x32,0x33,0x32,0x20,0x30,0x3d,0x32,0x33,0x32,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x35,0x33,0x38,0x32,0x34,0x20,0x39,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x36,0x20,0x32,0x20,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x31,0x20,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x62,0x72,0x61,0x6e,0x63,0x68,0x31,0x36,0x5f,0x32,0x5f,0x63,0x6f,0x6e,0x76,0x33,0x5f,0x72,0x65,0x6c,0x75,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x36,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x34,0x36,0x34,0x0a,0x53,0x68,0x75,0x66,0x66,0x6c,0x65,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x36,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x63,0x61,0x74,0x31,0x36,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x36,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x34,0x36,0x34,0x20,0x30,0x3d,0x32,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x63,0x6f,0x6e,0x76,0x35,0x20,0x31,0x20,0x31,0x20,0x73,0x68,0x75,0x66,0x66,0x6c,0x65,0x31,0x36,0x20,0x63,0x6f,0x6e,0x76,0x35,0x5f,0x63,0x6f,0x6e,0x76,0x35,0x5f,0x72,0x65,0x6c,0x75,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x33,0x2c,0x37,0x2c,0x37,0x2c,0x31,0x30,0x32,0x34,0x20,0x30,0x3d,0x31,0x30,0x32,0x34,0x20,0x31,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x34,0x37,0x35,0x31,0x33,0x36,0x20,0x39,0x3d,0x31,0x0a,0x50,0x6f,0x6f,0x6c,0x69,0x6e,0x67,0x20,0x70,0x6f,0x6f,0x6c,0x5f,0x61,0x76,0x65,0x20,0x31,0x20,0x31,0x20,0x63,0x6f,0x6e,0x76,0x35,0x5f,0x63,0x6f,0x6e,0x76,0x35,0x5f,0x72,0x65,0x6c,0x75,0x20,0x70,0x6f,0x6f,0x6c,0x5f,0x61,0x76,0x65,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x31,0x2c,0x31,0x30,0x32,0x34,0x2c,0x31,0x2c,0x31,0x20,0x30,0x3d,0x31,0x20,0x34,0x3d,0x31,0x0a,0x49,0x6e,0x6e,0x65,0x72,0x50,0x72,0x6f,0x64,0x75,0x63,0x74,0x20,0x66,0x63,0x31,0x30,0x30,0x30,0x20,0x31,0x20,0x31,0x20,0x70,0x6f,0x6f,0x6c,0x5f,0x61,0x76,0x65,0x20,0x66,0x63,0x31,0x30,0x30,0x30,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x31,0x2c,0x31,0x30,0x30,0x30,0x2c,0x31,0x2c,0x31,0x20,0x30,0x3d,0x31,0x30,0x30,0x30,0x20,0x31,0x3d,0x31,0x20,0x32,0x3d,0x31,0x30,0x32,0x34,0x30,0x30,0x30,0x0a,0x53,0x6f,0x66,0x74,0x6d,0x61,0x78,0x20,0x70,0x72,0x6f,0x62,0x20,0x31,0x20,0x31,0x20,0x66,0x63,0x31,0x30,0x30,0x30,0x20,0x6f,0x75,0x74,0x70,0x75,0x74,0x20,0x2d,0x32,0x33,0x33,0x33,0x30,0x3d,0x34,0x2c,0x31,0x2c,0x31,0x30,0x30,0x30,0x2c,0x31,0x2c,0x31,0x0a,0x00};
@@ -0,0 +1 @@
+static const char vision_transformer_param_data[] = {0x37,0x37,0x36,0x37,0x35,0x31,0x37,0x0a,0x31,0x34,0x34,0x20,0x31,0x39,0x32,0x0a,0x49,0x6e,0x70,0x75,0x74,0x20,0x69,0x6e,0x70,0x75,0x74,0x20,0x30,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x0a,0x4d,0x65,0x6d,0x6f,0x72,0x79,0x44,0x61,0x74,0x61,0x20,0x62,0x61,0x63,0x6b,0x62,0x6f,0x6e,0x65,0x2e,0x63,0x6c,0x73,0x5f,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x30,0x20,0x31,0x20,0x62,0x61,0x63,0x6b,0x62,0x6f,0x6e,0x65,0x2e,0x63,0x6c,0x73,0x5f,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x0a,0x4d,0x65,0x6d,0x6f,0x72,0x79,0x44,0x61,0x74,0x61,0x20,0x62,0x61,0x63,0x6b,0x62,0x6f,0x6e,0x65,0x2e,0x70,0x6f,0x73,0x5f,0x65,0x6d,0x62,0x65,0x64,0x20,0x30,0x20,0x31,0x20,0x62,0x61,0x63,0x6b,0x62,0x6f,0x6e,0x65,0x2e,0x70,0x6f,0x73,0x5f,0x65,0x6d,0x62,0x65,0x64,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x34,0x35,0x0a,0x43,0x6f,0x6e,0x76,0x6f,0x6c,0x75,0x74,0x69,0x6f,0x6e,0x20,0x43,0x6f,0x6e,0x76,0x5f,0x30,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x53,0x68,0x61,0x70,0x65,0x5f,0x31,0x35,0x33,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x33,0x32,0x20,0x31,0x31,0x3d,0x33,0x32,0x20,0x32,0x3d,0x31,0x20,0x31,0x32,0x3d,0x31,0x20,0x33,0x3d,0x33,0x32,0x20,0x31,0x33,0x3d,0x33,0x32,0x20,0x34,0x3d,0x30,0x20,0x31,0x34,0x3d,0x30,0x20,0x31,0x35,0x3d,0x30,0x20,0x31,0x36,0x3d,0x30,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x32,0x33,0x35,0x39,0x32,0x39,0x36,0x0a,0x52,0x65,0x73,0x68,0x61,0x70,0x65,0x20,0x52,0x65,0x73,0x68,0x61,0x70,0x65,0x5f,0x38,0x20,0x31,0x20,0x31,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x53,0x68,0x61,0x70,0x65,0x5f,0x31,0x35,0x33,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x54,0x72,0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x5f,0x31,0x36,0x31,0x20,0x30,0x3d,0x2d,0x31,0x20,0x31,0x3d,0x37,0x36,0x38,0x0a,0x50,0x65,0x72,0x6d,0x75,0x74,0x65,0x20,0x54,0x72,0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x5f,0x39,0x20,0x31,0x20,0x31,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x54,0x72,0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x5f,0x31,0x36,0x31,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x5f,0x31,0x36,0x32,0x20,0x30,0x3d,0x31,0x0a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x20,0x43,0x6f,0x6e,0x63,0x61,0x74,0x5f,0x31,0x30,0x20,0x32,0x20,0x31,0x20,0x62,0x61,0x63,0x6b,0x62,0x6f,0x6e,0x65,0x2e,0x63,0x6c,0x73,0x5f,0x74,0x6f,0x6b,0x65,0x6e,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x43,0x6f,0x6e,0x63,0x61,0x74,0x5f,0x31,0x36,0x32,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x31,0x36,0x33,0x20,0x30,0x3d,0x30,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x31,0x20,0x32,0x20,0x31,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x31,0x36,0x33,0x20,0x62,0x61,0x63,0x6b,0x62,0x6f,0x6e,0x65,0x2e,0x70,0x6f,0x73,0x5f,0x65,0x6d,0x62,0x65,0x64,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x32,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x31,0x20,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x0a,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x5f,0x32,0x31,0x20,0x33,0x20,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x31,0x37,0x34,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x32,0x20,0x32,0x3d,0x35,0x38,0x39,0x38,0x32,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x32,0x32,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x31,0x37,0x34,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x32,0x33,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x37,0x36,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x34,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x37,0x36,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x31,0x37,0x37,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x33,0x30,0x37,0x32,0x20,0x39,0x3d,0x37,0x36,0x38,0x20,0x31,0x30,0x3d,0x34,0x0a,0x47,0x45,0x4c,0x55,0x20,0x47,0x65,0x6c,0x75,0x5f,0x32,0x35,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x31,0x37,0x37,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x20,0x30,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x36,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x32,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x37,0x36,0x38,0x20,0x39,0x3d,0x33,0x30,0x37,0x32,0x20,0x31,0x30,0x3d,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x32,0x37,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x33,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x32,0x38,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x34,0x20,0x31,0x20,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x0a,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x5f,0x33,0x37,0x20,0x33,0x20,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x31,0x39,0x30,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x32,0x20,0x32,0x3d,0x35,0x38,0x39,0x38,0x32,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x33,0x38,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x31,0x39,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x30,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x35,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x33,0x39,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x39,0x32,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x34,0x30,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x39,0x32,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x31,0x39,0x33,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x33,0x30,0x37,0x32,0x20,0x39,0x3d,0x37,0x36,0x38,0x20,0x31,0x30,0x3d,0x34,0x0a,0x47,0x45,0x4c,0x55,0x20,0x47,0x65,0x6c,0x75,0x5f,0x34,0x31,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x31,0x39,0x33,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x34,0x20,0x30,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x34,0x32,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x34,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x38,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x37,0x36,0x38,0x20,0x39,0x3d,0x33,0x30,0x37,0x32,0x20,0x31,0x30,0x3d,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x34,0x33,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x38,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x32,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x36,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x34,0x34,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x37,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x37,0x20,0x31,0x20,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x37,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x37,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x37,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x37,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x0a,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x5f,0x35,0x33,0x20,0x33,0x20,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x37,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x37,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x37,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x32,0x30,0x36,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x32,0x20,0x32,0x3d,0x35,0x38,0x39,0x38,0x32,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x35,0x34,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x32,0x30,0x36,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x36,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x38,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x36,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x35,0x35,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x30,0x38,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x35,0x36,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x30,0x38,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x32,0x30,0x39,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x33,0x30,0x37,0x32,0x20,0x39,0x3d,0x37,0x36,0x38,0x20,0x31,0x30,0x3d,0x34,0x0a,0x47,0x45,0x4c,0x55,0x20,0x47,0x65,0x6c,0x75,0x5f,0x35,0x37,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x32,0x30,0x39,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x30,0x20,0x30,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x35,0x38,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x34,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x37,0x36,0x38,0x20,0x39,0x3d,0x33,0x30,0x37,0x32,0x20,0x31,0x30,0x3d,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x35,0x39,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x34,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x38,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x39,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x38,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x36,0x30,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x30,0x20,0x31,0x20,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x0a,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x5f,0x36,0x39,0x20,0x33,0x20,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x32,0x32,0x32,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x32,0x20,0x32,0x3d,0x35,0x38,0x39,0x38,0x32,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x37,0x30,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x32,0x32,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x35,0x32,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x31,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x35,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x35,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x35,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x37,0x31,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x35,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x32,0x34,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x37,0x32,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x32,0x34,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x32,0x32,0x35,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x33,0x30,0x37,0x32,0x20,0x39,0x3d,0x37,0x36,0x38,0x20,0x31,0x30,0x3d,0x34,0x0a,0x47,0x45,0x4c,0x55,0x20,0x47,0x65,0x6c,0x75,0x5f,0x37,0x33,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x32,0x32,0x35,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x35,0x36,0x20,0x30,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x37,0x34,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x35,0x36,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x30,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x37,0x36,0x38,0x20,0x39,0x3d,0x33,0x30,0x37,0x32,0x20,0x31,0x30,0x3d,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x37,0x35,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x35,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x34,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x32,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x34,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x37,0x36,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x35,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x33,0x20,0x31,0x20,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x35,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x35,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x35,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x35,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x0a,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x5f,0x38,0x35,0x20,0x33,0x20,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x35,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x35,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x35,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x32,0x33,0x38,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x32,0x20,0x32,0x3d,0x35,0x38,0x39,0x38,0x32,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x38,0x36,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x32,0x33,0x38,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x38,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x34,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x38,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x38,0x37,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x34,0x30,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x38,0x38,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x34,0x30,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x32,0x34,0x31,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x33,0x30,0x37,0x32,0x20,0x39,0x3d,0x37,0x36,0x38,0x20,0x31,0x30,0x3d,0x34,0x0a,0x47,0x45,0x4c,0x55,0x20,0x47,0x65,0x6c,0x75,0x5f,0x38,0x39,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x32,0x34,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x37,0x32,0x20,0x30,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x39,0x30,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x37,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x37,0x36,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x37,0x36,0x38,0x20,0x39,0x3d,0x33,0x30,0x37,0x32,0x20,0x31,0x30,0x3d,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x39,0x31,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x36,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x37,0x36,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x30,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x35,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x39,0x32,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x39,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x36,0x20,0x31,0x20,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x39,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x39,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x39,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x39,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x0a,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x30,0x31,0x20,0x33,0x20,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x39,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x39,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x39,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x32,0x35,0x34,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x32,0x20,0x32,0x3d,0x35,0x38,0x39,0x38,0x32,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x30,0x32,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x32,0x35,0x34,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x34,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x37,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x34,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x30,0x33,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x35,0x36,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x30,0x34,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x35,0x36,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x32,0x35,0x37,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x33,0x30,0x37,0x32,0x20,0x39,0x3d,0x37,0x36,0x38,0x20,0x31,0x30,0x3d,0x34,0x0a,0x47,0x45,0x4c,0x55,0x20,0x47,0x65,0x6c,0x75,0x5f,0x31,0x30,0x35,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x32,0x35,0x37,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x38,0x20,0x30,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x30,0x36,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x38,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x39,0x32,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x37,0x36,0x38,0x20,0x39,0x3d,0x33,0x30,0x37,0x32,0x20,0x31,0x30,0x3d,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x30,0x37,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x38,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x39,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x39,0x36,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x38,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x39,0x36,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x39,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x39,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x30,0x38,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x39,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x33,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x39,0x20,0x31,0x20,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x0a,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x31,0x37,0x20,0x33,0x20,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x32,0x37,0x30,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x32,0x20,0x32,0x3d,0x35,0x38,0x39,0x38,0x32,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x31,0x38,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x39,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x32,0x37,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x30,0x30,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x30,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x30,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x30,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x30,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x31,0x39,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x30,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x37,0x32,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x32,0x30,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x37,0x32,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x32,0x37,0x33,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x33,0x30,0x37,0x32,0x20,0x39,0x3d,0x37,0x36,0x38,0x20,0x31,0x30,0x3d,0x34,0x0a,0x47,0x45,0x4c,0x55,0x20,0x47,0x65,0x6c,0x75,0x5f,0x31,0x32,0x31,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x32,0x37,0x33,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x30,0x34,0x20,0x30,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x32,0x32,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x30,0x34,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x30,0x38,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x37,0x36,0x38,0x20,0x39,0x3d,0x33,0x30,0x37,0x32,0x20,0x31,0x30,0x3d,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x32,0x33,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x30,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x30,0x38,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x32,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x31,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x32,0x34,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x37,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x32,0x20,0x31,0x20,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x37,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x37,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x37,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x37,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x0a,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x33,0x33,0x20,0x33,0x20,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x37,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x37,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x32,0x37,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x32,0x38,0x36,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x32,0x20,0x32,0x3d,0x35,0x38,0x39,0x38,0x32,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x33,0x34,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x32,0x38,0x36,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x36,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x33,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x36,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x33,0x35,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x38,0x38,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x33,0x36,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x38,0x38,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x32,0x38,0x39,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x33,0x30,0x37,0x32,0x20,0x39,0x3d,0x37,0x36,0x38,0x20,0x31,0x30,0x3d,0x34,0x0a,0x47,0x45,0x4c,0x55,0x20,0x47,0x65,0x6c,0x75,0x5f,0x31,0x33,0x37,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x32,0x38,0x39,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x32,0x30,0x20,0x30,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x33,0x38,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x32,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x32,0x34,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x37,0x36,0x38,0x20,0x39,0x3d,0x33,0x30,0x37,0x32,0x20,0x31,0x30,0x3d,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x33,0x39,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x31,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x32,0x34,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x32,0x38,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x34,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x32,0x38,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x32,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x32,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x34,0x30,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x32,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x31,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x35,0x20,0x31,0x20,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x0a,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x34,0x39,0x20,0x33,0x20,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x31,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x33,0x30,0x32,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x32,0x20,0x32,0x3d,0x35,0x38,0x39,0x38,0x32,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x35,0x30,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x32,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x33,0x30,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x33,0x32,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x36,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x33,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x33,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x33,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x35,0x31,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x33,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x33,0x30,0x34,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x35,0x32,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x33,0x30,0x34,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x33,0x30,0x35,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x33,0x30,0x37,0x32,0x20,0x39,0x3d,0x37,0x36,0x38,0x20,0x31,0x30,0x3d,0x34,0x0a,0x47,0x45,0x4c,0x55,0x20,0x47,0x65,0x6c,0x75,0x5f,0x31,0x35,0x33,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x33,0x30,0x35,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x33,0x36,0x20,0x30,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x35,0x34,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x33,0x36,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x30,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x37,0x36,0x38,0x20,0x39,0x3d,0x33,0x30,0x37,0x32,0x20,0x31,0x30,0x3d,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x35,0x35,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x33,0x32,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x34,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x37,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x34,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x35,0x36,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x35,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x38,0x20,0x31,0x20,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x35,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x35,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x35,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x35,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x0a,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x36,0x35,0x20,0x33,0x20,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x35,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x35,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x35,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x33,0x31,0x38,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x32,0x20,0x32,0x3d,0x35,0x38,0x39,0x38,0x32,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x36,0x36,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x33,0x31,0x38,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x38,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x39,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x38,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x36,0x37,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x33,0x32,0x30,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x36,0x38,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x33,0x32,0x30,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x33,0x32,0x31,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x33,0x30,0x37,0x32,0x20,0x39,0x3d,0x37,0x36,0x38,0x20,0x31,0x30,0x3d,0x34,0x0a,0x47,0x45,0x4c,0x55,0x20,0x47,0x65,0x6c,0x75,0x5f,0x31,0x36,0x39,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x33,0x32,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x35,0x32,0x20,0x30,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x37,0x30,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x35,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x35,0x36,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x37,0x36,0x38,0x20,0x39,0x3d,0x33,0x30,0x37,0x32,0x20,0x31,0x30,0x3d,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x37,0x31,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x34,0x38,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x35,0x36,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x30,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x33,0x30,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x37,0x32,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x39,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x33,0x31,0x20,0x31,0x20,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x39,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x39,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x39,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x39,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x0a,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x38,0x31,0x20,0x33,0x20,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x39,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x39,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x33,0x39,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x33,0x33,0x34,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x32,0x20,0x32,0x3d,0x35,0x38,0x39,0x38,0x32,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x38,0x32,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x33,0x33,0x34,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x34,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x33,0x32,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x34,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x38,0x33,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x33,0x33,0x36,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x38,0x34,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x33,0x33,0x36,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x33,0x33,0x37,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x33,0x30,0x37,0x32,0x20,0x39,0x3d,0x37,0x36,0x38,0x20,0x31,0x30,0x3d,0x34,0x0a,0x47,0x45,0x4c,0x55,0x20,0x47,0x65,0x6c,0x75,0x5f,0x31,0x38,0x35,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x33,0x33,0x37,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x38,0x20,0x30,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x31,0x38,0x36,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x38,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x37,0x32,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x37,0x36,0x38,0x20,0x39,0x3d,0x33,0x30,0x37,0x32,0x20,0x31,0x30,0x3d,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x38,0x37,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x36,0x34,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x37,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x37,0x36,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x33,0x33,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x37,0x36,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x37,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x37,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x38,0x38,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x37,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x33,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x33,0x34,0x20,0x31,0x20,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x33,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x0a,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x75,0x6c,0x74,0x69,0x48,0x65,0x61,0x64,0x41,0x74,0x74,0x65,0x6e,0x74,0x69,0x6f,0x6e,0x5f,0x31,0x39,0x37,0x20,0x33,0x20,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x32,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x71,0x6b,0x76,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x34,0x33,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x33,0x35,0x30,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x32,0x20,0x32,0x3d,0x35,0x38,0x39,0x38,0x32,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x31,0x39,0x38,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x37,0x36,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x41,0x64,0x64,0x5f,0x33,0x35,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x38,0x30,0x20,0x30,0x3d,0x30,0x0a,0x53,0x70,0x6c,0x69,0x74,0x20,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x33,0x35,0x20,0x31,0x20,0x32,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x38,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x38,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x38,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x31,0x39,0x39,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x38,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x33,0x35,0x32,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x30,0x30,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x33,0x35,0x32,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x33,0x35,0x33,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x33,0x30,0x37,0x32,0x20,0x39,0x3d,0x37,0x36,0x38,0x20,0x31,0x30,0x3d,0x34,0x0a,0x47,0x45,0x4c,0x55,0x20,0x47,0x65,0x6c,0x75,0x5f,0x32,0x30,0x31,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6c,0x75,0x5f,0x33,0x35,0x33,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x38,0x34,0x20,0x30,0x3d,0x31,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x30,0x32,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x38,0x34,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x38,0x38,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x37,0x36,0x38,0x20,0x39,0x3d,0x33,0x30,0x37,0x32,0x20,0x31,0x30,0x3d,0x34,0x0a,0x42,0x69,0x6e,0x61,0x72,0x79,0x4f,0x70,0x20,0x41,0x64,0x64,0x5f,0x32,0x30,0x33,0x20,0x32,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x38,0x30,0x5f,0x73,0x70,0x6c,0x69,0x74,0x6e,0x63,0x6e,0x6e,0x5f,0x30,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x38,0x38,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x39,0x32,0x20,0x30,0x3d,0x30,0x0a,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x20,0x4c,0x61,0x79,0x65,0x72,0x4e,0x6f,0x72,0x6d,0x5f,0x32,0x30,0x34,0x20,0x31,0x20,0x31,0x20,0x69,0x6e,0x70,0x75,0x74,0x2e,0x31,0x39,0x32,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x47,0x61,0x74,0x68,0x65,0x72,0x5f,0x33,0x35,0x37,0x20,0x30,0x3d,0x37,0x36,0x38,0x20,0x31,0x3d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2d,0x30,0x36,0x20,0x32,0x3d,0x31,0x0a,0x43,0x72,0x6f,0x70,0x20,0x47,0x61,0x74,0x68,0x65,0x72,0x5f,0x32,0x30,0x36,0x20,0x31,0x20,0x31,0x20,0x6f,0x6e,0x6e,0x78,0x3a,0x3a,0x47,0x61,0x74,0x68,0x65,0x72,0x5f,0x33,0x35,0x37,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x33,0x35,0x39,0x20,0x2d,0x32,0x33,0x33,0x30,0x39,0x3d,0x31,0x2c,0x30,0x20,0x2d,0x32,0x33,0x33,0x31,0x30,0x3d,0x31,0x2c,0x31,0x20,0x2d,0x32,0x33,0x33,0x31,0x31,0x3d,0x31,0x2c,0x30,0x0a,0x47,0x65,0x6d,0x6d,0x20,0x47,0x65,0x6d,0x6d,0x5f,0x32,0x30,0x37,0x20,0x31,0x20,0x31,0x20,0x6d,0x6d,0x64,0x65,0x70,0x6c,0x6f,0x79,0x3a,0x3a,0x47,0x65,0x6d,0x6d,0x5f,0x33,0x35,0x39,0x20,0x63,0x6c,0x73,0x5f,0x73,0x63,0x6f,0x72,0x65,0x20,0x33,0x3d,0x31,0x20,0x35,0x3d,0x31,0x20,0x36,0x3d,0x31,0x20,0x38,0x3d,0x31,0x30,0x30,0x30,0x20,0x39,0x3d,0x37,0x36,0x38,0x20,0x31,0x30,0x3d,0x34,0x0a,0x53,0x6f,0x66,0x74,0x6d,0x61,0x78,0x20,0x53,0x6f,0x66,0x74,0x6d,0x61,0x78,0x5f,0x32,0x30,0x38,0x20,0x31,0x20,0x31,0x20,0x63,0x6c,0x73,0x5f,0x73,0x63,0x6f,0x72,0x65,0x20,0x6f,0x75,0x74,0x70,0x75,0x74,0x20,0x30,0x3d,0x30,0x20,0x31,0x3d,0x31,0x0a,0x00};
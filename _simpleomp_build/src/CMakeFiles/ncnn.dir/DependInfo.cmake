@@ -0,0 +1,218 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/allocator.cpp" "src/CMakeFiles/ncnn.dir/allocator.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/allocator.cpp.o.d"
+  "/root/repo/src/autotunecache.cpp" "src/CMakeFiles/ncnn.dir/autotunecache.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/autotunecache.cpp.o.d"
+  "/root/repo/src/benchmark.cpp" "src/CMakeFiles/ncnn.dir/benchmark.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/benchmark.cpp.o.d"
+  "/root/repo/src/blob.cpp" "src/CMakeFiles/ncnn.dir/blob.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/blob.cpp.o.d"
+  "/root/repo/src/c_api.cpp" "src/CMakeFiles/ncnn.dir/c_api.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/c_api.cpp.o.d"
+  "/root/repo/src/command.cpp" "src/CMakeFiles/ncnn.dir/command.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/command.cpp.o.d"
+  "/root/repo/src/cpu.cpp" "src/CMakeFiles/ncnn.dir/cpu.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/cpu.cpp.o.d"
+  "/root/repo/src/datareader.cpp" "src/CMakeFiles/ncnn.dir/datareader.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/datareader.cpp.o.d"
+  "/root/repo/src/expression.cpp" "src/CMakeFiles/ncnn.dir/expression.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/expression.cpp.o.d"
+  "/root/repo/src/gpu.cpp" "src/CMakeFiles/ncnn.dir/gpu.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/gpu.cpp.o.d"
+  "/root/repo/src/layer.cpp" "src/CMakeFiles/ncnn.dir/layer.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer.cpp.o.d"
+  "/root/repo/src/layer/absval.cpp" "src/CMakeFiles/ncnn.dir/layer/absval.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/absval.cpp.o.d"
+  "/root/repo/src/layer/batchnorm.cpp" "src/CMakeFiles/ncnn.dir/layer/batchnorm.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/batchnorm.cpp.o.d"
+  "/root/repo/src/layer/bias.cpp" "src/CMakeFiles/ncnn.dir/layer/bias.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/bias.cpp.o.d"
+  "/root/repo/src/layer/binaryop.cpp" "src/CMakeFiles/ncnn.dir/layer/binaryop.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/binaryop.cpp.o.d"
+  "/root/repo/src/layer/bnll.cpp" "src/CMakeFiles/ncnn.dir/layer/bnll.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/bnll.cpp.o.d"
+  "/root/repo/src/layer/cast.cpp" "src/CMakeFiles/ncnn.dir/layer/cast.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/cast.cpp.o.d"
+  "/root/repo/src/layer/celu.cpp" "src/CMakeFiles/ncnn.dir/layer/celu.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/celu.cpp.o.d"
+  "/root/repo/src/layer/clip.cpp" "src/CMakeFiles/ncnn.dir/layer/clip.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/clip.cpp.o.d"
+  "/root/repo/src/layer/concat.cpp" "src/CMakeFiles/ncnn.dir/layer/concat.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/concat.cpp.o.d"
+  "/root/repo/src/layer/convolution.cpp" "src/CMakeFiles/ncnn.dir/layer/convolution.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/convolution.cpp.o.d"
+  "/root/repo/src/layer/convolution1d.cpp" "src/CMakeFiles/ncnn.dir/layer/convolution1d.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/convolution1d.cpp.o.d"
+  "/root/repo/src/layer/convolution3d.cpp" "src/CMakeFiles/ncnn.dir/layer/convolution3d.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/convolution3d.cpp.o.d"
+  "/root/repo/src/layer/convolutiondepthwise.cpp" "src/CMakeFiles/ncnn.dir/layer/convolutiondepthwise.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/convolutiondepthwise.cpp.o.d"
+  "/root/repo/src/layer/convolutiondepthwise1d.cpp" "src/CMakeFiles/ncnn.dir/layer/convolutiondepthwise1d.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/convolutiondepthwise1d.cpp.o.d"
+  "/root/repo/src/layer/convolutiondepthwise3d.cpp" "src/CMakeFiles/ncnn.dir/layer/convolutiondepthwise3d.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/convolutiondepthwise3d.cpp.o.d"
+  "/root/repo/src/layer/copyto.cpp" "src/CMakeFiles/ncnn.dir/layer/copyto.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/copyto.cpp.o.d"
+  "/root/repo/src/layer/crop.cpp" "src/CMakeFiles/ncnn.dir/layer/crop.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/crop.cpp.o.d"
+  "/root/repo/src/layer/cumulativesum.cpp" "src/CMakeFiles/ncnn.dir/layer/cumulativesum.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/cumulativesum.cpp.o.d"
+  "/root/repo/src/layer/deconvolution.cpp" "src/CMakeFiles/ncnn.dir/layer/deconvolution.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/deconvolution.cpp.o.d"
+  "/root/repo/src/layer/deconvolution1d.cpp" "src/CMakeFiles/ncnn.dir/layer/deconvolution1d.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/deconvolution1d.cpp.o.d"
+  "/root/repo/src/layer/deconvolution3d.cpp" "src/CMakeFiles/ncnn.dir/layer/deconvolution3d.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/deconvolution3d.cpp.o.d"
+  "/root/repo/src/layer/deconvolutiondepthwise.cpp" "src/CMakeFiles/ncnn.dir/layer/deconvolutiondepthwise.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/deconvolutiondepthwise.cpp.o.d"
+  "/root/repo/src/layer/deconvolutiondepthwise1d.cpp" "src/CMakeFiles/ncnn.dir/layer/deconvolutiondepthwise1d.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/deconvolutiondepthwise1d.cpp.o.d"
+  "/root/repo/src/layer/deconvolutiondepthwise3d.cpp" "src/CMakeFiles/ncnn.dir/layer/deconvolutiondepthwise3d.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/deconvolutiondepthwise3d.cpp.o.d"
+  "/root/repo/src/layer/deepcopy.cpp" "src/CMakeFiles/ncnn.dir/layer/deepcopy.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/deepcopy.cpp.o.d"
+  "/root/repo/src/layer/deformableconv2d.cpp" "src/CMakeFiles/ncnn.dir/layer/deformableconv2d.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/deformableconv2d.cpp.o.d"
+  "/root/repo/src/layer/dequantize.cpp" "src/CMakeFiles/ncnn.dir/layer/dequantize.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/dequantize.cpp.o.d"
+  "/root/repo/src/layer/detectionoutput.cpp" "src/CMakeFiles/ncnn.dir/layer/detectionoutput.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/detectionoutput.cpp.o.d"
+  "/root/repo/src/layer/diag.cpp" "src/CMakeFiles/ncnn.dir/layer/diag.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/diag.cpp.o.d"
+  "/root/repo/src/layer/dropout.cpp" "src/CMakeFiles/ncnn.dir/layer/dropout.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/dropout.cpp.o.d"
+  "/root/repo/src/layer/einsum.cpp" "src/CMakeFiles/ncnn.dir/layer/einsum.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/einsum.cpp.o.d"
+  "/root/repo/src/layer/eltwise.cpp" "src/CMakeFiles/ncnn.dir/layer/eltwise.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/eltwise.cpp.o.d"
+  "/root/repo/src/layer/elu.cpp" "src/CMakeFiles/ncnn.dir/layer/elu.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/elu.cpp.o.d"
+  "/root/repo/src/layer/embed.cpp" "src/CMakeFiles/ncnn.dir/layer/embed.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/embed.cpp.o.d"
+  "/root/repo/src/layer/erf.cpp" "src/CMakeFiles/ncnn.dir/layer/erf.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/erf.cpp.o.d"
+  "/root/repo/src/layer/exp.cpp" "src/CMakeFiles/ncnn.dir/layer/exp.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/exp.cpp.o.d"
+  "/root/repo/src/layer/expanddims.cpp" "src/CMakeFiles/ncnn.dir/layer/expanddims.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/expanddims.cpp.o.d"
+  "/root/repo/src/layer/flatten.cpp" "src/CMakeFiles/ncnn.dir/layer/flatten.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/flatten.cpp.o.d"
+  "/root/repo/src/layer/flip.cpp" "src/CMakeFiles/ncnn.dir/layer/flip.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/flip.cpp.o.d"
+  "/root/repo/src/layer/fold.cpp" "src/CMakeFiles/ncnn.dir/layer/fold.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/fold.cpp.o.d"
+  "/root/repo/src/layer/gelu.cpp" "src/CMakeFiles/ncnn.dir/layer/gelu.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/gelu.cpp.o.d"
+  "/root/repo/src/layer/gemm.cpp" "src/CMakeFiles/ncnn.dir/layer/gemm.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/gemm.cpp.o.d"
+  "/root/repo/src/layer/glu.cpp" "src/CMakeFiles/ncnn.dir/layer/glu.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/glu.cpp.o.d"
+  "/root/repo/src/layer/gridsample.cpp" "src/CMakeFiles/ncnn.dir/layer/gridsample.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/gridsample.cpp.o.d"
+  "/root/repo/src/layer/groupnorm.cpp" "src/CMakeFiles/ncnn.dir/layer/groupnorm.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/groupnorm.cpp.o.d"
+  "/root/repo/src/layer/gru.cpp" "src/CMakeFiles/ncnn.dir/layer/gru.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/gru.cpp.o.d"
+  "/root/repo/src/layer/hardsigmoid.cpp" "src/CMakeFiles/ncnn.dir/layer/hardsigmoid.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/hardsigmoid.cpp.o.d"
+  "/root/repo/src/layer/hardswish.cpp" "src/CMakeFiles/ncnn.dir/layer/hardswish.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/hardswish.cpp.o.d"
+  "/root/repo/src/layer/innerproduct.cpp" "src/CMakeFiles/ncnn.dir/layer/innerproduct.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/innerproduct.cpp.o.d"
+  "/root/repo/src/layer/input.cpp" "src/CMakeFiles/ncnn.dir/layer/input.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/input.cpp.o.d"
+  "/root/repo/src/layer/instancenorm.cpp" "src/CMakeFiles/ncnn.dir/layer/instancenorm.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/instancenorm.cpp.o.d"
+  "/root/repo/src/layer/interp.cpp" "src/CMakeFiles/ncnn.dir/layer/interp.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/interp.cpp.o.d"
+  "/root/repo/src/layer/inversespectrogram.cpp" "src/CMakeFiles/ncnn.dir/layer/inversespectrogram.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/inversespectrogram.cpp.o.d"
+  "/root/repo/src/layer/layernorm.cpp" "src/CMakeFiles/ncnn.dir/layer/layernorm.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/layernorm.cpp.o.d"
+  "/root/repo/src/layer/log.cpp" "src/CMakeFiles/ncnn.dir/layer/log.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/log.cpp.o.d"
+  "/root/repo/src/layer/lrn.cpp" "src/CMakeFiles/ncnn.dir/layer/lrn.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/lrn.cpp.o.d"
+  "/root/repo/src/layer/lstm.cpp" "src/CMakeFiles/ncnn.dir/layer/lstm.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/lstm.cpp.o.d"
+  "/root/repo/src/layer/matmul.cpp" "src/CMakeFiles/ncnn.dir/layer/matmul.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/matmul.cpp.o.d"
+  "/root/repo/src/layer/memorydata.cpp" "src/CMakeFiles/ncnn.dir/layer/memorydata.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/memorydata.cpp.o.d"
+  "/root/repo/src/layer/mish.cpp" "src/CMakeFiles/ncnn.dir/layer/mish.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/mish.cpp.o.d"
+  "/root/repo/src/layer/multiheadattention.cpp" "src/CMakeFiles/ncnn.dir/layer/multiheadattention.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/multiheadattention.cpp.o.d"
+  "/root/repo/src/layer/mvn.cpp" "src/CMakeFiles/ncnn.dir/layer/mvn.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/mvn.cpp.o.d"
+  "/root/repo/src/layer/noop.cpp" "src/CMakeFiles/ncnn.dir/layer/noop.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/noop.cpp.o.d"
+  "/root/repo/src/layer/normalize.cpp" "src/CMakeFiles/ncnn.dir/layer/normalize.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/normalize.cpp.o.d"
+  "/root/repo/src/layer/packing.cpp" "src/CMakeFiles/ncnn.dir/layer/packing.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/packing.cpp.o.d"
+  "/root/repo/src/layer/padding.cpp" "src/CMakeFiles/ncnn.dir/layer/padding.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/padding.cpp.o.d"
+  "/root/repo/src/layer/permute.cpp" "src/CMakeFiles/ncnn.dir/layer/permute.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/permute.cpp.o.d"
+  "/root/repo/src/layer/pixelshuffle.cpp" "src/CMakeFiles/ncnn.dir/layer/pixelshuffle.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/pixelshuffle.cpp.o.d"
+  "/root/repo/src/layer/pooling.cpp" "src/CMakeFiles/ncnn.dir/layer/pooling.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/pooling.cpp.o.d"
+  "/root/repo/src/layer/pooling1d.cpp" "src/CMakeFiles/ncnn.dir/layer/pooling1d.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/pooling1d.cpp.o.d"
+  "/root/repo/src/layer/pooling3d.cpp" "src/CMakeFiles/ncnn.dir/layer/pooling3d.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/pooling3d.cpp.o.d"
+  "/root/repo/src/layer/power.cpp" "src/CMakeFiles/ncnn.dir/layer/power.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/power.cpp.o.d"
+  "/root/repo/src/layer/prelu.cpp" "src/CMakeFiles/ncnn.dir/layer/prelu.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/prelu.cpp.o.d"
+  "/root/repo/src/layer/priorbox.cpp" "src/CMakeFiles/ncnn.dir/layer/priorbox.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/priorbox.cpp.o.d"
+  "/root/repo/src/layer/proposal.cpp" "src/CMakeFiles/ncnn.dir/layer/proposal.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/proposal.cpp.o.d"
+  "/root/repo/src/layer/psroipooling.cpp" "src/CMakeFiles/ncnn.dir/layer/psroipooling.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/psroipooling.cpp.o.d"
+  "/root/repo/src/layer/quantize.cpp" "src/CMakeFiles/ncnn.dir/layer/quantize.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/quantize.cpp.o.d"
+  "/root/repo/src/layer/reduction.cpp" "src/CMakeFiles/ncnn.dir/layer/reduction.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/reduction.cpp.o.d"
+  "/root/repo/src/layer/relu.cpp" "src/CMakeFiles/ncnn.dir/layer/relu.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/relu.cpp.o.d"
+  "/root/repo/src/layer/reorg.cpp" "src/CMakeFiles/ncnn.dir/layer/reorg.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/reorg.cpp.o.d"
+  "/root/repo/src/layer/requantize.cpp" "src/CMakeFiles/ncnn.dir/layer/requantize.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/requantize.cpp.o.d"
+  "/root/repo/src/layer/reshape.cpp" "src/CMakeFiles/ncnn.dir/layer/reshape.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/reshape.cpp.o.d"
+  "/root/repo/src/layer/rmsnorm.cpp" "src/CMakeFiles/ncnn.dir/layer/rmsnorm.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/rmsnorm.cpp.o.d"
+  "/root/repo/src/layer/rnn.cpp" "src/CMakeFiles/ncnn.dir/layer/rnn.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/rnn.cpp.o.d"
+  "/root/repo/src/layer/roialign.cpp" "src/CMakeFiles/ncnn.dir/layer/roialign.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/roialign.cpp.o.d"
+  "/root/repo/src/layer/roipooling.cpp" "src/CMakeFiles/ncnn.dir/layer/roipooling.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/roipooling.cpp.o.d"
+  "/root/repo/src/layer/rotaryembed.cpp" "src/CMakeFiles/ncnn.dir/layer/rotaryembed.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/rotaryembed.cpp.o.d"
+  "/root/repo/src/layer/scale.cpp" "src/CMakeFiles/ncnn.dir/layer/scale.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/scale.cpp.o.d"
+  "/root/repo/src/layer/sdpa.cpp" "src/CMakeFiles/ncnn.dir/layer/sdpa.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/sdpa.cpp.o.d"
+  "/root/repo/src/layer/selu.cpp" "src/CMakeFiles/ncnn.dir/layer/selu.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/selu.cpp.o.d"
+  "/root/repo/src/layer/shrink.cpp" "src/CMakeFiles/ncnn.dir/layer/shrink.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/shrink.cpp.o.d"
+  "/root/repo/src/layer/shufflechannel.cpp" "src/CMakeFiles/ncnn.dir/layer/shufflechannel.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/shufflechannel.cpp.o.d"
+  "/root/repo/src/layer/sigmoid.cpp" "src/CMakeFiles/ncnn.dir/layer/sigmoid.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/sigmoid.cpp.o.d"
+  "/root/repo/src/layer/slice.cpp" "src/CMakeFiles/ncnn.dir/layer/slice.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/slice.cpp.o.d"
+  "/root/repo/src/layer/softmax.cpp" "src/CMakeFiles/ncnn.dir/layer/softmax.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/softmax.cpp.o.d"
+  "/root/repo/src/layer/softplus.cpp" "src/CMakeFiles/ncnn.dir/layer/softplus.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/softplus.cpp.o.d"
+  "/root/repo/src/layer/spectrogram.cpp" "src/CMakeFiles/ncnn.dir/layer/spectrogram.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/spectrogram.cpp.o.d"
+  "/root/repo/src/layer/split.cpp" "src/CMakeFiles/ncnn.dir/layer/split.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/split.cpp.o.d"
+  "/root/repo/src/layer/squeeze.cpp" "src/CMakeFiles/ncnn.dir/layer/squeeze.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/squeeze.cpp.o.d"
+  "/root/repo/src/layer/statisticspooling.cpp" "src/CMakeFiles/ncnn.dir/layer/statisticspooling.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/statisticspooling.cpp.o.d"
+  "/root/repo/src/layer/swish.cpp" "src/CMakeFiles/ncnn.dir/layer/swish.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/swish.cpp.o.d"
+  "/root/repo/src/layer/tanh.cpp" "src/CMakeFiles/ncnn.dir/layer/tanh.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/tanh.cpp.o.d"
+  "/root/repo/src/layer/threshold.cpp" "src/CMakeFiles/ncnn.dir/layer/threshold.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/threshold.cpp.o.d"
+  "/root/repo/src/layer/tile.cpp" "src/CMakeFiles/ncnn.dir/layer/tile.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/tile.cpp.o.d"
+  "/root/repo/src/layer/unaryop.cpp" "src/CMakeFiles/ncnn.dir/layer/unaryop.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/unaryop.cpp.o.d"
+  "/root/repo/src/layer/unfold.cpp" "src/CMakeFiles/ncnn.dir/layer/unfold.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/unfold.cpp.o.d"
+  "/root/repo/src/layer/x86/absval_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/absval_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/absval_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/batchnorm_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/batchnorm_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/batchnorm_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/bias_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/bias_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/bias_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/binaryop_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/binaryop_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/binaryop_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/bnll_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/bnll_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/bnll_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/cast_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/cast_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/cast_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/clip_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/clip_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/clip_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/concat_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/concat_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/concat_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/convolution1d_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/convolution1d_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/convolution1d_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/convolution_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/convolution_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/convolution_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/convolutiondepthwise_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/convolutiondepthwise_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/convolutiondepthwise_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/crop_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/crop_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/crop_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/deconvolution_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/deconvolution_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/deconvolution_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/deconvolutiondepthwise_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/deconvolutiondepthwise_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/deconvolutiondepthwise_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/deformableconv2d_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/deformableconv2d_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/deformableconv2d_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/dequantize_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/dequantize_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/dequantize_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/dropout_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/dropout_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/dropout_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/eltwise_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/eltwise_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/eltwise_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/elu_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/elu_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/elu_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/erf_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/erf_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/erf_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/flatten_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/flatten_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/flatten_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/gelu_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/gelu_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/gelu_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/gemm_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/gemm_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/gemm_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/gridsample_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/gridsample_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/gridsample_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/groupnorm_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/groupnorm_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/groupnorm_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/gru_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/gru_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/gru_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/hardsigmoid_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/hardsigmoid_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/hardsigmoid_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/hardswish_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/hardswish_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/hardswish_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/innerproduct_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/innerproduct_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/innerproduct_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/instancenorm_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/instancenorm_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/instancenorm_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/interp_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/interp_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/interp_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/inversespectrogram_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/inversespectrogram_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/inversespectrogram_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/layernorm_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/layernorm_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/layernorm_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/lrn_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/lrn_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/lrn_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/lstm_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/lstm_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/lstm_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/matmul_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/matmul_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/matmul_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/mish_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/mish_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/mish_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/multiheadattention_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/multiheadattention_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/multiheadattention_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/packing_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/packing_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/packing_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/padding_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/padding_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/padding_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/pixelshuffle_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/pixelshuffle_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/pixelshuffle_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/pooling_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/pooling_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/pooling_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/prelu_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/prelu_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/prelu_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/quantize_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/quantize_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/quantize_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/relu_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/relu_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/relu_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/requantize_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/requantize_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/requantize_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/reshape_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/reshape_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/reshape_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/rmsnorm_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/rmsnorm_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/rmsnorm_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/rnn_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/rnn_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/rnn_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/roialign_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/roialign_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/roialign_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/rotaryembed_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/rotaryembed_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/rotaryembed_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/scale_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/scale_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/scale_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/sdpa_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/sdpa_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/sdpa_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/selu_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/selu_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/selu_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/shufflechannel_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/shufflechannel_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/shufflechannel_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/sigmoid_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/sigmoid_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/sigmoid_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/slice_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/slice_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/slice_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/softmax_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/softmax_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/softmax_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/spectrogram_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/spectrogram_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/spectrogram_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/swish_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/swish_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/swish_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/tanh_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/tanh_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/tanh_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/unaryop_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/unaryop_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/unaryop_x86.cpp.o.d"
+  "/root/repo/src/layer/x86/yolov3detectionoutput_x86.cpp" "src/CMakeFiles/ncnn.dir/layer/x86/yolov3detectionoutput_x86.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/x86/yolov3detectionoutput_x86.cpp.o.d"
+  "/root/repo/src/layer/yolodetectionoutput.cpp" "src/CMakeFiles/ncnn.dir/layer/yolodetectionoutput.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/yolodetectionoutput.cpp.o.d"
+  "/root/repo/src/layer/yolov3detectionoutput.cpp" "src/CMakeFiles/ncnn.dir/layer/yolov3detectionoutput.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/layer/yolov3detectionoutput.cpp.o.d"
+  "/root/repo/src/mat.cpp" "src/CMakeFiles/ncnn.dir/mat.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/mat.cpp.o.d"
+  "/root/repo/src/mat_pixel.cpp" "src/CMakeFiles/ncnn.dir/mat_pixel.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/mat_pixel.cpp.o.d"
+  "/root/repo/src/mat_pixel_affine.cpp" "src/CMakeFiles/ncnn.dir/mat_pixel_affine.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/mat_pixel_affine.cpp.o.d"
+  "/root/repo/src/mat_pixel_drawing.cpp" "src/CMakeFiles/ncnn.dir/mat_pixel_drawing.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/mat_pixel_drawing.cpp.o.d"
+  "/root/repo/src/mat_pixel_resize.cpp" "src/CMakeFiles/ncnn.dir/mat_pixel_resize.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/mat_pixel_resize.cpp.o.d"
+  "/root/repo/src/mat_pixel_rotate.cpp" "src/CMakeFiles/ncnn.dir/mat_pixel_rotate.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/mat_pixel_rotate.cpp.o.d"
+  "/root/repo/src/modelbin.cpp" "src/CMakeFiles/ncnn.dir/modelbin.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/modelbin.cpp.o.d"
+  "/root/repo/src/net.cpp" "src/CMakeFiles/ncnn.dir/net.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/net.cpp.o.d"
+  "/root/repo/src/option.cpp" "src/CMakeFiles/ncnn.dir/option.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/option.cpp.o.d"
+  "/root/repo/src/paramdict.cpp" "src/CMakeFiles/ncnn.dir/paramdict.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/paramdict.cpp.o.d"
+  "/root/repo/src/pipeline.cpp" "src/CMakeFiles/ncnn.dir/pipeline.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/pipeline.cpp.o.d"
+  "/root/repo/src/pipelinecache.cpp" "src/CMakeFiles/ncnn.dir/pipelinecache.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/pipelinecache.cpp.o.d"
+  "/root/repo/src/simplemath.cpp" "src/CMakeFiles/ncnn.dir/simplemath.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/simplemath.cpp.o.d"
+  "/root/repo/src/simpleocv.cpp" "src/CMakeFiles/ncnn.dir/simpleocv.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/simpleocv.cpp.o.d"
+  "/root/repo/src/simpleomp.cpp" "src/CMakeFiles/ncnn.dir/simpleomp.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/simpleomp.cpp.o.d"
+  "/root/repo/src/simplestl.cpp" "src/CMakeFiles/ncnn.dir/simplestl.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/simplestl.cpp.o.d"
+  "/root/repo/src/simplevk.cpp" "src/CMakeFiles/ncnn.dir/simplevk.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/simplevk.cpp.o.d"
+  "/root/repo/src/weightcache.cpp" "src/CMakeFiles/ncnn.dir/weightcache.cpp.o" "gcc" "src/CMakeFiles/ncnn.dir/weightcache.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncnntestutil.dir/testutil.cpp.o"
+  "CMakeFiles/ncnntestutil.dir/testutil.cpp.o.d"
+  "libncnntestutil.a"
+  "libncnntestutil.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ncnntestutil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_celu.dir/test_celu.cpp.o"
+  "CMakeFiles/test_celu.dir/test_celu.cpp.o.d"
+  "test_celu"
+  "test_celu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_celu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
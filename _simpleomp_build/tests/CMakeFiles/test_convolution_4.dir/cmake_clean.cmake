@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convolution_4.dir/test_convolution_4.cpp.o"
+  "CMakeFiles/test_convolution_4.dir/test_convolution_4.cpp.o.d"
+  "test_convolution_4"
+  "test_convolution_4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convolution_4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
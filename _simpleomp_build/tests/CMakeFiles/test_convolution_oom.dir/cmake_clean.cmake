@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convolution_oom.dir/test_convolution_oom.cpp.o"
+  "CMakeFiles/test_convolution_oom.dir/test_convolution_oom.cpp.o.d"
+  "test_convolution_oom"
+  "test_convolution_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convolution_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convolutiondepthwise3d.dir/test_convolutiondepthwise3d.cpp.o"
+  "CMakeFiles/test_convolutiondepthwise3d.dir/test_convolutiondepthwise3d.cpp.o.d"
+  "test_convolutiondepthwise3d"
+  "test_convolutiondepthwise3d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convolutiondepthwise3d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
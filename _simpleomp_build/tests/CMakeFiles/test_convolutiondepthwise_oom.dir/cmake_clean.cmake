@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convolutiondepthwise_oom.dir/test_convolutiondepthwise_oom.cpp.o"
+  "CMakeFiles/test_convolutiondepthwise_oom.dir/test_convolutiondepthwise_oom.cpp.o.d"
+  "test_convolutiondepthwise_oom"
+  "test_convolutiondepthwise_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convolutiondepthwise_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
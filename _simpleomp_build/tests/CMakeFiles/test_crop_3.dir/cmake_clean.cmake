@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_crop_3.dir/test_crop_3.cpp.o"
+  "CMakeFiles/test_crop_3.dir/test_crop_3.cpp.o.d"
+  "test_crop_3"
+  "test_crop_3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_crop_3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
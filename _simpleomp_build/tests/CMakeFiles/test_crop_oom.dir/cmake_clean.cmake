@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_crop_oom.dir/test_crop_oom.cpp.o"
+  "CMakeFiles/test_crop_oom.dir/test_crop_oom.cpp.o.d"
+  "test_crop_oom"
+  "test_crop_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_crop_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
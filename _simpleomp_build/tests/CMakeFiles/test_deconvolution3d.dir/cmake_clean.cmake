@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_deconvolution3d.dir/test_deconvolution3d.cpp.o"
+  "CMakeFiles/test_deconvolution3d.dir/test_deconvolution3d.cpp.o.d"
+  "test_deconvolution3d"
+  "test_deconvolution3d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_deconvolution3d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_deconvolution_oom.dir/test_deconvolution_oom.cpp.o"
+  "CMakeFiles/test_deconvolution_oom.dir/test_deconvolution_oom.cpp.o.d"
+  "test_deconvolution_oom"
+  "test_deconvolution_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_deconvolution_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_deconvolutiondepthwise_oom.dir/test_deconvolutiondepthwise_oom.cpp.o"
+  "CMakeFiles/test_deconvolutiondepthwise_oom.dir/test_deconvolutiondepthwise_oom.cpp.o.d"
+  "test_deconvolutiondepthwise_oom"
+  "test_deconvolutiondepthwise_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_deconvolutiondepthwise_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
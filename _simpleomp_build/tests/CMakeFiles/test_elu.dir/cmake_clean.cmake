@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_elu.dir/test_elu.cpp.o"
+  "CMakeFiles/test_elu.dir/test_elu.cpp.o.d"
+  "test_elu"
+  "test_elu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_elu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_flatten_oom.dir/test_flatten_oom.cpp.o"
+  "CMakeFiles/test_flatten_oom.dir/test_flatten_oom.cpp.o.d"
+  "test_flatten_oom"
+  "test_flatten_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_flatten_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_flip.dir/test_flip.cpp.o"
+  "CMakeFiles/test_flip.dir/test_flip.cpp.o.d"
+  "test_flip"
+  "test_flip.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_flip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gemm_0a.dir/test_gemm_0a.cpp.o"
+  "CMakeFiles/test_gemm_0a.dir/test_gemm_0a.cpp.o.d"
+  "test_gemm_0a"
+  "test_gemm_0a.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gemm_0a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
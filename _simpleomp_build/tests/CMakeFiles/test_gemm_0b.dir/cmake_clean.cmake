@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gemm_0b.dir/test_gemm_0b.cpp.o"
+  "CMakeFiles/test_gemm_0b.dir/test_gemm_0b.cpp.o.d"
+  "test_gemm_0b"
+  "test_gemm_0b.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gemm_0b.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
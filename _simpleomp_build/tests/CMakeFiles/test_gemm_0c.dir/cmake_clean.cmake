@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gemm_0c.dir/test_gemm_0c.cpp.o"
+  "CMakeFiles/test_gemm_0c.dir/test_gemm_0c.cpp.o.d"
+  "test_gemm_0c"
+  "test_gemm_0c.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gemm_0c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gemm_0d.dir/test_gemm_0d.cpp.o"
+  "CMakeFiles/test_gemm_0d.dir/test_gemm_0d.cpp.o.d"
+  "test_gemm_0d"
+  "test_gemm_0d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gemm_0d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
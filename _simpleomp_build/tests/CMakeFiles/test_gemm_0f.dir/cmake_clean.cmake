@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gemm_0f.dir/test_gemm_0f.cpp.o"
+  "CMakeFiles/test_gemm_0f.dir/test_gemm_0f.cpp.o.d"
+  "test_gemm_0f"
+  "test_gemm_0f.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gemm_0f.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
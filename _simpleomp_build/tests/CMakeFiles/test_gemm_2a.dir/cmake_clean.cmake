@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gemm_2a.dir/test_gemm_2a.cpp.o"
+  "CMakeFiles/test_gemm_2a.dir/test_gemm_2a.cpp.o.d"
+  "test_gemm_2a"
+  "test_gemm_2a.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gemm_2a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
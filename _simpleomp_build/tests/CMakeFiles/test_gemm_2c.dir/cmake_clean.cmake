@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gemm_2c.dir/test_gemm_2c.cpp.o"
+  "CMakeFiles/test_gemm_2c.dir/test_gemm_2c.cpp.o.d"
+  "test_gemm_2c"
+  "test_gemm_2c.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gemm_2c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gemm_2d.dir/test_gemm_2d.cpp.o"
+  "CMakeFiles/test_gemm_2d.dir/test_gemm_2d.cpp.o.d"
+  "test_gemm_2d"
+  "test_gemm_2d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gemm_2d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
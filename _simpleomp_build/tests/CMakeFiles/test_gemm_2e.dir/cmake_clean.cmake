@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gemm_2e.dir/test_gemm_2e.cpp.o"
+  "CMakeFiles/test_gemm_2e.dir/test_gemm_2e.cpp.o.d"
+  "test_gemm_2e"
+  "test_gemm_2e.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gemm_2e.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
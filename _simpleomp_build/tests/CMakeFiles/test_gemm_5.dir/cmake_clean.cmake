@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gemm_5.dir/test_gemm_5.cpp.o"
+  "CMakeFiles/test_gemm_5.dir/test_gemm_5.cpp.o.d"
+  "test_gemm_5"
+  "test_gemm_5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gemm_5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
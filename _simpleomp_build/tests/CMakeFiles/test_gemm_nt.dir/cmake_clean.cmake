@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gemm_nt.dir/test_gemm_nt.cpp.o"
+  "CMakeFiles/test_gemm_nt.dir/test_gemm_nt.cpp.o.d"
+  "test_gemm_nt"
+  "test_gemm_nt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gemm_nt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
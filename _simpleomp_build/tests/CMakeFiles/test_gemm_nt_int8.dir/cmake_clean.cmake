@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gemm_nt_int8.dir/test_gemm_nt_int8.cpp.o"
+  "CMakeFiles/test_gemm_nt_int8.dir/test_gemm_nt_int8.cpp.o.d"
+  "test_gemm_nt_int8"
+  "test_gemm_nt_int8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gemm_nt_int8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
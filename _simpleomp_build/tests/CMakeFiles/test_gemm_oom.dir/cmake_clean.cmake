@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gemm_oom.dir/test_gemm_oom.cpp.o"
+  "CMakeFiles/test_gemm_oom.dir/test_gemm_oom.cpp.o.d"
+  "test_gemm_oom"
+  "test_gemm_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gemm_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_gru.dir/test_gru.cpp.o"
+  "CMakeFiles/test_gru.dir/test_gru.cpp.o.d"
+  "test_gru"
+  "test_gru.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_gru.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
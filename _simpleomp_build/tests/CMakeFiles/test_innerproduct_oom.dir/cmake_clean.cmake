@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_innerproduct_oom.dir/test_innerproduct_oom.cpp.o"
+  "CMakeFiles/test_innerproduct_oom.dir/test_innerproduct_oom.cpp.o.d"
+  "test_innerproduct_oom"
+  "test_innerproduct_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_innerproduct_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_interp_1.dir/test_interp_1.cpp.o"
+  "CMakeFiles/test_interp_1.dir/test_interp_1.cpp.o.d"
+  "test_interp_1"
+  "test_interp_1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_interp_1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
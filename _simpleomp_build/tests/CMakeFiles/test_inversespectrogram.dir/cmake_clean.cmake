@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_inversespectrogram.dir/test_inversespectrogram.cpp.o"
+  "CMakeFiles/test_inversespectrogram.dir/test_inversespectrogram.cpp.o.d"
+  "test_inversespectrogram"
+  "test_inversespectrogram.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_inversespectrogram.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
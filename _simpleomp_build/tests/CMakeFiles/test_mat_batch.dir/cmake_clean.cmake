@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mat_batch.dir/test_mat_batch.cpp.o"
+  "CMakeFiles/test_mat_batch.dir/test_mat_batch.cpp.o.d"
+  "test_mat_batch"
+  "test_mat_batch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mat_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
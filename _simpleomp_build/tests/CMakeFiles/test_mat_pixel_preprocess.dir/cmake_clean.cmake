@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mat_pixel_preprocess.dir/test_mat_pixel_preprocess.cpp.o"
+  "CMakeFiles/test_mat_pixel_preprocess.dir/test_mat_pixel_preprocess.cpp.o.d"
+  "test_mat_pixel_preprocess"
+  "test_mat_pixel_preprocess.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mat_pixel_preprocess.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_memorydata.dir/test_memorydata.cpp.o"
+  "CMakeFiles/test_memorydata.dir/test_memorydata.cpp.o.d"
+  "test_memorydata"
+  "test_memorydata.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_memorydata.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
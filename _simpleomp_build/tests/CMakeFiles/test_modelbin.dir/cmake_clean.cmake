@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_modelbin.dir/test_modelbin.cpp.o"
+  "CMakeFiles/test_modelbin.dir/test_modelbin.cpp.o.d"
+  "test_modelbin"
+  "test_modelbin.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_modelbin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
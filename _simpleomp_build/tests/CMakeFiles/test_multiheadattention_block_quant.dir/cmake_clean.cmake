@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_multiheadattention_block_quant.dir/test_multiheadattention_block_quant.cpp.o"
+  "CMakeFiles/test_multiheadattention_block_quant.dir/test_multiheadattention_block_quant.cpp.o.d"
+  "test_multiheadattention_block_quant"
+  "test_multiheadattention_block_quant.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_multiheadattention_block_quant.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
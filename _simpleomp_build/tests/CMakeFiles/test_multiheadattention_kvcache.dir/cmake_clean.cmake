@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_multiheadattention_kvcache.dir/test_multiheadattention_kvcache.cpp.o"
+  "CMakeFiles/test_multiheadattention_kvcache.dir/test_multiheadattention_kvcache.cpp.o.d"
+  "test_multiheadattention_kvcache"
+  "test_multiheadattention_kvcache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_multiheadattention_kvcache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
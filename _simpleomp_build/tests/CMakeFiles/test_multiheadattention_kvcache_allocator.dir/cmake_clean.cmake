@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_multiheadattention_kvcache_allocator.dir/test_multiheadattention_kvcache_allocator.cpp.o"
+  "CMakeFiles/test_multiheadattention_kvcache_allocator.dir/test_multiheadattention_kvcache_allocator.cpp.o.d"
+  "test_multiheadattention_kvcache_allocator"
+  "test_multiheadattention_kvcache_allocator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_multiheadattention_kvcache_allocator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
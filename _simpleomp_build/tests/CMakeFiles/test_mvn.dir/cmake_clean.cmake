@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mvn.dir/test_mvn.cpp.o"
+  "CMakeFiles/test_mvn.dir/test_mvn.cpp.o.d"
+  "test_mvn"
+  "test_mvn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mvn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
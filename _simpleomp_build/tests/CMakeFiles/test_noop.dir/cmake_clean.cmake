@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_noop.dir/test_noop.cpp.o"
+  "CMakeFiles/test_noop.dir/test_noop.cpp.o.d"
+  "test_noop"
+  "test_noop.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_noop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
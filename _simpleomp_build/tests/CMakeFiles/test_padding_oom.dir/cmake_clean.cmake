@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_padding_oom.dir/test_padding_oom.cpp.o"
+  "CMakeFiles/test_padding_oom.dir/test_padding_oom.cpp.o.d"
+  "test_padding_oom"
+  "test_padding_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_padding_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_parallel_branch.dir/test_parallel_branch.cpp.o"
+  "CMakeFiles/test_parallel_branch.dir/test_parallel_branch.cpp.o.d"
+  "test_parallel_branch"
+  "test_parallel_branch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_parallel_branch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_parallel_create_pipeline.dir/test_parallel_create_pipeline.cpp.o"
+  "CMakeFiles/test_parallel_create_pipeline.dir/test_parallel_create_pipeline.cpp.o.d"
+  "test_parallel_create_pipeline"
+  "test_parallel_create_pipeline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_parallel_create_pipeline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_paramdict.dir/test_paramdict.cpp.o"
+  "CMakeFiles/test_paramdict.dir/test_paramdict.cpp.o.d"
+  "test_paramdict"
+  "test_paramdict.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_paramdict.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_pixelshuffle.dir/test_pixelshuffle.cpp.o"
+  "CMakeFiles/test_pixelshuffle.dir/test_pixelshuffle.cpp.o.d"
+  "test_pixelshuffle"
+  "test_pixelshuffle.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pixelshuffle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
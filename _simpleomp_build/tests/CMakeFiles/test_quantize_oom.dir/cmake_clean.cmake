@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_quantize_oom.dir/test_quantize_oom.cpp.o"
+  "CMakeFiles/test_quantize_oom.dir/test_quantize_oom.cpp.o.d"
+  "test_quantize_oom"
+  "test_quantize_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_quantize_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_requantize.dir/test_requantize.cpp.o"
+  "CMakeFiles/test_requantize.dir/test_requantize.cpp.o.d"
+  "test_requantize"
+  "test_requantize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_requantize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_requantize_oom.dir/test_requantize_oom.cpp.o"
+  "CMakeFiles/test_requantize_oom.dir/test_requantize_oom.cpp.o.d"
+  "test_requantize_oom"
+  "test_requantize_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_requantize_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_reshape_oom.dir/test_reshape_oom.cpp.o"
+  "CMakeFiles/test_reshape_oom.dir/test_reshape_oom.cpp.o.d"
+  "test_reshape_oom"
+  "test_reshape_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_reshape_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
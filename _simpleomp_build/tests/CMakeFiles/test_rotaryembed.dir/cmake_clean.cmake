@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_rotaryembed.dir/test_rotaryembed.cpp.o"
+  "CMakeFiles/test_rotaryembed.dir/test_rotaryembed.cpp.o.d"
+  "test_rotaryembed"
+  "test_rotaryembed.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_rotaryembed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_rotaryembed_oom.dir/test_rotaryembed_oom.cpp.o"
+  "CMakeFiles/test_rotaryembed_oom.dir/test_rotaryembed_oom.cpp.o.d"
+  "test_rotaryembed_oom"
+  "test_rotaryembed_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_rotaryembed_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
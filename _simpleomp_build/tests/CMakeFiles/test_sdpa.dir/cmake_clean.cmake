@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sdpa.dir/test_sdpa.cpp.o"
+  "CMakeFiles/test_sdpa.dir/test_sdpa.cpp.o.d"
+  "test_sdpa"
+  "test_sdpa.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sdpa.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sdpa_kvcache.dir/test_sdpa_kvcache.cpp.o"
+  "CMakeFiles/test_sdpa_kvcache.dir/test_sdpa_kvcache.cpp.o.d"
+  "test_sdpa_kvcache"
+  "test_sdpa_kvcache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sdpa_kvcache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sdpa_kvcache_session.dir/test_sdpa_kvcache_session.cpp.o"
+  "CMakeFiles/test_sdpa_kvcache_session.dir/test_sdpa_kvcache_session.cpp.o.d"
+  "test_sdpa_kvcache_session"
+  "test_sdpa_kvcache_session.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sdpa_kvcache_session.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
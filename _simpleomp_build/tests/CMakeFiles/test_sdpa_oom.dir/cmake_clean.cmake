@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sdpa_oom.dir/test_sdpa_oom.cpp.o"
+  "CMakeFiles/test_sdpa_oom.dir/test_sdpa_oom.cpp.o.d"
+  "test_sdpa_oom"
+  "test_sdpa_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sdpa_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_selu.dir/test_selu.cpp.o"
+  "CMakeFiles/test_selu.dir/test_selu.cpp.o.d"
+  "test_selu"
+  "test_selu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_selu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sigmoid.dir/test_sigmoid.cpp.o"
+  "CMakeFiles/test_sigmoid.dir/test_sigmoid.cpp.o.d"
+  "test_sigmoid"
+  "test_sigmoid.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sigmoid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_statisticspooling.dir/test_statisticspooling.cpp.o"
+  "CMakeFiles/test_statisticspooling.dir/test_statisticspooling.cpp.o.d"
+  "test_statisticspooling"
+  "test_statisticspooling.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_statisticspooling.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
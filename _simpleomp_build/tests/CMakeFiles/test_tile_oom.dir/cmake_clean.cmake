@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_tile_oom.dir/test_tile_oom.cpp.o"
+  "CMakeFiles/test_tile_oom.dir/test_tile_oom.cpp.o.d"
+  "test_tile_oom"
+  "test_tile_oom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_tile_oom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_unfold.dir/test_unfold.cpp.o"
+  "CMakeFiles/test_unfold.dir/test_unfold.cpp.o.d"
+  "test_unfold"
+  "test_unfold.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unfold.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_weightcache.dir/test_weightcache.cpp.o"
+  "CMakeFiles/test_weightcache.dir/test_weightcache.cpp.o.d"
+  "test_weightcache"
+  "test_weightcache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_weightcache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncnnperfutil.dir/perfutil.cpp.o"
+  "CMakeFiles/ncnnperfutil.dir/perfutil.cpp.o.d"
+  "libncnnperfutil.a"
+  "libncnnperfutil.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ncnnperfutil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_batchnorm.dir/perf_batchnorm.cpp.o"
+  "CMakeFiles/perf_batchnorm.dir/perf_batchnorm.cpp.o.d"
+  "perf_batchnorm"
+  "perf_batchnorm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_batchnorm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
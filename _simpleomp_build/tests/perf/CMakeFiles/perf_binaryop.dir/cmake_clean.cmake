@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_binaryop.dir/perf_binaryop.cpp.o"
+  "CMakeFiles/perf_binaryop.dir/perf_binaryop.cpp.o.d"
+  "perf_binaryop"
+  "perf_binaryop.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_binaryop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
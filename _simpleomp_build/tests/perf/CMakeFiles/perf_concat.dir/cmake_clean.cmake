@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_concat.dir/perf_concat.cpp.o"
+  "CMakeFiles/perf_concat.dir/perf_concat.cpp.o.d"
+  "perf_concat"
+  "perf_concat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_concat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_convolution.dir/perf_convolution.cpp.o"
+  "CMakeFiles/perf_convolution.dir/perf_convolution.cpp.o.d"
+  "perf_convolution"
+  "perf_convolution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_convolution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
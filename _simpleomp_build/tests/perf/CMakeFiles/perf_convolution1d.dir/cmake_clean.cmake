@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_convolution1d.dir/perf_convolution1d.cpp.o"
+  "CMakeFiles/perf_convolution1d.dir/perf_convolution1d.cpp.o.d"
+  "perf_convolution1d"
+  "perf_convolution1d.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_convolution1d.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
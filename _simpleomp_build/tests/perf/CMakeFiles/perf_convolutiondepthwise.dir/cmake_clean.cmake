@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_convolutiondepthwise.dir/perf_convolutiondepthwise.cpp.o"
+  "CMakeFiles/perf_convolutiondepthwise.dir/perf_convolutiondepthwise.cpp.o.d"
+  "perf_convolutiondepthwise"
+  "perf_convolutiondepthwise.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_convolutiondepthwise.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
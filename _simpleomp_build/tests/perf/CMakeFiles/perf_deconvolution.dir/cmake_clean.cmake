@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_deconvolution.dir/perf_deconvolution.cpp.o"
+  "CMakeFiles/perf_deconvolution.dir/perf_deconvolution.cpp.o.d"
+  "perf_deconvolution"
+  "perf_deconvolution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_deconvolution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
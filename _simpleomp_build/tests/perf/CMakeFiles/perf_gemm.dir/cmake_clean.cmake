@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_gemm.dir/perf_gemm.cpp.o"
+  "CMakeFiles/perf_gemm.dir/perf_gemm.cpp.o.d"
+  "perf_gemm"
+  "perf_gemm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_gemm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_gru.dir/perf_gru.cpp.o"
+  "CMakeFiles/perf_gru.dir/perf_gru.cpp.o.d"
+  "perf_gru"
+  "perf_gru.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_gru.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_innerproduct.dir/perf_innerproduct.cpp.o"
+  "CMakeFiles/perf_innerproduct.dir/perf_innerproduct.cpp.o.d"
+  "perf_innerproduct"
+  "perf_innerproduct.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_innerproduct.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
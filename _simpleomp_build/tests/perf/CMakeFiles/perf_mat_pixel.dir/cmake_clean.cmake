@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_mat_pixel.dir/perf_mat_pixel.cpp.o"
+  "CMakeFiles/perf_mat_pixel.dir/perf_mat_pixel.cpp.o.d"
+  "perf_mat_pixel"
+  "perf_mat_pixel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_mat_pixel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_pooling.dir/perf_pooling.cpp.o"
+  "CMakeFiles/perf_pooling.dir/perf_pooling.cpp.o.d"
+  "perf_pooling"
+  "perf_pooling.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_pooling.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
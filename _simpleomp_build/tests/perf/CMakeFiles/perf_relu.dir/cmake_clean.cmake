@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_relu.dir/perf_relu.cpp.o"
+  "CMakeFiles/perf_relu.dir/perf_relu.cpp.o.d"
+  "perf_relu"
+  "perf_relu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_relu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
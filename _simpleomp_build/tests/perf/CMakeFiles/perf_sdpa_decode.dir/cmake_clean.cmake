@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_sdpa_decode.dir/perf_sdpa_decode.cpp.o"
+  "CMakeFiles/perf_sdpa_decode.dir/perf_sdpa_decode.cpp.o.d"
+  "perf_sdpa_decode"
+  "perf_sdpa_decode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_sdpa_decode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_sdpa_kvcache.dir/perf_sdpa_kvcache.cpp.o"
+  "CMakeFiles/perf_sdpa_kvcache.dir/perf_sdpa_kvcache.cpp.o.d"
+  "perf_sdpa_kvcache"
+  "perf_sdpa_kvcache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_sdpa_kvcache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_sdpa_prefill.dir/perf_sdpa_prefill.cpp.o"
+  "CMakeFiles/perf_sdpa_prefill.dir/perf_sdpa_prefill.cpp.o.d"
+  "perf_sdpa_prefill"
+  "perf_sdpa_prefill.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_sdpa_prefill.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
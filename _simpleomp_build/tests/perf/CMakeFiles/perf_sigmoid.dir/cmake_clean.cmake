@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_sigmoid.dir/perf_sigmoid.cpp.o"
+  "CMakeFiles/perf_sigmoid.dir/perf_sigmoid.cpp.o.d"
+  "perf_sigmoid"
+  "perf_sigmoid.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_sigmoid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
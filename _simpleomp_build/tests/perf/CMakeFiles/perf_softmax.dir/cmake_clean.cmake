@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_softmax.dir/perf_softmax.cpp.o"
+  "CMakeFiles/perf_softmax.dir/perf_softmax.cpp.o.d"
+  "perf_softmax"
+  "perf_softmax.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_softmax.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
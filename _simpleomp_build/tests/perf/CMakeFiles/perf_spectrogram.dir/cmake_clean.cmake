@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/perf_spectrogram.dir/perf_spectrogram.cpp.o"
+  "CMakeFiles/perf_spectrogram.dir/perf_spectrogram.cpp.o.d"
+  "perf_spectrogram"
+  "perf_spectrogram.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/perf_spectrogram.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -9,11 +9,13 @@
 #include <emscripten.h>
 #endif
 
+#include "autotunecache.h"
 #include "benchmark.h"
 #include "cpu.h"
 #include "datareader.h"
 #include "net.h"
 #include "gpu.h"
+#include "weightcache.h"
 
 #include "benchncnn_param_data.h"
 
@@ -38,20 +40,184 @@ public:
 static int g_warmup_loop_count = 8;
 static int g_loop_count = 4;
 static bool g_enable_cooling_down = true;
+static bool g_startup_mode = false;
+static std::vector<int> g_batch_sizes;
 
 static ncnn::UnlockedPoolAllocator g_blob_pool_allocator;
 static ncnn::PoolAllocator g_workspace_pool_allocator;
 
+// concurrent branches allocate blobs from several threads
+static ncnn::PoolAllocator g_blob_locked_pool_allocator;
+
+// blobs planned into one arena per input shape
+static bool g_use_blob_arena = false;
+static ncnn::BlobArenaAllocator g_blob_arena_allocator;
+
+static ncnn::AutotuneCache g_autotune_cache;
+static ncnn::WeightCache g_weight_cache;
+
 #if NCNN_VULKAN
 static ncnn::VulkanDevice* g_vkdev = 0;
 static ncnn::VkAllocator* g_blob_vkallocator = 0;
 static ncnn::VkAllocator* g_staging_vkallocator = 0;
 #endif // NCNN_VULKAN
 
+static void benchmark_net(const ncnn::Net& net, const std::vector<ncnn::Mat>& _in, double& time_min, double& time_max, double& time_avg)
+{
+    const std::vector<const char*>& input_names = net.input_names();
+    const std::vector<const char*>& output_names = net.output_names();
+
+    // warm up
+    for (int i = 0; i < g_warmup_loop_count; i++)
+    {
+        ncnn::Extractor ex = net.create_extractor();
+        if (g_use_blob_arena)
+            ex.set_blob_arena_allocator(&g_blob_arena_allocator);
+
+        for (size_t j = 0; j < input_names.size(); ++j)
+        {
+            ncnn::Mat in = _in[j];
+            ex.input(input_names[j], in);
+        }
+
+        for (size_t j = 0; j < output_names.size(); ++j)
+        {
+            ncnn::Mat out;
+            ex.extract(output_names[j], out);
+        }
+    }
+
+    time_min = DBL_MAX;
+    time_max = -DBL_MAX;
+    time_avg = 0;
+
+    for (int i = 0; i < g_loop_count; i++)
+    {
+        double start = ncnn::get_current_time();
+        {
+            ncnn::Extractor ex = net.create_extractor();
+            if (g_use_blob_arena)
+                ex.set_blob_arena_allocator(&g_blob_arena_allocator);
+
+            for (size_t j = 0; j < input_names.size(); ++j)
+            {
+                ncnn::Mat in = _in[j];
+                ex.input(input_names[j], in);
+            }
+
+            for (size_t j = 0; j < output_names.size(); ++j)
+            {
+                ncnn::Mat out;
+                ex.extract(output_names[j], out);
+            }
+        }
+
+        double end = ncnn::get_current_time();
+
+        double time = end - start;
+
+        time_min = std::min(time_min, time);
+        time_max = std::max(time_max, time);
+        time_avg += time;
+    }
+
+    time_avg /= g_loop_count;
+}
+
+static void benchmark_startup(const char* comment, const std::vector<ncnn::Mat>& _in, const ncnn::Option& opt, const char* model_param_data)
+{
+    // cold start latency, load_param + load_model and the first inference on a fresh net
+    double load_min = DBL_MAX;
+    double load_max = -DBL_MAX;
+    double load_avg = 0;
+    double first_avg = 0;
+
+    for (int i = 0; i < g_loop_count; i++)
+    {
+        g_blob_pool_allocator.clear();
+        g_workspace_pool_allocator.clear();
+        g_blob_locked_pool_allocator.clear();
+
+        double start = ncnn::get_current_time();
+
+        ncnn::Net net;
+
+        net.opt = opt;
+
+#if NCNN_VULKAN
+        if (net.opt.use_vulkan_compute)
+        {
+            net.set_vulkan_device(g_vkdev);
+        }
+#endif // NCNN_VULKAN
+
+        if (model_param_data)
+        {
+            net.load_param_mem(model_param_data);
+        }
+        else
+        {
+            net.load_param(comment);
+        }
+
+        DataReaderFromEmpty dr;
+        net.load_model(dr);
+
+        double loaded = ncnn::get_current_time();
+
+        const std::vector<const char*>& input_names = net.input_names();
+        const std::vector<const char*>& output_names = net.output_names();
+
+        if (input_names.size() > _in.size())
+        {
+            fprintf(stderr, "input %zu tensors while model has %zu inputs\n", _in.size(), input_names.size());
+            return;
+        }
+
+        {
+            ncnn::Extractor ex = net.create_extractor();
+            for (size_t j = 0; j < input_names.size(); ++j)
+            {
+                ncnn::Mat in = _in[j];
+                in.fill(0.01f);
+                ex.input(input_names[j], in);
+            }
+
+            for (size_t j = 0; j < output_names.size(); ++j)
+            {
+                ncnn::Mat out;
+                ex.extract(output_names[j], out);
+            }
+        }
+
+        double end = ncnn::get_current_time();
+
+        double time = loaded - start;
+
+        load_min = std::min(load_min, time);
+        load_max = std::max(load_max, time);
+        load_avg += time;
+        first_avg += end - loaded;
+    }
+
+    load_avg /= g_loop_count;
+    first_avg /= g_loop_count;
+
+    fprintf(stderr, "%20s  load min = %7.2f  max = %7.2f  avg = %7.2f  first = %7.2f\n", comment, load_min, load_max, load_avg, first_avg);
+}
+
 void benchmark(const char* comment, const std::vector<ncnn::Mat>& _in, const ncnn::Option& opt, const char* model_param_data = NULL)
 {
+    if (g_startup_mode)
+    {
+        benchmark_startup(comment, _in, opt, model_param_data);
+        return;
+    }
+
     g_blob_pool_allocator.clear();
     g_workspace_pool_allocator.clear();
+    g_blob_locked_pool_allocator.clear();
+    g_blob_arena_allocator.clear();
 
 #if NCNN_VULKAN
     if (opt.use_vulkan_compute)
@@ -85,7 +251,6 @@ void benchmark(const char* comment, const std::vector<ncnn::Mat>& _in, const ncn
     net.load_model(dr);
 
     const std::vector<const char*>& input_names = net.input_names();
-    const std::vector<const char*>& output_names = net.output_names();
 
     if (g_enable_cooling_down)
     {
@@ -106,56 +271,44 @@ void benchmark(const char* comment, const std::vector<ncnn::Mat>& _in, const ncn
         in.fill(0.01f);
     }
 
-    // warm up
-    for (int i = 0; i < g_warmup_loop_count; i++)
+#if NCNN_BATCH
+    if (!g_batch_sizes.empty())
     {
-        ncnn::Extractor ex = net.create_extractor();
-        for (size_t j = 0; j < input_names.size(); ++j)
+        // batch scaling, report per-batch latency and per-sample cost
+        for (size_t k = 0; k < g_batch_sizes.size(); k++)
         {
-            ncnn::Mat in = _in[j];
-            ex.input(input_names[j], in);
-        }
+            const int batch = g_batch_sizes[k];
 
-        for (size_t j = 0; j < output_names.size(); ++j)
-        {
-            ncnn::Mat out;
-            ex.extract(output_names[j], out);
-        }
-    }
-
-    double time_min = DBL_MAX;
-    double time_max = -DBL_MAX;
-    double time_avg = 0;
-
-    for (int i = 0; i < g_loop_count; i++)
-    {
-        double start = ncnn::get_current_time();
-        {
-            ncnn::Extractor ex = net.create_extractor();
+            std::vector<ncnn::Mat> in(input_names.size());
             for (size_t j = 0; j < input_names.size(); ++j)
             {
-                ncnn::Mat in = _in[j];
-                ex.input(input_names[j], in);
+                in[j].create_like(_in[j], batch);
+                in[j].fill(0.01f);
             }
 
-            for (size_t j = 0; j < output_names.size(); ++j)
-            {
-                ncnn::Mat out;
-                ex.extract(output_names[j], out);
-            }
+            double time_min;
+            double time_max;
+            double time_avg;
+            benchmark_net(net, in, time_min, time_max, time_avg);
+
+            fprintf(stderr, "%20s  batch = %3d  min = %7.2f  max = %7.2f  avg = %7.2f  avg/sample = %7.2f\n", comment, batch, time_min, time_max, time_avg, time_avg / batch);
         }
 
-        double end = ncnn::get_current_time();
+        return;
+    }
+#endif // NCNN_BATCH
 
-        double time = end - start;
+    double time_min;
+    double time_max;
+    double time_avg;
+    benchmark_net(net, _in, time_min, time_max, time_avg);
 
-        time_min = std::min(time_min, time);
-        time_max = std::max(time_max, time);
-        time_avg += time;
+    if (g_use_blob_arena)
+    {
+        fprintf(stderr, "%20s  min = %7.2f  max = %7.2f  avg = %7.2f  arena = %7.2f MB\n", comment, time_min, time_max, time_avg, g_blob_arena_allocator.arena_size() / 1024.0 / 1024.0);
+        return;
     }
 
-    time_avg /= g_loop_count;
-
     fprintf(stderr, "%20s  min = %7.2f  max = %7.2f  avg = %7.2f\n", comment, time_min, time_max, time_avg);
 }
 
@@ -171,6 +324,16 @@ void show_usage()
     fprintf(stderr, "Usage: benchncnn [loop count] [num threads] [powersave] [gpu device] [cooling down] [(key=value)...]\n");
     fprintf(stderr, "  param=model.param\n");
     fprintf(stderr, "  shape=[227,227,3],...\n");
+#if NCNN_BATCH
+    fprintf(stderr, "  batch=1,2,4,8\n");
+#endif
+    fprintf(stderr, "  branch=0/1\n");
+    fprintf(stderr, "  pipeline=0/1\n");
+    fprintf(stderr, "  startup=0/1\n");
+    fprintf(stderr, "  autotune=autotune.cache\n");
+    fprintf(stderr, "  weightcache=weight.cache\n");
+    fprintf(stderr, "  numa=-1/0/1/...\n");
+    fprintf(stderr, "  arena=0/1\n");
 }
 
 static std::vector<ncnn::Mat> parse_shape_list(char* s)
@@ -235,6 +398,25 @@ static std::vector<ncnn::Mat> parse_shape_list(char* s)
     return mats;
 }
 
+#if NCNN_BATCH
+static std::vector<int> parse_batch_list(char* s)
+{
+    std::vector<int> batch_sizes;
+
+    char* pch = strtok(s, ",");
+    while (pch != NULL)
+    {
+        int batch = atoi(pch);
+        if (batch > 0)
+            batch_sizes.push_back(batch);
+
+        pch = strtok(NULL, ",");
+    }
+
+    return batch_sizes;
+}
+#endif // NCNN_BATCH
+
 int main(int argc, char** argv)
 {
     int loop_count = 4;
@@ -242,6 +424,11 @@ int main(int argc, char** argv)
     int powersave = 2;
     int gpu_device = -1;
     int cooling_down = 1;
+    int parallel_branch = 0;
+    int parallel_create_pipeline = 0;
+    const char* autotune_cache_path = 0;
+    const char* weight_cache_path = 0;
+    int numa_node = -1;
     char* model = 0;
     std::vector<ncnn::Mat> inputs;
 
@@ -302,6 +489,24 @@ int main(int argc, char** argv)
             model = value;
         if (strcmp(key, "shape") == 0)
             inputs = parse_shape_list(value);
+#if NCNN_BATCH
+        if (strcmp(key, "batch") == 0)
+            g_batch_sizes = parse_batch_list(value);
+#endif
+        if (strcmp(key, "branch") == 0)
+            parallel_branch = atoi(value);
+        if (strcmp(key, "pipeline") == 0)
+            parallel_create_pipeline = atoi(value);
+        if (strcmp(key, "startup") == 0)
+            g_startup_mode = atoi(value) != 0;
+        if (strcmp(key, "autotune") == 0)
+            autotune_cache_path = value;
+        if (strcmp(key, "weightcache") == 0)
+            weight_cache_path = value;
+        if (strcmp(key, "numa") == 0)
+            numa_node = atoi(value);
+        if (strcmp(key, "arena") == 0)
+            g_use_blob_arena = atoi(value) != 0;
     }
 
     if (model && inputs.empty())
@@ -324,6 +529,7 @@ int main(int argc, char** argv)
 
     g_blob_pool_allocator.set_size_compare_ratio(0.f);
     g_workspace_pool_allocator.set_size_compare_ratio(0.f);
+    g_blob_locked_pool_allocator.set_size_compare_ratio(0.f);
 
 #if NCNN_VULKAN
     if (use_vulkan_compute)
@@ -363,12 +569,38 @@ int main(int argc, char** argv)
     opt.use_int8_storage = true;
     opt.use_int8_arithmetic = true;
     opt.use_packing_layout = true;
+    opt.use_parallel_branch = parallel_branch != 0;
+    opt.use_parallel_create_pipeline = parallel_create_pipeline != 0;
+    opt.numa_node = numa_node;
+    if (opt.use_parallel_branch)
+    {
+        opt.blob_allocator = &g_blob_locked_pool_allocator;
+    }
+    if (autotune_cache_path)
+    {
+        // a missing file starts an empty cache
+        g_autotune_cache.load_cache(autotune_cache_path);
+        opt.autotune_cache = &g_autotune_cache;
+    }
+    if (weight_cache_path)
+    {
+        // a missing file starts an empty cache
+        g_weight_cache.load_cache(weight_cache_path);
+        opt.weight_cache = &g_weight_cache;
+    }
 
     fprintf(stderr, "loop_count = %d\n", g_loop_count);
     fprintf(stderr, "num_threads = %d\n", num_threads);
     fprintf(stderr, "powersave = %d\n", ncnn::get_cpu_powersave());
     fprintf(stderr, "gpu_device = %d\n", gpu_device);
     fprintf(stderr, "cooling_down = %d\n", (int)g_enable_cooling_down);
+    fprintf(stderr, "parallel_branch = %d\n", (int)opt.use_parallel_branch);
+    fprintf(stderr, "parallel_create_pipeline = %d\n", (int)opt.use_parallel_create_pipeline);
+    fprintf(stderr, "startup = %d\n", (int)g_startup_mode);
+    fprintf(stderr, "autotune = %s\n", autotune_cache_path ? autotune_cache_path : "off");
+    fprintf(stderr, "weightcache = %s\n", weight_cache_path ? weight_cache_path : "off");
+    fprintf(stderr, "numa_node = %d / %d\n", opt.numa_node, ncnn::get_numa_node_count());
+    fprintf(stderr, "arena = %d\n", (int)g_use_blob_arena);
 
     if (model != 0)
     {
@@ -450,6 +682,17 @@ int main(int argc, char** argv)
 
         benchmark("FastestDet", ncnn::Mat(352, 352, 3), opt, FastestDet_param_data);
     }
+
+    if (autotune_cache_path)
+    {
+        g_autotune_cache.save_cache(autotune_cache_path);
+    }
+
+    if (weight_cache_path && g_weight_cache.modified())
+    {
+        g_weight_cache.save_cache(weight_cache_path);
+    }
+
 #if NCNN_VULKAN
     delete g_blob_vkallocator;
     delete g_staging_vkallocator;
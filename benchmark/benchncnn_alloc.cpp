@@ -0,0 +1,388 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "allocator.h"
+#include "benchmark.h"
+#include "cpu.h"
+#include "datareader.h"
+#include "net.h"
+
+#include "benchncnn_param_data.h"
+
+#ifndef NCNN_SIMPLESTL
+#include <vector>
+#endif
+
+class DataReaderFromEmpty : public ncnn::DataReader
+{
+public:
+    virtual int scan(const char* format, void* p) const
+    {
+        return 0;
+    }
+    virtual size_t read(void* buf, size_t size) const
+    {
+        memset(buf, 0, size);
+        return size;
+    }
+};
+
+static double g_duration = 5.0;
+static int g_num_workers = 4;
+static int g_num_threads = 1;
+static bool g_use_hugepage = false;
+
+// 0 = shared PoolAllocator for blob and workspace
+// 1 = UnlockedPoolAllocator per worker for blob, shared PoolAllocator for workspace
+// 2 = shared ThreadCachePoolAllocator for blob and workspace
+static const char* g_mode_names[] = {"pool", "unlocked", "threadcache"};
+
+struct WorkerArgs
+{
+    const ncnn::Net* net;
+    const std::vector<ncnn::Mat>* inputs;
+    ncnn::Allocator* blob_allocator;
+    ncnn::Allocator* workspace_allocator;
+    double end_time;
+    int count;
+};
+
+static void* extract_entry(void* args)
+{
+    WorkerArgs* wa = (WorkerArgs*)args;
+
+    const std::vector<const char*>& input_names = wa->net->input_names();
+    const std::vector<const char*>& output_names = wa->net->output_names();
+
+    while (ncnn::get_current_time() < wa->end_time)
+    {
+        ncnn::Extractor ex = wa->net->create_extractor();
+        ex.set_blob_allocator(wa->blob_allocator);
+        ex.set_workspace_allocator(wa->workspace_allocator);
+
+        for (size_t j = 0; j < input_names.size(); ++j)
+        {
+            ex.input(input_names[j], (*wa->inputs)[j]);
+        }
+
+        for (size_t j = 0; j < output_names.size(); ++j)
+        {
+            ncnn::Mat out;
+            ex.extract(output_names[j], out);
+        }
+
+        wa->count++;
+    }
+
+    return 0;
+}
+
+// layer-like pattern, a few live blobs and short-lived workspaces of mixed sizes
+static void* malloc_entry(void* args)
+{
+    WorkerArgs* wa = (WorkerArgs*)args;
+
+    ncnn::Allocator* allocator = wa->workspace_allocator;
+
+    static const size_t sizes[] = {256, 4096, 50176, 200704, 802816, 3211264, 1000, 12544};
+    const int size_count = sizeof(sizes) / sizeof(sizes[0]);
+
+    void* live[4] = {0, 0, 0, 0};
+
+    unsigned int seed = 7767517;
+    while (ncnn::get_current_time() < wa->end_time)
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            seed = seed * 1103515245 + 12345;
+            const size_t size = sizes[(seed >> 16) % size_count];
+
+            void* workspace = allocator->fastMalloc(size);
+            ((unsigned char*)workspace)[0] = 1;
+
+            const int b = (seed >> 8) & 3;
+            wa->blob_allocator->fastFree(live[b]);
+            live[b] = wa->blob_allocator->fastMalloc(size);
+
+            allocator->fastFree(workspace);
+        }
+
+        wa->count += 1000;
+    }
+
+    for (int b = 0; b < 4; b++)
+    {
+        wa->blob_allocator->fastFree(live[b]);
+    }
+
+    return 0;
+}
+
+static double run_workers(void* (*entry)(void*), int mode, const ncnn::Net* net, const std::vector<ncnn::Mat>* inputs)
+{
+    ncnn::PoolAllocator pool_allocator;
+    ncnn::ThreadCachePoolAllocator threadcache_allocator;
+    std::vector<ncnn::UnlockedPoolAllocator*> unlocked_allocators(g_num_workers);
+
+    pool_allocator.set_size_compare_ratio(0.f);
+    threadcache_allocator.set_use_hugepage(g_use_hugepage);
+
+    std::vector<WorkerArgs> args(g_num_workers);
+    for (int i = 0; i < g_num_workers; i++)
+    {
+        unlocked_allocators[i] = new ncnn::UnlockedPoolAllocator;
+        unlocked_allocators[i]->set_size_compare_ratio(0.f);
+
+        args[i].net = net;
+        args[i].inputs = inputs;
+        args[i].blob_allocator = mode == 0 ? (ncnn::Allocator*)&pool_allocator : mode == 1 ? (ncnn::Allocator*)unlocked_allocators[i] : (ncnn::Allocator*)&threadcache_allocator;
+        args[i].workspace_allocator = mode == 2 ? (ncnn::Allocator*)&threadcache_allocator : (ncnn::Allocator*)&pool_allocator;
+        args[i].count = 0;
+    }
+
+    // warm up the pools
+    for (int i = 0; i < g_num_workers; i++)
+    {
+        args[i].end_time = ncnn::get_current_time() + 200;
+    }
+    {
+        std::vector<ncnn::Thread*> workers(g_num_workers);
+        for (int i = 0; i < g_num_workers; i++)
+            workers[i] = new ncnn::Thread(entry, &args[i]);
+        for (int i = 0; i < g_num_workers; i++)
+        {
+            workers[i]->join();
+            delete workers[i];
+        }
+    }
+
+    const double start = ncnn::get_current_time();
+    for (int i = 0; i < g_num_workers; i++)
+    {
+        args[i].end_time = start + g_duration * 1000;
+        args[i].count = 0;
+    }
+
+    std::vector<ncnn::Thread*> workers(g_num_workers);
+    for (int i = 0; i < g_num_workers; i++)
+        workers[i] = new ncnn::Thread(entry, &args[i]);
+
+    int count = 0;
+    for (int i = 0; i < g_num_workers; i++)
+    {
+        workers[i]->join();
+        delete workers[i];
+        count += args[i].count;
+    }
+
+    const double elapsed = ncnn::get_current_time() - start;
+
+    for (int i = 0; i < g_num_workers; i++)
+    {
+        delete unlocked_allocators[i];
+    }
+
+    return count * 1000.0 / elapsed;
+}
+
+void benchmark(const char* comment, const std::vector<ncnn::Mat>& inputs, const char* model_param_data = NULL)
+{
+    ncnn::Net net;
+    net.opt.use_vulkan_compute = false;
+    net.opt.num_threads = g_num_threads;
+
+    if (model_param_data)
+    {
+        net.load_param_mem(model_param_data);
+    }
+    else
+    {
+        net.load_param(comment);
+    }
+
+    DataReaderFromEmpty dr;
+    net.load_model(dr);
+
+    for (int mode = 0; mode < 3; mode++)
+    {
+        const double ips = run_workers(extract_entry, mode, &net, &inputs);
+
+        fprintf(stderr, "%20s  %-12s  ips = %8.2f  avg = %7.2f\n", comment, g_mode_names[mode], ips, g_num_workers * 1000.0 / ips);
+    }
+}
+
+void benchmark(const char* comment, const ncnn::Mat& _in, const char* model_param_data = NULL)
+{
+    std::vector<ncnn::Mat> inputs;
+    inputs.push_back(_in);
+    return benchmark(comment, inputs, model_param_data);
+}
+
+void show_usage()
+{
+    fprintf(stderr, "Usage: benchncnn_alloc [duration seconds] [num workers] [threads per worker] [(key=value)...]\n");
+    fprintf(stderr, "  param=model.param\n");
+    fprintf(stderr, "  shape=[227,227,3],...\n");
+    fprintf(stderr, "  hugepage=0/1\n");
+}
+
+static std::vector<ncnn::Mat> parse_shape_list(char* s)
+{
+    std::vector<std::vector<int> > shapes;
+    std::vector<ncnn::Mat> mats;
+
+    char* pch = strtok(s, "[]");
+    while (pch != NULL)
+    {
+        // parse a,b,c
+        int v;
+        int nconsumed = 0;
+        int nscan = sscanf(pch, "%d%n", &v, &nconsumed);
+        if (nscan == 1)
+        {
+            // ok we get shape
+            pch += nconsumed;
+
+            std::vector<int> s;
+            s.push_back(v);
+
+            nscan = sscanf(pch, ",%d%n", &v, &nconsumed);
+            while (nscan == 1)
+            {
+                pch += nconsumed;
+
+                s.push_back(v);
+
+                nscan = sscanf(pch, ",%d%n", &v, &nconsumed);
+            }
+
+            // shape end
+            shapes.push_back(s);
+        }
+
+        pch = strtok(NULL, "[]");
+    }
+
+    for (size_t i = 0; i < shapes.size(); ++i)
+    {
+        const std::vector<int>& shape = shapes[i];
+        switch (shape.size())
+        {
+        case 4:
+            mats.push_back(ncnn::Mat(shape[0], shape[1], shape[2], shape[3]));
+            break;
+        case 3:
+            mats.push_back(ncnn::Mat(shape[0], shape[1], shape[2]));
+            break;
+        case 2:
+            mats.push_back(ncnn::Mat(shape[0], shape[1]));
+            break;
+        case 1:
+            mats.push_back(ncnn::Mat(shape[0]));
+            break;
+        default:
+            fprintf(stderr, "unsupported input shape size %zu\n", shape.size());
+            break;
+        }
+    }
+    return mats;
+}
+
+int main(int argc, char** argv)
+{
+    char* model = 0;
+    std::vector<ncnn::Mat> inputs;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (argv[i][0] == '-' && argv[i][1] == 'h')
+        {
+            show_usage();
+            return -1;
+        }
+
+        if (strcmp(argv[i], "--help") == 0)
+        {
+            show_usage();
+            return -1;
+        }
+    }
+
+    if (argc >= 2)
+    {
+        g_duration = atof(argv[1]);
+    }
+    if (argc >= 3)
+    {
+        g_num_workers = atoi(argv[2]);
+    }
+    if (argc >= 4)
+    {
+        g_num_threads = atoi(argv[3]);
+    }
+
+    for (int i = 4; i < argc; i++)
+    {
+        // key=value
+        char* kv = argv[i];
+
+        char* eqs = strchr(kv, '=');
+        if (eqs == NULL)
+        {
+            fprintf(stderr, "unrecognized arg %s\n", kv);
+            continue;
+        }
+
+        // split k v
+        eqs[0] = '\0';
+        const char* key = kv;
+        char* value = eqs + 1;
+
+        if (strcmp(key, "param") == 0)
+            model = value;
+        if (strcmp(key, "shape") == 0)
+            inputs = parse_shape_list(value);
+        if (strcmp(key, "hugepage") == 0)
+            g_use_hugepage = atoi(value) != 0;
+    }
+
+    if (model && inputs.empty())
+    {
+        fprintf(stderr, "input tensor shape empty!\n");
+        return -1;
+    }
+
+    fprintf(stderr, "duration = %.1f s\n", g_duration);
+    fprintf(stderr, "num_workers = %d\n", g_num_workers);
+    fprintf(stderr, "num_threads = %d\n", g_num_threads);
+    fprintf(stderr, "hugepage = %d\n", (int)g_use_hugepage);
+
+    // allocator only, malloc and free pairs per second
+    for (int mode = 0; mode < 3; mode++)
+    {
+        const double ops = run_workers(malloc_entry, mode, 0, 0);
+
+        fprintf(stderr, "%20s  %-12s  ops = %8.2f k\n", "malloc", g_mode_names[mode], ops / 1000);
+    }
+
+    if (model != 0)
+    {
+        // run user defined benchmark
+        benchmark(model, inputs);
+    }
+    else
+    {
+        // run default cases
+        benchmark("squeezenet", ncnn::Mat(227, 227, 3), squeezenet_param_data);
+
+        benchmark("mobilenet_v2", ncnn::Mat(224, 224, 3), mobilenet_v2_param_data);
+
+        benchmark("resnet18", ncnn::Mat(224, 224, 3), resnet18_param_data);
+    }
+
+    return 0;
+}
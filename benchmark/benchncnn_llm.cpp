@@ -42,6 +42,7 @@ public:
 static int g_warmup_loop_count = 8;
 static int g_loop_count = 4;
 static bool g_enable_cooling_down = true;
+static int g_num_sessions = 1;
 
 static ncnn::UnlockedPoolAllocator g_blob_pool_allocator;
 static ncnn::PoolAllocator g_workspace_pool_allocator;
@@ -340,6 +341,18 @@ static int run_decoder_once(ncnn::Net& decoder, ncnn::Net& proj_out, const Cache
         return ret;
 
     ncnn::Mat last_hidden = hidden;
+#if NCNN_BATCH
+    if (cur_seqlen > 1 && hidden.n > 1)
+    {
+        // last token of every session
+        last_hidden.create(hidden.w, 1, hidden.elemsize, hidden.elempack, hidden.n);
+        for (int b = 0; b < hidden.n; b++)
+        {
+            memcpy(last_hidden.batch(b), hidden.batch(b).row(cur_seqlen - 1), hidden.w * hidden.elemsize);
+        }
+    }
+    else
+#endif // NCNN_BATCH
     if (cur_seqlen > 1)
     {
         last_hidden = hidden.row_range(cur_seqlen - 1, 1).clone();
@@ -535,6 +548,68 @@ static int benchmark_vulkan(ncnn::Net& decoder, ncnn::Net& proj_out, const Cache
 }
 #endif // NCNN_VULKAN
 
+#if NCNN_BATCH
+static ncnn::Mat make_batch(const ncnn::Mat& m, int batch)
+{
+    ncnn::Mat batch_m;
+    batch_m.create_like(m, batch);
+    for (int b = 0; b < batch; b++)
+    {
+        memcpy(batch_m.batch(b), m, m.total() * m.elemsize);
+    }
+    return batch_m;
+}
+
+static int benchmark_cpu_sessions(ncnn::Net& decoder, ncnn::Net& proj_out, const CacheIndexes& cache_indexes, const ncnn::Mat& prefill_embeddings, const ncnn::Mat& prefill_attention_mask, const ncnn::Mat& prefill_cos_cache, const ncnn::Mat& prefill_sin_cache, const ncnn::Mat& decode_embedding, const ncnn::Mat& decode_attention_mask, const ncnn::Mat& decode_cos_cache, const ncnn::Mat& decode_sin_cache, ncnn::Allocator* kvcache_allocator, int kvcache_max_seqlen_hint, int num_sessions, double& decode_tps)
+{
+    // all sessions decode one token each in a single batched forward
+    const ncnn::Mat prefill_embeddings_batch = make_batch(prefill_embeddings, num_sessions);
+    const ncnn::Mat prefill_attention_mask_batch = make_batch(prefill_attention_mask, num_sessions);
+    const ncnn::Mat prefill_cos_cache_batch = make_batch(prefill_cos_cache, num_sessions);
+    const ncnn::Mat prefill_sin_cache_batch = make_batch(prefill_sin_cache, num_sessions);
+    const ncnn::Mat decode_embedding_batch = make_batch(decode_embedding, num_sessions);
+    const ncnn::Mat decode_attention_mask_batch = make_batch(decode_attention_mask, num_sessions);
+    const ncnn::Mat decode_cos_cache_batch = make_batch(decode_cos_cache, num_sessions);
+    const ncnn::Mat decode_sin_cache_batch = make_batch(decode_sin_cache, num_sessions);
+
+    double time_min = DBL_MAX;
+
+    for (int i = 0; i < g_warmup_loop_count + g_loop_count; i++)
+    {
+        std::vector<ncnn::Mat> cache;
+
+        int ret = run_decoder_once(decoder, proj_out, cache_indexes, prefill_embeddings_batch, prefill_attention_mask_batch, prefill_cos_cache_batch, prefill_sin_cache_batch, cache, kvcache_allocator, kvcache_max_seqlen_hint);
+        if (ret != 0)
+        {
+            for (size_t j = 0; j < cache.size(); j++)
+                cache[j].release();
+            return ret;
+        }
+
+        double start = ncnn::get_current_time();
+        ret = run_decoder_once(decoder, proj_out, cache_indexes, decode_embedding_batch, decode_attention_mask_batch, decode_cos_cache_batch, decode_sin_cache_batch, cache, kvcache_allocator, kvcache_max_seqlen_hint);
+        double end = ncnn::get_current_time();
+
+        for (size_t j = 0; j < cache.size(); j++)
+            cache[j].release();
+
+        if (ret != 0)
+            return ret;
+
+        if (i >= g_warmup_loop_count)
+        {
+            const double time = end - start;
+            if (time < time_min)
+                time_min = time;
+        }
+    }
+
+    decode_tps = num_sessions * 1000.0 / time_min;
+
+    return 0;
+}
+#endif // NCNN_BATCH
+
 static int load_net(ncnn::Net& net, const char* param_data, int quantize_term, const ncnn::Option& opt)
 {
     net.opt = opt;
@@ -635,6 +710,22 @@ static int benchmark_model(const ModelConfig& config, const ncnn::Option& opt)
     if (ret != 0)
         return ret;
 
+#if NCNN_BATCH
+    if (g_num_sessions > 1 && !opt.use_vulkan_compute)
+    {
+        double sessions_decode_tps;
+        ncnn::UnlockedPoolAllocator kvcache_allocator;
+        kvcache_allocator.set_size_compare_ratio(0.f);
+        ret = benchmark_cpu_sessions(decoder, proj_out, cache_indexes, prefill_embeddings, prefill_attention_mask, prefill_cos_cache, prefill_sin_cache, decode_embedding, decode_attention_mask, decode_cos_cache, decode_sin_cache, &kvcache_allocator, prefill_len + 1, g_num_sessions, sessions_decode_tps);
+        if (ret != 0)
+            return ret;
+
+        fprintf(stderr, "%30s  %12.2f  %12.2f  %12.2f\n", config.name, prefill_tps, decode_tps, sessions_decode_tps);
+
+        return 0;
+    }
+#endif // NCNN_BATCH
+
     fprintf(stderr, "%30s  %12.2f  %12.2f\n", config.name, prefill_tps, decode_tps);
 
     return 0;
@@ -642,7 +733,7 @@ static int benchmark_model(const ModelConfig& config, const ncnn::Option& opt)
 
 static void show_usage()
 {
-    fprintf(stderr, "Usage: benchncnn_llm [loop count] [num threads] [powersave] [gpu device] [cooling down]\n");
+    fprintf(stderr, "Usage: benchncnn_llm [loop count] [num threads] [powersave] [gpu device] [cooling down] [sessions]\n");
 }
 
 int main(int argc, char** argv)
@@ -652,6 +743,7 @@ int main(int argc, char** argv)
     int powersave = 2;
     int gpu_device = -1;
     int cooling_down = 1;
+    int num_sessions = 1;
 
     for (int i = 1; i < argc; i++)
     {
@@ -688,11 +780,16 @@ int main(int argc, char** argv)
     {
         cooling_down = atoi(argv[5]);
     }
+    if (argc >= 7)
+    {
+        num_sessions = atoi(argv[6]);
+    }
 
     const bool use_vulkan_compute = gpu_device != -1;
 
     g_enable_cooling_down = cooling_down != 0;
     g_loop_count = loop_count;
+    g_num_sessions = num_sessions;
 
     g_blob_pool_allocator.set_size_compare_ratio(0.f);
     g_workspace_pool_allocator.set_size_compare_ratio(0.f);
@@ -742,7 +839,21 @@ int main(int argc, char** argv)
     fprintf(stderr, "powersave = %d\n", ncnn::get_cpu_powersave());
     fprintf(stderr, "gpu_device = %d\n", gpu_device);
     fprintf(stderr, "cooling_down = %d\n", (int)g_enable_cooling_down);
-    fprintf(stderr, "%30s  %12s  %12s\n", "model", "prefill tps", "decode tps");
+#if NCNN_BATCH
+    if (g_num_sessions > 1 && !use_vulkan_compute)
+    {
+        // aggregate decode tokens per second over all sessions
+        char sessions_header[32];
+        sprintf(sessions_header, "decode tps x%d", g_num_sessions);
+
+        fprintf(stderr, "sessions = %d\n", g_num_sessions);
+        fprintf(stderr, "%30s  %12s  %12s  %12s\n", "model", "prefill tps", "decode tps", sessions_header);
+    }
+    else
+#endif // NCNN_BATCH
+    {
+        fprintf(stderr, "%30s  %12s  %12s\n", "model", "prefill tps", "decode tps");
+    }
 
     const ModelConfig* models[] = {
         &hunyuan::model,
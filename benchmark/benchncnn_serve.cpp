@@ -0,0 +1,342 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "cpu.h"
+#include "datareader.h"
+#include "inferenceserver.h"
+#include "net.h"
+
+#include "benchncnn_param_data.h"
+
+#ifndef NCNN_SIMPLESTL
+#include <vector>
+#endif
+
+class DataReaderFromEmpty : public ncnn::DataReader
+{
+public:
+    virtual int scan(const char* format, void* p) const
+    {
+        return 0;
+    }
+    virtual size_t read(void* buf, size_t size) const
+    {
+        memset(buf, 0, size);
+        return size;
+    }
+};
+
+static double g_duration = 10.0;
+static int g_num_clients = 0;
+static double g_request_rate = 0.0;
+
+struct ClientArgs
+{
+    ncnn::InferenceServer* server;
+    const std::vector<ncnn::Mat>* inputs;
+    double end_time;
+};
+
+// closed loop, each client sends the next request once the previous one returns
+static void* client_entry(void* args)
+{
+    ClientArgs* ca = (ClientArgs*)args;
+
+    std::vector<ncnn::Mat> outputs;
+    while (ncnn::get_current_time() < ca->end_time)
+    {
+        if (ca->server->infer(*ca->inputs, outputs) != 0)
+            break;
+    }
+
+    return 0;
+}
+
+static void request_done(int /*ret*/, std::vector<ncnn::Mat>& /*outputs*/, void* /*userdata*/)
+{
+}
+
+// open loop, requests arrive at a fixed rate regardless of completions
+static void generate_requests(ncnn::InferenceServer& server, const std::vector<ncnn::Mat>& inputs, double end_time)
+{
+    const double interval = 1000.0 / g_request_rate;
+
+    double next_time = ncnn::get_current_time();
+    while (next_time < end_time)
+    {
+        double now = ncnn::get_current_time();
+        if (now < next_time)
+        {
+            if (next_time - now > 1.0)
+                ncnn::sleep((unsigned long long int)(next_time - now));
+            continue;
+        }
+
+        if (server.submit(inputs, request_done) != 0)
+            break;
+
+        next_time += interval;
+    }
+}
+
+void benchmark(const char* comment, const std::vector<ncnn::Mat>& inputs, const ncnn::ServerOption& sopt, const char* model_param_data = NULL)
+{
+    ncnn::InferenceServer server;
+
+    ncnn::Net& net = server.net();
+    net.opt.use_vulkan_compute = false;
+
+    if (model_param_data)
+    {
+        net.load_param_mem(model_param_data);
+    }
+    else
+    {
+        net.load_param(comment);
+    }
+
+    DataReaderFromEmpty dr;
+    net.load_model(dr);
+
+    if (server.start(sopt) != 0)
+    {
+        fprintf(stderr, "%20s  server start failed\n", comment);
+        return;
+    }
+
+    // warm up every lane
+    {
+        std::vector<ncnn::Mat> outputs;
+        for (int i = 0; i < sopt.num_lanes * 2; i++)
+        {
+            server.infer(inputs, outputs);
+        }
+    }
+
+    server.reset_stats();
+
+    const double end_time = ncnn::get_current_time() + g_duration * 1000;
+
+    if (g_request_rate > 0)
+    {
+        generate_requests(server, inputs, end_time);
+    }
+    else
+    {
+        const int num_clients = g_num_clients > 0 ? g_num_clients : sopt.num_lanes * sopt.max_batch_size;
+
+        std::vector<ClientArgs> args(num_clients);
+        std::vector<ncnn::Thread*> clients(num_clients);
+        for (int i = 0; i < num_clients; i++)
+        {
+            args[i].server = &server;
+            args[i].inputs = &inputs;
+            args[i].end_time = end_time;
+            clients[i] = new ncnn::Thread(client_entry, &args[i]);
+        }
+
+        for (int i = 0; i < num_clients; i++)
+        {
+            clients[i]->join();
+            delete clients[i];
+        }
+    }
+
+    // the queued requests still count
+    server.stop();
+
+    ncnn::ServerStats stats = server.stats();
+
+    fprintf(stderr, "%20s  qps = %8.2f  p50 = %7.2f  p99 = %7.2f  max = %7.2f  batch = %5.2f\n", comment, stats.throughput, stats.latency_p50, stats.latency_p99, stats.latency_max, stats.avg_batch_size);
+}
+
+void benchmark(const char* comment, const ncnn::Mat& _in, const ncnn::ServerOption& sopt, const char* model_param_data = NULL)
+{
+    std::vector<ncnn::Mat> inputs;
+    inputs.push_back(_in);
+    return benchmark(comment, inputs, sopt, model_param_data);
+}
+
+void show_usage()
+{
+    fprintf(stderr, "Usage: benchncnn_serve [duration seconds] [num threads] [num lanes] [max batch] [max delay us] [(key=value)...]\n");
+    fprintf(stderr, "  param=model.param\n");
+    fprintf(stderr, "  shape=[227,227,3],...\n");
+    fprintf(stderr, "  clients=16\n");
+    fprintf(stderr, "  rate=200\n");
+    fprintf(stderr, "  affinity=0/1\n");
+}
+
+static std::vector<ncnn::Mat> parse_shape_list(char* s)
+{
+    std::vector<std::vector<int> > shapes;
+    std::vector<ncnn::Mat> mats;
+
+    char* pch = strtok(s, "[]");
+    while (pch != NULL)
+    {
+        // parse a,b,c
+        int v;
+        int nconsumed = 0;
+        int nscan = sscanf(pch, "%d%n", &v, &nconsumed);
+        if (nscan == 1)
+        {
+            // ok we get shape
+            pch += nconsumed;
+
+            std::vector<int> s;
+            s.push_back(v);
+
+            nscan = sscanf(pch, ",%d%n", &v, &nconsumed);
+            while (nscan == 1)
+            {
+                pch += nconsumed;
+
+                s.push_back(v);
+
+                nscan = sscanf(pch, ",%d%n", &v, &nconsumed);
+            }
+
+            // shape end
+            shapes.push_back(s);
+        }
+
+        pch = strtok(NULL, "[]");
+    }
+
+    for (size_t i = 0; i < shapes.size(); ++i)
+    {
+        const std::vector<int>& shape = shapes[i];
+        switch (shape.size())
+        {
+        case 4:
+            mats.push_back(ncnn::Mat(shape[0], shape[1], shape[2], shape[3]));
+            break;
+        case 3:
+            mats.push_back(ncnn::Mat(shape[0], shape[1], shape[2]));
+            break;
+        case 2:
+            mats.push_back(ncnn::Mat(shape[0], shape[1]));
+            break;
+        case 1:
+            mats.push_back(ncnn::Mat(shape[0]));
+            break;
+        default:
+            fprintf(stderr, "unsupported input shape size %zu\n", shape.size());
+            break;
+        }
+    }
+    return mats;
+}
+
+int main(int argc, char** argv)
+{
+    ncnn::ServerOption sopt;
+    char* model = 0;
+    std::vector<ncnn::Mat> inputs;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (argv[i][0] == '-' && argv[i][1] == 'h')
+        {
+            show_usage();
+            return -1;
+        }
+
+        if (strcmp(argv[i], "--help") == 0)
+        {
+            show_usage();
+            return -1;
+        }
+    }
+
+    if (argc >= 2)
+    {
+        g_duration = atof(argv[1]);
+    }
+    if (argc >= 3)
+    {
+        sopt.num_threads = atoi(argv[2]);
+    }
+    if (argc >= 4)
+    {
+        sopt.num_lanes = atoi(argv[3]);
+    }
+    if (argc >= 5)
+    {
+        sopt.max_batch_size = atoi(argv[4]);
+    }
+    if (argc >= 6)
+    {
+        sopt.max_batch_delay_us = atoi(argv[5]);
+    }
+
+    for (int i = 6; i < argc; i++)
+    {
+        // key=value
+        char* kv = argv[i];
+
+        char* eqs = strchr(kv, '=');
+        if (eqs == NULL)
+        {
+            fprintf(stderr, "unrecognized arg %s\n", kv);
+            continue;
+        }
+
+        // split k v
+        eqs[0] = '\0';
+        const char* key = kv;
+        char* value = eqs + 1;
+
+        if (strcmp(key, "param") == 0)
+            model = value;
+        if (strcmp(key, "shape") == 0)
+            inputs = parse_shape_list(value);
+        if (strcmp(key, "clients") == 0)
+            g_num_clients = atoi(value);
+        if (strcmp(key, "rate") == 0)
+            g_request_rate = atof(value);
+        if (strcmp(key, "affinity") == 0)
+            sopt.use_lane_affinity = atoi(value) != 0;
+    }
+
+    if (model && inputs.empty())
+    {
+        fprintf(stderr, "input tensor shape empty!\n");
+        return -1;
+    }
+
+    fprintf(stderr, "duration = %.1f s\n", g_duration);
+    fprintf(stderr, "num_threads = %d\n", sopt.num_threads);
+    fprintf(stderr, "num_lanes = %d\n", sopt.num_lanes);
+    fprintf(stderr, "max_batch_size = %d\n", sopt.max_batch_size);
+    fprintf(stderr, "max_batch_delay = %d us\n", sopt.max_batch_delay_us);
+    fprintf(stderr, "lane_affinity = %d\n", sopt.use_lane_affinity);
+    if (g_request_rate > 0)
+        fprintf(stderr, "rate = %.1f req/s\n", g_request_rate);
+    else
+        fprintf(stderr, "clients = %d\n", g_num_clients > 0 ? g_num_clients : sopt.num_lanes * sopt.max_batch_size);
+    fprintf(stderr, "latency in ms\n");
+
+    if (model != 0)
+    {
+        // run user defined benchmark
+        benchmark(model, inputs, sopt);
+    }
+    else
+    {
+        // run default cases
+        benchmark("squeezenet", ncnn::Mat(227, 227, 3), sopt, squeezenet_param_data);
+
+        benchmark("mobilenet_v2", ncnn::Mat(224, 224, 3), sopt, mobilenet_v2_param_data);
+
+        benchmark("resnet18", ncnn::Mat(224, 224, 3), sopt, resnet18_param_data);
+    }
+
+    return 0;
+}
@@ -6,6 +6,8 @@
 #include "gpu.h"
 #include "pipeline.h"
 
+#include <string.h>
+
 #if __ANDROID_API__ >= 26
 #include <android/hardware_buffer.h>
 #endif // __ANDROID_API__ >= 26
@@ -346,6 +348,1098 @@ void UnlockedPoolAllocator::fastFree(void* ptr)
     ncnn::fastFree(ptr);
 }
 
+// 4 size classes per power of two, from 64 bytes up to 1G
+#define TCACHE_MIN_SHIFT    6
+#define TCACHE_MAX_SHIFT    30
+#define TCACHE_CLASS_COUNT  ((TCACHE_MAX_SHIFT - TCACHE_MIN_SHIFT) * 4 + 1)
+#define TCACHE_DEPTH        8
+#define TCACHE_HUGEPAGE_SIZE (2 * 1024 * 1024)
+
+static NCNN_FORCEINLINE int tcache_highest_bit(size_t v)
+{
+#if defined(__GNUC__)
+    return (int)(sizeof(unsigned long long) * 8 - 1) - __builtin_clzll((unsigned long long)v);
+#else
+    int p = 0;
+    while (v >>= 1)
+        p++;
+    return p;
+#endif
+}
+
+// -1 for sizes too large to pool
+static NCNN_FORCEINLINE int tcache_size_class(size_t size)
+{
+    if (size <= ((size_t)1 << TCACHE_MIN_SHIFT))
+        return 0;
+
+    const size_t s = size - 1;
+    const int p = tcache_highest_bit(s);
+    if (p >= TCACHE_MAX_SHIFT)
+        return -1;
+
+    return (p - TCACHE_MIN_SHIFT) * 4 + (int)((s >> (p - 2)) & 3) + 1;
+}
+
+static NCNN_FORCEINLINE size_t tcache_class_size(int size_class)
+{
+    if (size_class == 0)
+        return (size_t)1 << TCACHE_MIN_SHIFT;
+
+    const int p = (size_class - 1) / 4 + TCACHE_MIN_SHIFT;
+    const int sub = (size_class - 1) % 4;
+    return (size_t)(5 + sub) << (p - 2);
+}
+
+// every chunk of the thread cache pool allocator is prefixed with this header
+struct tcache_chunk_header
+{
+    size_t size;
+    size_t map_size; // 0 = heap
+    int size_class;  // -1 = not pooled
+};
+
+#define TCACHE_HEADER_SIZE alignSize(sizeof(tcache_chunk_header), NCNN_MALLOC_ALIGN)
+
+static NCNN_FORCEINLINE tcache_chunk_header* tcache_get_header(const void* ptr)
+{
+    return (tcache_chunk_header*)((unsigned char*)ptr - TCACHE_HEADER_SIZE);
+}
+
+static void* tcache_chunk_alloc(size_t size, int size_class, bool use_hugepage)
+{
+    const size_t total = TCACHE_HEADER_SIZE + size;
+
+    unsigned char* raw = 0;
+    size_t map_size = 0;
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (use_hugepage && size >= TCACHE_HUGEPAGE_SIZE)
+    {
+        // map one extra hugepage and trim, so the chunk starts on a hugepage boundary
+        map_size = alignSize(total + NCNN_MALLOC_OVERREAD, TCACHE_HUGEPAGE_SIZE);
+        unsigned char* p = (unsigned char*)mmap(0, map_size + TCACHE_HUGEPAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p != MAP_FAILED)
+        {
+            raw = alignPtr(p, TCACHE_HUGEPAGE_SIZE);
+            if (raw != p)
+                munmap(p, raw - p);
+            munmap(raw + map_size, p + TCACHE_HUGEPAGE_SIZE - raw);
+
+            madvise(raw, map_size, MADV_HUGEPAGE);
+        }
+        else
+        {
+            map_size = 0;
+        }
+    }
+#else
+    (void)use_hugepage;
+#endif
+
+    if (!raw)
+    {
+        raw = (unsigned char*)ncnn::fastMalloc(total);
+        if (!raw)
+            return 0;
+    }
+
+    void* ptr = raw + TCACHE_HEADER_SIZE;
+
+    tcache_chunk_header* header = tcache_get_header(ptr);
+    header->size = size;
+    header->map_size = map_size;
+    header->size_class = size_class;
+
+    return ptr;
+}
+
+static void tcache_chunk_free(void* ptr)
+{
+    tcache_chunk_header* header = tcache_get_header(ptr);
+    unsigned char* raw = (unsigned char*)header;
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (header->map_size)
+    {
+        munmap(raw, header->map_size);
+        return;
+    }
+#endif
+
+    ncnn::fastFree(raw);
+}
+
+// in kbytes for the shared counter
+static NCNN_FORCEINLINE int tcache_kbytes(size_t size)
+{
+    return (int)((size + 1023) >> 10);
+}
+
+struct tcache_thread_cache
+{
+    void* chunks[TCACHE_CLASS_COUNT][TCACHE_DEPTH];
+    int count[TCACHE_CLASS_COUNT];
+    size_t size;
+    int epoch;
+};
+
+struct tcache_pool_class
+{
+    Mutex lock;
+    std::vector<void*> chunks;
+};
+
+class ThreadCachePoolAllocatorPrivate
+{
+public:
+    ThreadLocalStorage tls;
+
+    Mutex caches_lock;
+    std::vector<tcache_thread_cache*> caches;
+
+    tcache_pool_class pools[TCACHE_CLASS_COUNT];
+    int pool_kbytes;
+
+    size_t thread_cache_size;
+    size_t pool_cache_size;
+    bool use_hugepage;
+
+    // bumped by clear, thread caches older than this are dropped
+    volatile int epoch;
+
+    tcache_thread_cache* get_thread_cache();
+    void release_thread_cache(tcache_thread_cache* tc);
+
+    // move chunks into the shared pool, the ones over budget go back to the system
+    void pool_put(int size_class, void** chunks, int count);
+};
+
+tcache_thread_cache* ThreadCachePoolAllocatorPrivate::get_thread_cache()
+{
+    tcache_thread_cache* tc = (tcache_thread_cache*)tls.get();
+    if (!tc)
+    {
+        tc = new tcache_thread_cache;
+        memset(tc, 0, sizeof(tcache_thread_cache));
+        tc->epoch = epoch;
+
+        caches_lock.lock();
+        caches.push_back(tc);
+        caches_lock.unlock();
+
+        tls.set(tc);
+    }
+
+    if (tc->epoch != epoch)
+    {
+        release_thread_cache(tc);
+        tc->epoch = epoch;
+    }
+
+    return tc;
+}
+
+void ThreadCachePoolAllocatorPrivate::release_thread_cache(tcache_thread_cache* tc)
+{
+    for (int i = 0; i < TCACHE_CLASS_COUNT; i++)
+    {
+        for (int j = 0; j < tc->count[i]; j++)
+        {
+            tcache_chunk_free(tc->chunks[i][j]);
+        }
+        tc->count[i] = 0;
+    }
+    tc->size = 0;
+}
+
+void ThreadCachePoolAllocatorPrivate::pool_put(int size_class, void** chunks, int count)
+{
+    const int kbytes = tcache_kbytes(tcache_class_size(size_class));
+    const int max_kbytes = (int)std::min(pool_cache_size >> 10, (size_t)0x7fffffff);
+
+    int kept = 0;
+
+    tcache_pool_class& pool = pools[size_class];
+    pool.lock.lock();
+    for (; kept < count; kept++)
+    {
+        if (NCNN_XADD(&pool_kbytes, kbytes) + kbytes > max_kbytes)
+        {
+            NCNN_XADD(&pool_kbytes, -kbytes);
+            break;
+        }
+
+        pool.chunks.push_back(chunks[kept]);
+    }
+    pool.lock.unlock();
+
+    for (int i = kept; i < count; i++)
+    {
+        tcache_chunk_free(chunks[i]);
+    }
+}
+
+ThreadCachePoolAllocator::ThreadCachePoolAllocator()
+    : Allocator(), d(new ThreadCachePoolAllocatorPrivate)
+{
+    d->pool_kbytes = 0;
+    d->thread_cache_size = 16 * 1024 * 1024;
+    d->pool_cache_size = 256 * 1024 * 1024;
+    d->use_hugepage = false;
+    d->epoch = 0;
+}
+
+ThreadCachePoolAllocator::~ThreadCachePoolAllocator()
+{
+    clear();
+
+    for (size_t i = 0; i < d->caches.size(); i++)
+    {
+        d->release_thread_cache(d->caches[i]);
+        delete d->caches[i];
+    }
+
+    delete d;
+}
+
+ThreadCachePoolAllocator::ThreadCachePoolAllocator(const ThreadCachePoolAllocator&)
+    : d(0)
+{
+}
+
+ThreadCachePoolAllocator& ThreadCachePoolAllocator::operator=(const ThreadCachePoolAllocator&)
+{
+    return *this;
+}
+
+void ThreadCachePoolAllocator::set_thread_cache_size(size_t size)
+{
+    d->thread_cache_size = size;
+}
+
+void ThreadCachePoolAllocator::set_pool_cache_size(size_t size)
+{
+    d->pool_cache_size = size;
+}
+
+void ThreadCachePoolAllocator::set_use_hugepage(bool enable)
+{
+    d->use_hugepage = enable;
+}
+
+void ThreadCachePoolAllocator::clear()
+{
+    NCNN_XADD((int*)&d->epoch, 1);
+
+    for (int i = 0; i < TCACHE_CLASS_COUNT; i++)
+    {
+        tcache_pool_class& pool = d->pools[i];
+
+        pool.lock.lock();
+        for (size_t j = 0; j < pool.chunks.size(); j++)
+        {
+            tcache_chunk_free(pool.chunks[j]);
+        }
+        NCNN_XADD(&d->pool_kbytes, -tcache_kbytes(tcache_class_size(i)) * (int)pool.chunks.size());
+        pool.chunks.clear();
+        pool.lock.unlock();
+    }
+
+    // the calling thread drops its own cache right away
+    d->get_thread_cache();
+}
+
+void* ThreadCachePoolAllocator::fastMalloc(size_t size)
+{
+    const int size_class = tcache_size_class(size);
+    if (size_class == -1)
+        return tcache_chunk_alloc(size, -1, d->use_hugepage);
+
+    const size_t class_size = tcache_class_size(size_class);
+
+    tcache_thread_cache* tc = d->get_thread_cache();
+    if (tc->count[size_class] > 0)
+    {
+        tc->size -= class_size;
+        return tc->chunks[size_class][--tc->count[size_class]];
+    }
+
+    // refill from the shared pool, up to half of the thread cache depth at once
+    void* ptr = 0;
+
+    tcache_pool_class& pool = d->pools[size_class];
+    pool.lock.lock();
+    if (!pool.chunks.empty())
+    {
+        int taken = 1;
+        ptr = pool.chunks.back();
+        pool.chunks.pop_back();
+
+        while (!pool.chunks.empty() && taken < TCACHE_DEPTH / 2 && tc->size + class_size <= d->thread_cache_size)
+        {
+            tc->chunks[size_class][tc->count[size_class]++] = pool.chunks.back();
+            tc->size += class_size;
+            pool.chunks.pop_back();
+            taken++;
+        }
+
+        NCNN_XADD(&d->pool_kbytes, -tcache_kbytes(class_size) * taken);
+    }
+    pool.lock.unlock();
+
+    if (ptr)
+        return ptr;
+
+    return tcache_chunk_alloc(class_size, size_class, d->use_hugepage);
+}
+
+void ThreadCachePoolAllocator::fastFree(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    const int size_class = tcache_get_header(ptr)->size_class;
+    if (size_class == -1)
+    {
+        tcache_chunk_free(ptr);
+        return;
+    }
+
+    const size_t class_size = tcache_class_size(size_class);
+
+    tcache_thread_cache* tc = d->get_thread_cache();
+    if (tc->size + class_size > d->thread_cache_size)
+    {
+        d->pool_put(size_class, &ptr, 1);
+        return;
+    }
+
+    void** chunks = tc->chunks[size_class];
+    if (tc->count[size_class] == TCACHE_DEPTH)
+    {
+        // spill the coldest half to the shared pool
+        const int spill = TCACHE_DEPTH / 2;
+        d->pool_put(size_class, chunks, spill);
+        for (int i = spill; i < TCACHE_DEPTH; i++)
+        {
+            chunks[i - spill] = chunks[i];
+        }
+        tc->count[size_class] -= spill;
+        tc->size -= class_size * spill;
+    }
+
+    chunks[tc->count[size_class]++] = ptr;
+    tc->size += class_size;
+}
+
+// every allocation of the paged kv cache allocator is prefixed with this header
+struct paged_kvcache_header
+{
+    size_t size;
+    int kind; // 0 = plain, 1 = block table, 2 = block
+    int refcount;
+};
+
+#define PAGED_KVCACHE_HEADER_SIZE alignSize(sizeof(paged_kvcache_header), NCNN_MALLOC_ALIGN)
+
+static NCNN_FORCEINLINE paged_kvcache_header* paged_kvcache_get_header(const void* ptr)
+{
+    return (paged_kvcache_header*)((unsigned char*)ptr - PAGED_KVCACHE_HEADER_SIZE);
+}
+
+static void* paged_kvcache_malloc(size_t size, int kind)
+{
+    unsigned char* raw = (unsigned char*)ncnn::fastMalloc(PAGED_KVCACHE_HEADER_SIZE + size);
+    if (!raw)
+        return 0;
+
+    void* ptr = raw + PAGED_KVCACHE_HEADER_SIZE;
+
+    paged_kvcache_header* header = paged_kvcache_get_header(ptr);
+    header->size = size;
+    header->kind = kind;
+    header->refcount = 1;
+
+    return ptr;
+}
+
+static void paged_kvcache_free(void* ptr)
+{
+    ncnn::fastFree((unsigned char*)ptr - PAGED_KVCACHE_HEADER_SIZE);
+}
+
+class PagedKVCacheAllocatorPrivate
+{
+public:
+    Mutex blocks_lock;
+    int block_seqlen;
+    int blocks_in_use;
+    std::list<std::pair<size_t, void*> > free_blocks;
+};
+
+PagedKVCacheAllocator::PagedKVCacheAllocator(int block_seqlen)
+    : Allocator(), d(new PagedKVCacheAllocatorPrivate)
+{
+    d->block_seqlen = block_seqlen > 0 ? block_seqlen : 64;
+    d->blocks_in_use = 0;
+}
+
+PagedKVCacheAllocator::~PagedKVCacheAllocator()
+{
+    clear();
+
+    if (d->blocks_in_use != 0)
+    {
+        NCNN_LOGE("FATAL ERROR! paged kvcache allocator destroyed too early, %d blocks still in use", d->blocks_in_use);
+    }
+
+    delete d;
+}
+
+PagedKVCacheAllocator::PagedKVCacheAllocator(const PagedKVCacheAllocator&)
+    : d(0)
+{
+}
+
+PagedKVCacheAllocator& PagedKVCacheAllocator::operator=(const PagedKVCacheAllocator&)
+{
+    return *this;
+}
+
+int PagedKVCacheAllocator::block_seqlen() const
+{
+    return d->block_seqlen;
+}
+
+void PagedKVCacheAllocator::clear()
+{
+    d->blocks_lock.lock();
+
+    std::list<std::pair<size_t, void*> >::iterator it = d->free_blocks.begin();
+    for (; it != d->free_blocks.end(); ++it)
+    {
+        paged_kvcache_free(it->second);
+    }
+    d->free_blocks.clear();
+
+    d->blocks_lock.unlock();
+}
+
+void* PagedKVCacheAllocator::fastMalloc(size_t size)
+{
+    return paged_kvcache_malloc(size, 0);
+}
+
+void PagedKVCacheAllocator::fastFree(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    paged_kvcache_header* header = paged_kvcache_get_header(ptr);
+    if (header->kind == 2)
+    {
+        block_release(ptr);
+        return;
+    }
+
+    if (header->kind == 1)
+    {
+        const PagedKVCacheTable* table = (const PagedKVCacheTable*)ptr;
+        for (int i = 0; i < table->block_count; i++)
+        {
+            block_release(table->blocks[i]);
+        }
+    }
+
+    paged_kvcache_free(ptr);
+}
+
+PagedKVCacheTable* PagedKVCacheAllocator::table_alloc(int max_block_count)
+{
+    const size_t table_size = sizeof(PagedKVCacheTable) + sizeof(void*) * (max_block_count - 1);
+
+    PagedKVCacheTable* table = (PagedKVCacheTable*)paged_kvcache_malloc(table_size, 1);
+    if (!table)
+        return 0;
+
+    table->block_seqlen = d->block_seqlen;
+    table->block_count = 0;
+    table->max_block_count = max_block_count;
+    table->refcount = 1;
+    table->block_size = 0;
+
+    return table;
+}
+
+bool PagedKVCacheAllocator::is_table(const void* ptr) const
+{
+    return ptr && paged_kvcache_get_header(ptr)->kind == 1;
+}
+
+PagedKVCacheTable* PagedKVCacheAllocator::table_fork(const PagedKVCacheTable* table, int block_count, int max_block_count)
+{
+    PagedKVCacheTable* new_table = table_alloc(max_block_count);
+    if (!new_table)
+        return 0;
+
+    for (int i = 0; i < block_count; i++)
+    {
+        block_addref(table->blocks[i]);
+        new_table->blocks[i] = table->blocks[i];
+    }
+    new_table->block_count = block_count;
+    new_table->block_size = table->block_size;
+
+    return new_table;
+}
+
+void* PagedKVCacheAllocator::block_alloc(size_t size)
+{
+    d->blocks_lock.lock();
+
+    d->blocks_in_use++;
+
+    // all blocks of a cache have the same size, so an exact match keeps fragmentation bounded
+    std::list<std::pair<size_t, void*> >::iterator it = d->free_blocks.begin();
+    for (; it != d->free_blocks.end(); ++it)
+    {
+        if (it->first == size)
+        {
+            void* ptr = it->second;
+
+            d->free_blocks.erase(it);
+
+            d->blocks_lock.unlock();
+
+            paged_kvcache_get_header(ptr)->refcount = 1;
+
+            return ptr;
+        }
+    }
+
+    d->blocks_lock.unlock();
+
+    void* ptr = paged_kvcache_malloc(size, 2);
+    if (!ptr)
+    {
+        d->blocks_lock.lock();
+        d->blocks_in_use--;
+        d->blocks_lock.unlock();
+    }
+
+    return ptr;
+}
+
+void PagedKVCacheAllocator::block_addref(void* block)
+{
+    NCNN_XADD(&paged_kvcache_get_header(block)->refcount, 1);
+}
+
+void PagedKVCacheAllocator::block_release(void* block)
+{
+    paged_kvcache_header* header = paged_kvcache_get_header(block);
+    if (NCNN_XADD(&header->refcount, -1) != 1)
+        return;
+
+    d->blocks_lock.lock();
+
+    d->blocks_in_use--;
+    d->free_blocks.push_back(std::make_pair(header->size, block));
+
+    d->blocks_lock.unlock();
+}
+
+bool PagedKVCacheAllocator::block_shared(const void* block) const
+{
+    return paged_kvcache_get_header(block)->refcount > 1;
+}
+
+struct blob_arena_event
+{
+    size_t size;
+    int alloc_time;
+    int free_time;
+};
+
+struct blob_arena_plan
+{
+    std::vector<int> signature;
+    std::vector<size_t> sizes;
+    std::vector<size_t> offsets;
+    size_t arena_size;
+};
+
+struct blob_arena
+{
+    unsigned char* data;
+    size_t size;
+    int live;
+};
+
+struct blob_arena_payout
+{
+    void* ptr;
+    size_t size;
+    int arena; // -1 = heap
+    int event; // recorded trace entry, -1 = none
+};
+
+// assign every recorded allocation a fixed offset
+// larger blobs are placed first at the lowest offset not used by any blob alive at the same time
+static size_t blob_arena_plan_offsets(const std::vector<blob_arena_event>& events, std::vector<size_t>& offsets)
+{
+    const int count = (int)events.size();
+
+    offsets.resize(count);
+
+    std::vector<int> order(count);
+    for (int i = 0; i < count; i++)
+    {
+        // insertion sort by size, earlier allocation first on tie
+        const size_t size = events[i].size;
+        int j = i;
+        for (; j > 0 && events[order[j - 1]].size < size; j--)
+        {
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
+    }
+
+    size_t arena_size = 0;
+
+    std::vector<int> overlaps;
+    for (int i = 0; i < count; i++)
+    {
+        const blob_arena_event& e = events[order[i]];
+        const size_t size = alignSize(e.size, NCNN_MALLOC_ALIGN);
+
+        // placed blobs alive at the same time, sorted by offset
+        overlaps.clear();
+        for (int j = 0; j < i; j++)
+        {
+            const blob_arena_event& e2 = events[order[j]];
+            if (e2.alloc_time >= e.free_time || e.alloc_time >= e2.free_time)
+                continue;
+
+            const size_t offset2 = offsets[order[j]];
+            overlaps.push_back(order[j]);
+            int k = (int)overlaps.size() - 1;
+            for (; k > 0 && offsets[overlaps[k - 1]] > offset2; k--)
+            {
+                overlaps[k] = overlaps[k - 1];
+            }
+            overlaps[k] = order[j];
+        }
+
+        // first gap that fits
+        size_t offset = 0;
+        for (size_t j = 0; j < overlaps.size(); j++)
+        {
+            const size_t offset2 = offsets[overlaps[j]];
+            if (offset + size <= offset2)
+                break;
+
+            offset = std::max(offset, offset2 + alignSize(events[overlaps[j]].size, NCNN_MALLOC_ALIGN));
+        }
+
+        offsets[order[i]] = offset;
+        arena_size = std::max(arena_size, offset + size);
+    }
+
+    return arena_size;
+}
+
+class BlobArenaAllocatorPrivate
+{
+public:
+    Mutex lock;
+    std::vector<blob_arena_plan> plans;
+    std::vector<blob_arena> arenas;
+    std::vector<blob_arena_payout> payouts;
+
+    // current run
+    int running;
+    int plan;  // -1 = recording
+    int arena; // -1 = no arena
+    int cursor;
+    bool mismatch;
+    std::vector<int> signature;
+    std::vector<blob_arena_event> events;
+    int clock;
+
+    // last run
+    size_t planned_size;
+    int heap_alloc_count;
+
+    bool arena_overlap(size_t offset, size_t size) const;
+    int acquire_arena(size_t size);
+};
+
+bool BlobArenaAllocatorPrivate::arena_overlap(size_t offset, size_t size) const
+{
+    const unsigned char* data = arenas[arena].data;
+    for (size_t i = 0; i < payouts.size(); i++)
+    {
+        const blob_arena_payout& p = payouts[i];
+        if (p.arena != arena)
+            continue;
+
+        const size_t offset2 = (const unsigned char*)p.ptr - data;
+        if (offset < offset2 + alignSize(p.size, NCNN_MALLOC_ALIGN) && offset2 < offset + size)
+            return true;
+    }
+
+    return false;
+}
+
+int BlobArenaAllocatorPrivate::acquire_arena(size_t size)
+{
+    // blobs returned by the previous run may still be held by the caller
+    // take an idle arena so they are never overwritten
+    int best = -1;
+    int idle = -1;
+    for (int i = 0; i < (int)arenas.size(); i++)
+    {
+        if (arenas[i].live != 0)
+            continue;
+
+        if (arenas[i].size >= size && (best == -1 || arenas[i].size < arenas[best].size))
+            best = i;
+
+        if (idle == -1 || arenas[i].size < arenas[idle].size)
+            idle = i;
+    }
+
+    if (best != -1)
+        return best;
+
+    unsigned char* data = (unsigned char*)ncnn::fastMalloc(size);
+    if (!data)
+        return -1;
+
+    heap_alloc_count++;
+
+    if (idle != -1)
+    {
+        ncnn::fastFree(arenas[idle].data);
+        arenas[idle].data = data;
+        arenas[idle].size = size;
+        return idle;
+    }
+
+    blob_arena a;
+    a.data = data;
+    a.size = size;
+    a.live = 0;
+    arenas.push_back(a);
+
+    return (int)arenas.size() - 1;
+}
+
+BlobArenaAllocator::BlobArenaAllocator()
+    : Allocator(), d(new BlobArenaAllocatorPrivate)
+{
+    d->running = 0;
+    d->plan = -1;
+    d->arena = -1;
+    d->cursor = 0;
+    d->mismatch = false;
+    d->clock = 0;
+    d->planned_size = 0;
+    d->heap_alloc_count = 0;
+}
+
+BlobArenaAllocator::~BlobArenaAllocator()
+{
+    clear();
+
+    if (!d->payouts.empty())
+    {
+        NCNN_LOGE("FATAL ERROR! blob arena allocator destroyed too early");
+#if NCNN_STDIO
+        for (size_t i = 0; i < d->payouts.size(); i++)
+        {
+            NCNN_LOGE("%p still in use", d->payouts[i].ptr);
+        }
+#endif
+    }
+
+    delete d;
+}
+
+BlobArenaAllocator::BlobArenaAllocator(const BlobArenaAllocator&)
+    : d(0)
+{
+}
+
+BlobArenaAllocator& BlobArenaAllocator::operator=(const BlobArenaAllocator&)
+{
+    return *this;
+}
+
+void BlobArenaAllocator::clear()
+{
+    MutexLockGuard guard(d->lock);
+
+    if (d->running)
+    {
+        NCNN_LOGE("blob arena allocator clear while running");
+        return;
+    }
+
+    d->plans.clear();
+
+    // arenas with blobs still in use are kept, their indexes stay valid
+    for (size_t i = 0; i < d->arenas.size(); i++)
+    {
+        if (d->arenas[i].live != 0)
+            continue;
+
+        ncnn::fastFree(d->arenas[i].data);
+        d->arenas[i].data = 0;
+        d->arenas[i].size = 0;
+    }
+}
+
+void BlobArenaAllocator::begin_run(const std::vector<int>& signature)
+{
+    MutexLockGuard guard(d->lock);
+
+    if (d->running++)
+    {
+        // nested runs join the outer one
+        return;
+    }
+
+    d->plan = -1;
+    d->arena = -1;
+    d->cursor = 0;
+    d->mismatch = false;
+    d->planned_size = 0;
+    d->heap_alloc_count = 0;
+
+    for (int i = 0; i < (int)d->plans.size(); i++)
+    {
+        const std::vector<int>& s = d->plans[i].signature;
+        if (s.size() != signature.size())
+            continue;
+
+        bool same = true;
+        for (size_t j = 0; j < s.size(); j++)
+        {
+            if (s[j] != signature[j])
+            {
+                same = false;
+                break;
+            }
+        }
+
+        if (same)
+        {
+            d->plan = i;
+            break;
+        }
+    }
+
+    if (d->plan != -1)
+    {
+        d->planned_size = d->plans[d->plan].arena_size;
+        if (d->planned_size > 0)
+            d->arena = d->acquire_arena(d->planned_size);
+        return;
+    }
+
+    // record a new trace
+    d->signature = signature;
+    d->events.clear();
+    d->clock = 0;
+}
+
+void BlobArenaAllocator::end_run()
+{
+    MutexLockGuard guard(d->lock);
+
+    if (d->running == 0)
+        return;
+
+    if (--d->running)
+        return;
+
+    if (d->plan == -1)
+    {
+        blob_arena_plan plan;
+        plan.signature = d->signature;
+        plan.sizes.resize(d->events.size());
+        for (size_t i = 0; i < d->events.size(); i++)
+        {
+            plan.sizes[i] = d->events[i].size;
+        }
+        plan.arena_size = blob_arena_plan_offsets(d->events, plan.offsets);
+        d->plans.push_back(plan);
+
+        // blobs still alive after the run are planned to live until the end
+        for (size_t i = 0; i < d->payouts.size(); i++)
+        {
+            d->payouts[i].event = -1;
+        }
+        d->events.clear();
+    }
+    else if (d->mismatch)
+    {
+        // the allocation sequence changed, record it again next time
+        d->plans.erase(d->plans.begin() + d->plan);
+    }
+
+    d->plan = -1;
+    d->arena = -1;
+}
+
+size_t BlobArenaAllocator::planned_size() const
+{
+    MutexLockGuard guard(d->lock);
+
+    return d->planned_size;
+}
+
+size_t BlobArenaAllocator::arena_size() const
+{
+    MutexLockGuard guard(d->lock);
+
+    size_t size = 0;
+    for (size_t i = 0; i < d->arenas.size(); i++)
+    {
+        size += d->arenas[i].size;
+    }
+
+    return size;
+}
+
+int BlobArenaAllocator::heap_alloc_count() const
+{
+    MutexLockGuard guard(d->lock);
+
+    return d->heap_alloc_count;
+}
+
+void* BlobArenaAllocator::fastMalloc(size_t size)
+{
+    d->lock.lock();
+
+    if (!d->running)
+    {
+        d->lock.unlock();
+        return ncnn::fastMalloc(size);
+    }
+
+    const int i = d->cursor++;
+
+    if (d->plan != -1)
+    {
+        const blob_arena_plan& plan = d->plans[d->plan];
+        if (i < (int)plan.sizes.size() && plan.sizes[i] == size)
+        {
+            const size_t offset = plan.offsets[i];
+
+            // never hand out a range still held by someone, the plan may disagree with what really happened
+            if (d->arena != -1 && !d->arena_overlap(offset, alignSize(size, NCNN_MALLOC_ALIGN)))
+            {
+                blob_arena_payout p;
+                p.ptr = d->arenas[d->arena].data + offset;
+                p.size = size;
+                p.arena = d->arena;
+                p.event = -1;
+                d->payouts.push_back(p);
+
+                d->arenas[d->arena].live++;
+
+                d->lock.unlock();
+
+                return p.ptr;
+            }
+        }
+        else
+        {
+            d->mismatch = true;
+        }
+
+        d->heap_alloc_count++;
+
+        d->lock.unlock();
+
+        return ncnn::fastMalloc(size);
+    }
+
+    // recording
+    void* ptr = ncnn::fastMalloc(size);
+    if (!ptr)
+    {
+        d->lock.unlock();
+        return 0;
+    }
+
+    d->heap_alloc_count++;
+
+    blob_arena_event e;
+    e.size = size;
+    e.alloc_time = d->clock++;
+    e.free_time = 0x7fffffff;
+    d->events.push_back(e);
+
+    blob_arena_payout p;
+    p.ptr = ptr;
+    p.size = size;
+    p.arena = -1;
+    p.event = (int)d->events.size() - 1;
+    d->payouts.push_back(p);
+
+    d->lock.unlock();
+
+    return ptr;
+}
+
+void BlobArenaAllocator::fastFree(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    d->lock.lock();
+
+    for (size_t i = 0; i < d->payouts.size(); i++)
+    {
+        blob_arena_payout& p = d->payouts[i];
+        if (p.ptr != ptr)
+            continue;
+
+        const int arena = p.arena;
+
+        if (arena != -1)
+        {
+            d->arenas[arena].live--;
+        }
+        else if (p.event != -1)
+        {
+            d->events[p.event].free_time = d->clock++;
+        }
+
+        // keep the capacity, so replaying does not allocate
+        p = d->payouts.back();
+        d->payouts.pop_back();
+
+        d->lock.unlock();
+
+        if (arena == -1)
+            ncnn::fastFree(ptr);
+
+        return;
+    }
+
+    d->lock.unlock();
+
+    // heap allocation outside of the plan
+    ncnn::fastFree(ptr);
+}
+
 #if NCNN_VULKAN
 VkAllocator::VkAllocator(const VulkanDevice* _vkdev)
     : vkdev(_vkdev)
@@ -205,6 +205,140 @@ private:
     UnlockedPoolAllocatorPrivate* const d;
 };
 
+// pool allocator for many threads sharing one instance
+// chunks are rounded up to size classes spaced 25% apart, malloc and free are O(1)
+// every thread keeps a small lock-free cache per size class and exchanges chunks in bulk with a shared pool
+// the shared pool takes a per-class lock only, so threads working on different sizes never contend
+class ThreadCachePoolAllocatorPrivate;
+class NCNN_EXPORT ThreadCachePoolAllocator : public Allocator
+{
+public:
+    ThreadCachePoolAllocator();
+    ~ThreadCachePoolAllocator();
+
+    // bytes cached by each thread
+    // default 16M
+    void set_thread_cache_size(size_t size);
+
+    // bytes cached by the shared pool, more freed chunks go back to the system
+    // default 256M
+    void set_pool_cache_size(size_t size);
+
+    // back chunks of 2M and larger with transparent hugepages, linux only
+    // default false
+    void set_use_hugepage(bool enable);
+
+    // release the shared pool immediately
+    // thread caches are released by their owner thread on its next malloc or free
+    void clear();
+
+    virtual void* fastMalloc(size_t size);
+    virtual void fastFree(void* ptr);
+
+private:
+    ThreadCachePoolAllocator(const ThreadCachePoolAllocator&);
+    ThreadCachePoolAllocator& operator=(const ThreadCachePoolAllocator&);
+
+private:
+    ThreadCachePoolAllocatorPrivate* const d;
+};
+
+// block table of a paged kv cache
+// every block holds block_seqlen tokens of all kv heads, laid out as num_kv_head x block_seqlen x head_dim
+struct PagedKVCacheTable
+{
+    int block_seqlen;
+    int block_count;
+    int max_block_count;
+    // refcount of the cache Mat holding this table
+    int refcount;
+    size_t block_size;
+    void* blocks[1];
+};
+
+class PagedKVCacheAllocatorPrivate;
+class NCNN_EXPORT PagedKVCacheAllocator : public Allocator
+{
+public:
+    // block_seqlen is the number of tokens per block
+    PagedKVCacheAllocator(int block_seqlen = 64);
+    ~PagedKVCacheAllocator();
+
+    int block_seqlen() const;
+
+    // release all free blocks immediately
+    void clear();
+
+    // plain allocation, for caches that are not paged
+    virtual void* fastMalloc(size_t size);
+    // releases the blocks of a block table too
+    virtual void fastFree(void* ptr);
+
+    // block table with room for max_block_count blocks
+    PagedKVCacheTable* table_alloc(int max_block_count);
+    bool is_table(const void* ptr) const;
+
+    // block table sharing the first block_count blocks of table
+    PagedKVCacheTable* table_fork(const PagedKVCacheTable* table, int block_count, int max_block_count);
+
+    // refcounted fixed-size token block, recycled by size
+    void* block_alloc(size_t size);
+    void block_addref(void* block);
+    void block_release(void* block);
+
+    // a shared block must be copied before it is written
+    bool block_shared(const void* block) const;
+
+private:
+    PagedKVCacheAllocator(const PagedKVCacheAllocator&);
+    PagedKVCacheAllocator& operator=(const PagedKVCacheAllocator&);
+
+private:
+    PagedKVCacheAllocatorPrivate* const d;
+};
+
+// blob allocator replaying a static memory plan
+// the first run of every input shape allocates from the heap and records the blob live ranges
+// the live ranges are then packed at fixed offsets of one arena, dead blobs leave room for later ones
+// the following runs with the same shape take every blob from the arena without malloc
+// a run is opened by Extractor, allocations outside of a run go to the heap
+class BlobArenaAllocatorPrivate;
+class NCNN_EXPORT BlobArenaAllocator : public Allocator
+{
+public:
+    BlobArenaAllocator();
+    ~BlobArenaAllocator();
+
+    // release all plans and idle arenas immediately
+    void clear();
+
+    // start replaying or recording the plan of signature
+    // signature is any sequence that identifies the input shapes
+    void begin_run(const std::vector<int>& signature);
+
+    // finish the run, a recorded trace becomes a plan
+    void end_run();
+
+    // arena bytes needed by the plan of the last run, 0 if it was recorded
+    size_t planned_size() const;
+
+    // bytes held by all arenas
+    size_t arena_size() const;
+
+    // heap allocations of the last run, 0 once the plan is replayed
+    int heap_alloc_count() const;
+
+    virtual void* fastMalloc(size_t size);
+    virtual void fastFree(void* ptr);
+
+private:
+    BlobArenaAllocator(const BlobArenaAllocator&);
+    BlobArenaAllocator& operator=(const BlobArenaAllocator&);
+
+private:
+    BlobArenaAllocatorPrivate* const d;
+};
+
 #if NCNN_VULKAN
 
 class VulkanDevice;
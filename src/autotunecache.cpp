@@ -0,0 +1,340 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "autotunecache.h"
+
+#include "cpu.h"
+
+#include <string.h>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#ifdef _MSC_VER
+#include <intrin.h> // __cpuid()
+#endif
+#if defined(__clang__) || defined(__GNUC__)
+#include <cpuid.h> // __get_cpuid()
+#endif
+#endif
+
+namespace ncnn {
+
+#define NCNN_AUTOTUNE_CACHE_FILE_MAGIC "ncnn-autotune-cache"
+#define NCNN_AUTOTUNE_CACHE_VERSION    1
+
+struct autotune_cache_entry
+{
+    std::string key;
+    int count;
+    int values[8];
+};
+
+class AutotuneCachePrivate
+{
+public:
+    mutable Mutex lock;
+    std::vector<autotune_cache_entry> entries;
+};
+
+static void get_cpu_model_name(char* name, int size)
+{
+    name[0] = '\0';
+
+#if (defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)) && (defined(_MSC_VER) || defined(__clang__) || defined(__GNUC__))
+    unsigned int brand[12] = {0};
+    for (int i = 0; i < 3; i++)
+    {
+        unsigned int* out = brand + i * 4;
+#if defined(_MSC_VER) && !defined(__clang__)
+        __cpuid((int*)out, 0x80000002 + i);
+#else
+        __get_cpuid(0x80000002 + i, out, out + 1, out + 2, out + 3);
+#endif
+    }
+
+    char brand_string[49];
+    memcpy(brand_string, brand, 48);
+    brand_string[48] = '\0';
+    strncpy(name, brand_string, size - 1);
+    name[size - 1] = '\0';
+#endif
+
+    if (name[0] == '\0')
+    {
+        strncpy(name, "generic", size - 1);
+        name[size - 1] = '\0';
+    }
+}
+
+static void build_cpu_signature(char* signature, int size)
+{
+    char model_name[64];
+    get_cpu_model_name(model_name, sizeof(model_name));
+
+    std::string s = model_name;
+
+    // isa extensions the kernels dispatch on
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+    if (cpu_support_x86_avx())
+        s += "+avx";
+    if (cpu_support_x86_fma())
+        s += "+fma";
+    if (cpu_support_x86_avx2())
+        s += "+avx2";
+    if (cpu_support_x86_avx_vnni())
+        s += "+avxvnni";
+    if (cpu_support_x86_avx512())
+        s += "+avx512";
+    if (cpu_support_x86_avx512_vnni())
+        s += "+avx512vnni";
+    if (cpu_support_x86_avx512_bf16())
+        s += "+avx512bf16";
+    if (cpu_support_x86_avx512_fp16())
+        s += "+avx512fp16";
+#elif defined(__arm__) || defined(__aarch64__) || defined(_M_ARM) || defined(_M_ARM64)
+    if (cpu_support_arm_asimdhp())
+        s += "+asimdhp";
+    if (cpu_support_arm_asimddp())
+        s += "+asimddp";
+    if (cpu_support_arm_bf16())
+        s += "+bf16";
+    if (cpu_support_arm_i8mm())
+        s += "+i8mm";
+    if (cpu_support_arm_sve())
+        s += "+sve";
+#endif
+
+    char cache_info[64];
+    sprintf(cache_info, "+l2_%d", get_cpu_level2_cache_size());
+    s += cache_info;
+
+    // one token per line in the cache file
+    for (size_t i = 0; i < s.size(); i++)
+    {
+        if (s[i] == ' ' || s[i] == '\t' || s[i] == '\n' || s[i] == '\r')
+            s[i] = '_';
+    }
+
+    strncpy(signature, s.c_str(), size - 1);
+    signature[size - 1] = '\0';
+}
+
+AutotuneCache::AutotuneCache()
+    : d(new AutotuneCachePrivate)
+{
+}
+
+AutotuneCache::~AutotuneCache()
+{
+    delete d;
+}
+
+AutotuneCache::AutotuneCache(const AutotuneCache&)
+    : d(0)
+{
+}
+
+AutotuneCache& AutotuneCache::operator=(const AutotuneCache&)
+{
+    return *this;
+}
+
+void AutotuneCache::clear()
+{
+    MutexLockGuard lock(d->lock);
+
+    d->entries.clear();
+}
+
+size_t AutotuneCache::size() const
+{
+    MutexLockGuard lock(d->lock);
+
+    return d->entries.size();
+}
+
+#if NCNN_STDIO
+int AutotuneCache::save_cache(FILE* fp) const
+{
+    if (!fp)
+        return -1;
+
+    MutexLockGuard lock(d->lock);
+
+    fprintf(fp, "%s %d\n", NCNN_AUTOTUNE_CACHE_FILE_MAGIC, NCNN_AUTOTUNE_CACHE_VERSION);
+    fprintf(fp, "%s\n", cpu_signature());
+
+    for (size_t i = 0; i < d->entries.size(); i++)
+    {
+        const autotune_cache_entry& e = d->entries[i];
+
+        fprintf(fp, "%s %d", e.key.c_str(), e.count);
+        for (int j = 0; j < e.count; j++)
+        {
+            fprintf(fp, " %d", e.values[j]);
+        }
+        fprintf(fp, "\n");
+    }
+
+    if (fflush(fp) != 0)
+        return -1;
+
+    return 0;
+}
+
+int AutotuneCache::load_cache(FILE* fp)
+{
+    if (!fp)
+        return -1;
+
+    char magic[64];
+    int version = 0;
+    if (fscanf(fp, "%63s %d", magic, &version) != 2 || strcmp(magic, NCNN_AUTOTUNE_CACHE_FILE_MAGIC) != 0)
+    {
+        NCNN_LOGE("invalid autotune cache file");
+        return -1;
+    }
+
+    if (version != NCNN_AUTOTUNE_CACHE_VERSION)
+    {
+        NCNN_LOGE("autotune cache version %d mismatch, expect %d", version, NCNN_AUTOTUNE_CACHE_VERSION);
+        return -1;
+    }
+
+    char signature[256];
+    if (fscanf(fp, "%255s", signature) != 1)
+        return -1;
+
+    if (strcmp(signature, cpu_signature()) != 0)
+    {
+        // tuned on another machine, measure again
+        NCNN_LOGE("autotune cache was measured on %s, skipped", signature);
+        return 0;
+    }
+
+    while (1)
+    {
+        char key[256];
+        int count = 0;
+        if (fscanf(fp, "%255s %d", key, &count) != 2)
+            break;
+
+        if (count < 0 || count > 8)
+        {
+            NCNN_LOGE("invalid autotune cache entry %s", key);
+            return -1;
+        }
+
+        int values[8];
+        for (int j = 0; j < count; j++)
+        {
+            if (fscanf(fp, "%d", &values[j]) != 1)
+            {
+                NCNN_LOGE("invalid autotune cache entry %s", key);
+                return -1;
+            }
+        }
+
+        update(key, values, count);
+    }
+
+    return 0;
+}
+
+int AutotuneCache::save_cache(const char* path) const
+{
+    FILE* fp = fopen(path, "wb");
+    if (!fp)
+    {
+        NCNN_LOGE("fopen %s failed", path);
+        return -1;
+    }
+
+    int ret = save_cache(fp);
+    fclose(fp);
+
+    return ret;
+}
+
+int AutotuneCache::load_cache(const char* path)
+{
+    FILE* fp = fopen(path, "rb");
+    if (!fp)
+        return -1;
+
+    int ret = load_cache(fp);
+    fclose(fp);
+
+    return ret;
+}
+#endif // NCNN_STDIO
+
+int AutotuneCache::query(const char* key, int* values, int count) const
+{
+    MutexLockGuard lock(d->lock);
+
+    for (size_t i = 0; i < d->entries.size(); i++)
+    {
+        const autotune_cache_entry& e = d->entries[i];
+        if (e.key != key)
+            continue;
+
+        if (e.count != count)
+            return -1;
+
+        for (int j = 0; j < count; j++)
+        {
+            values[j] = e.values[j];
+        }
+
+        return 0;
+    }
+
+    return -1;
+}
+
+void AutotuneCache::update(const char* key, const int* values, int count)
+{
+    if (count > 8)
+        count = 8;
+
+    MutexLockGuard lock(d->lock);
+
+    autotune_cache_entry* e = 0;
+    for (size_t i = 0; i < d->entries.size(); i++)
+    {
+        if (d->entries[i].key == key)
+        {
+            e = &d->entries[i];
+            break;
+        }
+    }
+
+    if (!e)
+    {
+        d->entries.push_back(autotune_cache_entry());
+        e = &d->entries.back();
+        e->key = key;
+    }
+
+    e->count = count;
+    for (int j = 0; j < count; j++)
+    {
+        e->values[j] = values[j];
+    }
+}
+
+const char* AutotuneCache::cpu_signature()
+{
+    static char signature[256] = {0};
+    static Mutex signature_lock;
+
+    MutexLockGuard lock(signature_lock);
+    if (signature[0] == '\0')
+    {
+        build_cpu_signature(signature, sizeof(signature));
+    }
+
+    return signature;
+}
+
+} // namespace ncnn
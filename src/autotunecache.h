@@ -0,0 +1,56 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef NCNN_AUTOTUNECACHE_H
+#define NCNN_AUTOTUNECACHE_H
+
+#include "platform.h"
+
+#if NCNN_STDIO
+#include <stdio.h>
+#endif
+
+namespace ncnn {
+
+// measured best kernel choices per layer shape
+// layers consult it in create_pipeline when Option::autotune_cache is set,
+// a missing entry is measured once and recorded
+class AutotuneCachePrivate;
+class NCNN_EXPORT AutotuneCache
+{
+public:
+    AutotuneCache();
+
+    virtual ~AutotuneCache();
+
+    void clear();
+    size_t size() const;
+
+#if NCNN_STDIO
+    // entries measured on another cpu model or isa are skipped on load
+    int save_cache(FILE* fp) const;
+    int load_cache(FILE* fp);
+    int save_cache(const char* path) const;
+    int load_cache(const char* path);
+#endif // NCNN_STDIO
+
+    // return 0 and fill values when key has been tuned, -1 otherwise
+    int query(const char* key, int* values, int count) const;
+
+    // record the winner for key, at most 8 values
+    void update(const char* key, const int* values, int count);
+
+    // cpu model name and isa extensions the entries are valid for
+    static const char* cpu_signature();
+
+private:
+    AutotuneCache(const AutotuneCache&);
+    AutotuneCache& operator=(const AutotuneCache&);
+
+private:
+    AutotuneCachePrivate* const d;
+};
+
+} // namespace ncnn
+
+#endif // NCNN_AUTOTUNECACHE_H
@@ -185,6 +185,8 @@ static int g_powersave;
 static ncnn::CpuSet g_cpu_affinity_mask_all;
 static ncnn::CpuSet g_cpu_affinity_mask_little;
 static ncnn::CpuSet g_cpu_affinity_mask_big;
+static std::vector<ncnn::CpuSet> g_cpu_affinity_mask_numa_nodes;
+static std::vector<int> g_cpu_numa_node;
 
 // isa info
 #if defined _WIN32
@@ -2140,6 +2142,103 @@ static int detect_cpu_is_arm_a53_a55()
 #endif // defined __ANDROID__ || defined __linux__
 
 // the initialization
+#if defined __ANDROID__ || defined __linux__
+static int read_sysfs_cpu_list(const char* path, ncnn::CpuSet& mask)
+{
+    FILE* fp = fopen(path, "rb");
+    if (!fp)
+        return -1;
+
+    mask.disable_all();
+
+    // 0-7,16-23
+    int range_start = -1;
+    int value = 0;
+    bool has_value = false;
+    while (1)
+    {
+        int ch = fgetc(fp);
+        if (ch >= '0' && ch <= '9')
+        {
+            value = value * 10 + (ch - '0');
+            has_value = true;
+            continue;
+        }
+
+        if (has_value)
+        {
+            if (ch == '-')
+            {
+                range_start = value;
+            }
+            else
+            {
+                int start = range_start == -1 ? value : range_start;
+                for (int i = start; i <= value && i < CPU_SETSIZE; i++)
+                {
+                    mask.enable(i);
+                }
+                range_start = -1;
+            }
+
+            value = 0;
+            has_value = false;
+        }
+
+        if (ch == EOF)
+            break;
+    }
+
+    fclose(fp);
+
+    return 0;
+}
+#endif // defined __ANDROID__ || defined __linux__
+
+static void initialize_numa_node_mask(std::vector<ncnn::CpuSet>& node_masks, std::vector<int>& cpu_nodes)
+{
+    node_masks.clear();
+    cpu_nodes.resize(g_cpucount, 0);
+
+#if defined __ANDROID__ || defined __linux__
+    // https://github.com/torvalds/linux/blob/v6.0/Documentation/ABI/stable/sysfs-devices-node
+    ncnn::CpuSet online_nodes;
+    if (read_sysfs_cpu_list("/sys/devices/system/node/online", online_nodes) == 0)
+    {
+        // node ids may have holes, the offline ones keep an empty mask
+        int node_count = 0;
+        for (int i = 0; i < CPU_SETSIZE; i++)
+        {
+            if (online_nodes.is_enabled(i))
+                node_count = i + 1;
+        }
+
+        node_masks.resize(node_count);
+        for (int i = 0; i < node_count; i++)
+        {
+            if (!online_nodes.is_enabled(i))
+                continue;
+
+            char path[256];
+            sprintf(path, "/sys/devices/system/node/node%d/cpulist", i);
+            read_sysfs_cpu_list(path, node_masks[i]);
+
+            for (int j = 0; j < g_cpucount; j++)
+            {
+                if (node_masks[i].is_enabled(j))
+                    cpu_nodes[j] = i;
+            }
+        }
+    }
+#endif // defined __ANDROID__ || defined __linux__
+
+    if (node_masks.empty())
+    {
+        // no numa info, all cpus on one node
+        node_masks.push_back(g_cpu_affinity_mask_all);
+    }
+}
+
 static void initialize_global_cpu_info()
 {
 #if defined(_OPENMP) && (__clang__ || defined(_OPENMP_LLVM_RUNTIME))
@@ -2150,6 +2249,7 @@ static void initialize_global_cpu_info()
     g_physical_cpucount = get_physical_cpucount();
     g_powersave = 0;
     initialize_cpu_thread_affinity_mask(g_cpu_affinity_mask_all, g_cpu_affinity_mask_little, g_cpu_affinity_mask_big);
+    initialize_numa_node_mask(g_cpu_affinity_mask_numa_nodes, g_cpu_numa_node);
 
 #if (defined _WIN32 && (__aarch64__ || __arm__)) || ((defined __ANDROID__ || defined __linux__) && __riscv)
     if (!is_being_debugged())
@@ -3107,6 +3207,79 @@ int set_cpu_thread_affinity(const CpuSet& thread_affinity_mask)
 #endif
 }
 
+int get_numa_node_count()
+{
+    try_initialize_global_cpu_info();
+    return (int)g_cpu_affinity_mask_numa_nodes.size();
+}
+
+const CpuSet& get_numa_node_cpu_mask(int node)
+{
+    try_initialize_global_cpu_info();
+    if (node >= 0 && node < (int)g_cpu_affinity_mask_numa_nodes.size())
+        return g_cpu_affinity_mask_numa_nodes[node];
+
+    NCNN_LOGE("numa node %d not available", node);
+
+    // fallback to all cores anyway
+    return g_cpu_affinity_mask_all;
+}
+
+int get_cpu_numa_node(int cpu)
+{
+    try_initialize_global_cpu_info();
+    if (cpu < 0 || cpu >= (int)g_cpu_numa_node.size())
+        return -1;
+
+    return g_cpu_numa_node[cpu];
+}
+
+int set_numa_node_thread_affinity(int node, int num_threads)
+{
+    try_initialize_global_cpu_info();
+    if (node < 0 || node >= (int)g_cpu_affinity_mask_numa_nodes.size() || g_cpu_affinity_mask_numa_nodes[node].num_enabled() == 0)
+    {
+        NCNN_LOGE("numa node %d not available", node);
+        return -1;
+    }
+
+#if defined __ANDROID__ || defined __linux__ || defined _WIN32
+    const CpuSet& thread_affinity_mask = g_cpu_affinity_mask_numa_nodes[node];
+
+#ifdef _OPENMP
+    if (num_threads > 1)
+    {
+        // the calling thread takes part in the team as master
+        std::vector<int> ssarets(num_threads, 0);
+        #pragma omp parallel for num_threads(num_threads)
+        for (int i = 0; i < num_threads; i++)
+        {
+            ssarets[i] = set_sched_affinity(thread_affinity_mask);
+        }
+        for (int i = 0; i < num_threads; i++)
+        {
+            if (ssarets[i] != 0)
+                return -1;
+        }
+
+        return 0;
+    }
+#else
+    (void)num_threads;
+#endif
+
+    int ssaret = set_sched_affinity(thread_affinity_mask);
+    if (ssaret != 0)
+        return -1;
+
+    return 0;
+#else
+    // single node, nothing to bind
+    (void)num_threads;
+    return 0;
+#endif
+}
+
 int is_current_thread_running_on_a53_a55()
 {
     try_initialize_global_cpu_info();
@@ -3210,7 +3383,7 @@ int get_omp_thread_num()
 
 int get_kmp_blocktime()
 {
-#if defined(_OPENMP) && (__clang__ || defined(_OPENMP_LLVM_RUNTIME))
+#if defined(_OPENMP) && (NCNN_SIMPLEOMP || __clang__ || defined(_OPENMP_LLVM_RUNTIME))
     return kmp_get_blocktime();
 #else
     return 0;
@@ -3219,7 +3392,7 @@ int get_kmp_blocktime()
 
 void set_kmp_blocktime(int time_ms)
 {
-#if defined(_OPENMP) && (__clang__ || defined(_OPENMP_LLVM_RUNTIME))
+#if defined(_OPENMP) && (NCNN_SIMPLEOMP || __clang__ || defined(_OPENMP_LLVM_RUNTIME))
     kmp_set_blocktime(time_ms);
 #else
     (void)time_ms;
@@ -148,6 +148,20 @@ NCNN_EXPORT const CpuSet& get_cpu_thread_affinity_mask(int powersave);
 // set explicit thread affinity
 NCNN_EXPORT int set_cpu_thread_affinity(const CpuSet& thread_affinity_mask);
 
+// numa topology info
+// read from /sys/devices/system/node on linux
+// the whole system is treated as a single node elsewhere
+NCNN_EXPORT int get_numa_node_count();
+NCNN_EXPORT const CpuSet& get_numa_node_cpu_mask(int node);
+// return -1 if cpu is out of range
+NCNN_EXPORT int get_cpu_numa_node(int cpu);
+
+// bind the calling thread and num_threads openmp threads on the cpus of numa node
+// memory first touched by these threads is then allocated on that node
+// unlike set_cpu_thread_affinity, the openmp thread count is left untouched
+// return 0 if success
+NCNN_EXPORT int set_numa_node_thread_affinity(int node, int num_threads);
+
 // runtime thread affinity info
 NCNN_EXPORT int is_current_thread_running_on_a53_a55();
 
@@ -0,0 +1,682 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "inferenceserver.h"
+
+#if NCNN_THREADS
+
+#include "allocator.h"
+#include "benchmark.h"
+#include "cpu.h"
+
+#include <string.h>
+
+#if !NCNN_SIMPLESTL
+#include <list>
+#endif
+
+namespace ncnn {
+
+ServerOption::ServerOption()
+{
+    num_lanes = 1;
+    num_threads = get_physical_big_cpu_count();
+    use_lane_affinity = true;
+    max_batch_size = 8;
+    max_batch_delay_us = 2000;
+    max_queue_size = 0;
+}
+
+ServerStats::ServerStats()
+{
+    completed = 0;
+    failed = 0;
+    batches = 0;
+    elapsed = 0.0;
+    throughput = 0.0;
+    avg_batch_size = 0.0;
+    latency_avg = 0.0;
+    latency_p50 = 0.0;
+    latency_p99 = 0.0;
+    latency_max = 0.0;
+    queued = 0;
+    running = 0;
+}
+
+// log-linear latency histogram, 16 linear buckets per power of two microseconds
+#define NCNN_SERVER_LATENCY_BUCKETS 640
+
+static int latency_bucket(double ms)
+{
+    unsigned long long us = ms > 0.0 ? (unsigned long long)(ms * 1000.0) : 0;
+    if (us < 16)
+        return (int)us;
+
+    int p = 4;
+    while ((us >> (p + 1)) != 0)
+        p++;
+
+    int b = (p - 3) * 16 + (int)((us >> (p - 4)) & 15);
+    return std::min(b, NCNN_SERVER_LATENCY_BUCKETS - 1);
+}
+
+static double latency_bucket_value(int b)
+{
+    if (b < 16)
+        return (b + 0.5) / 1000.0;
+
+    const int p = b / 16 + 3;
+    const double width = (double)(1ull << (p - 4));
+    const double lower = (16 + b % 16) * width;
+    return (lower + width * 0.5) / 1000.0;
+}
+
+struct ServerRequest
+{
+    std::vector<Mat> inputs;
+    int batch;
+    double submit_time;
+    server_callback_func callback;
+    void* userdata;
+};
+
+class InferenceServerPrivate
+{
+public:
+    InferenceServerPrivate();
+
+    // pick queued requests for one batch, lock is held on entry and exit
+    // return false when the server quits and nothing is left
+    bool collect(std::vector<ServerRequest*>& requests);
+
+    int run(std::vector<ServerRequest*>& requests, Allocator* blob_allocator, Allocator* workspace_allocator, std::vector<std::vector<Mat> >& outputs) const;
+
+    void record(const std::vector<ServerRequest*>& requests, int ret, double finish_time);
+
+    static void* lane_entry(void* args);
+    void lane_loop(int lane_id);
+
+    bool same_shape(const ServerRequest* a, const ServerRequest* b) const;
+
+    Net net;
+    ServerOption opt;
+    std::vector<int> input_indexes;
+    std::vector<int> output_indexes;
+
+    mutable Mutex lock;
+    ConditionVariable condition;
+    ConditionVariable space_condition;
+
+    std::list<ServerRequest*> queue;
+    int queued;
+    int running;
+    bool started;
+    bool quit;
+
+    std::vector<Thread*> lanes;
+    std::vector<CpuSet> lane_masks;
+
+    // stats, guarded by lock
+    double stats_start_time;
+    int completed;
+    int failed;
+    int batches;
+    double latency_sum;
+    double latency_max;
+    std::vector<int> latency_histogram;
+};
+
+InferenceServerPrivate::InferenceServerPrivate()
+{
+    queued = 0;
+    running = 0;
+    started = false;
+    quit = false;
+
+    stats_start_time = 0.0;
+    completed = 0;
+    failed = 0;
+    batches = 0;
+    latency_sum = 0.0;
+    latency_max = 0.0;
+    latency_histogram.resize(NCNN_SERVER_LATENCY_BUCKETS, 0);
+}
+
+struct LaneArgs
+{
+    InferenceServerPrivate* d;
+    int lane_id;
+};
+
+void* InferenceServerPrivate::lane_entry(void* args)
+{
+    LaneArgs* la = (LaneArgs*)args;
+    la->d->lane_loop(la->lane_id);
+    delete la;
+    return 0;
+}
+
+bool InferenceServerPrivate::same_shape(const ServerRequest* a, const ServerRequest* b) const
+{
+    for (size_t i = 0; i < a->inputs.size(); i++)
+    {
+        const Mat& ma = a->inputs[i];
+        const Mat& mb = b->inputs[i];
+        if (ma.dims != mb.dims || ma.w != mb.w || ma.h != mb.h || ma.d != mb.d || ma.c != mb.c || ma.elemsize != mb.elemsize || ma.elempack != mb.elempack)
+            return false;
+    }
+
+    return true;
+}
+
+bool InferenceServerPrivate::collect(std::vector<ServerRequest*>& requests)
+{
+    for (;;)
+    {
+        while (!quit && queue.empty())
+        {
+            condition.wait(lock);
+        }
+
+        if (queue.empty())
+            return false;
+
+        const ServerRequest* head = *queue.begin();
+        if (opt.max_batch_size <= 1 || opt.max_batch_delay_us <= 0 || quit)
+            break;
+
+        // enough requests of the head shape to fill a batch
+        int batch = 0;
+        for (std::list<ServerRequest*>::iterator it = queue.begin(); it != queue.end() && batch < opt.max_batch_size; ++it)
+        {
+            if (same_shape(head, *it))
+                batch += (*it)->batch;
+        }
+        if (batch >= opt.max_batch_size)
+            break;
+
+        const double remain_us = (head->submit_time - get_current_time()) * 1000 + opt.max_batch_delay_us;
+        if (remain_us <= 0)
+            break;
+
+        // woken up by new requests or the deadline, another lane may take the head meanwhile
+        condition.timed_wait(lock, (int)remain_us + 1);
+    }
+
+    // the head always goes, followed by the same shape requests in arrival order
+    std::list<ServerRequest*>::iterator it = queue.begin();
+    ServerRequest* head = *it;
+    requests.push_back(head);
+    int batch = head->batch;
+    it = queue.erase(it);
+
+    while (it != queue.end() && batch < opt.max_batch_size)
+    {
+        ServerRequest* r = *it;
+        if (same_shape(head, r) && batch + r->batch <= opt.max_batch_size)
+        {
+            requests.push_back(r);
+            batch += r->batch;
+            it = queue.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    queued -= (int)requests.size();
+
+    if (opt.max_queue_size > 0)
+        space_condition.broadcast();
+
+    return true;
+}
+
+int InferenceServerPrivate::run(std::vector<ServerRequest*>& requests, Allocator* blob_allocator, Allocator* workspace_allocator, std::vector<std::vector<Mat> >& outputs) const
+{
+    const size_t request_count = requests.size();
+
+    int batch = 0;
+    for (size_t i = 0; i < request_count; i++)
+    {
+        batch += requests[i]->batch;
+    }
+
+    Extractor ex = net.create_extractor();
+    ex.set_blob_allocator(blob_allocator);
+    ex.set_workspace_allocator(workspace_allocator);
+
+    for (size_t i = 0; i < input_indexes.size(); i++)
+    {
+        if (request_count == 1)
+        {
+            ex.input(input_indexes[i], requests[0]->inputs[i]);
+            continue;
+        }
+
+        // gather the requests into one batched blob
+        const Mat& m0 = requests[0]->inputs[i];
+
+        Mat in;
+        in.create_like(m0, batch, blob_allocator);
+        if (in.empty())
+            return -100;
+
+        const size_t size = m0.total() * m0.elemsize;
+
+        int b = 0;
+        for (size_t j = 0; j < request_count; j++)
+        {
+            const Mat& m = requests[j]->inputs[i];
+            for (int k = 0; k < requests[j]->batch; k++)
+            {
+                memcpy(in.batch(b), m.batch(k), size);
+                b++;
+            }
+        }
+
+        ex.input(input_indexes[i], in);
+    }
+
+    outputs.resize(request_count);
+    for (size_t j = 0; j < request_count; j++)
+    {
+        outputs[j].resize(output_indexes.size());
+    }
+
+    for (size_t i = 0; i < output_indexes.size(); i++)
+    {
+        Mat out;
+        int ret = ex.extract(output_indexes[i], out);
+        if (ret != 0)
+            return ret;
+
+        // scatter to the requests, detached from the lane allocators
+        int b = 0;
+        for (size_t j = 0; j < request_count; j++)
+        {
+            const int n = requests[j]->batch;
+            if (request_count == 1 || out.n != batch)
+            {
+                outputs[j][i] = out.clone();
+            }
+            else if (n == 1)
+            {
+                outputs[j][i] = out.batch(b).clone();
+            }
+            else
+            {
+                outputs[j][i] = out.batch_range(b, n).clone();
+            }
+
+            if (outputs[j][i].empty())
+                return -100;
+
+            b += n;
+        }
+    }
+
+    return 0;
+}
+
+void InferenceServerPrivate::record(const std::vector<ServerRequest*>& requests, int ret, double finish_time)
+{
+    batches++;
+
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+        if (ret != 0)
+        {
+            failed++;
+            continue;
+        }
+
+        // requests submitted before reset_stats are not counted
+        if (requests[i]->submit_time < stats_start_time)
+            continue;
+
+        const double latency = finish_time - requests[i]->submit_time;
+
+        completed++;
+        latency_sum += latency;
+        latency_max = std::max(latency_max, latency);
+        latency_histogram[latency_bucket(latency)]++;
+    }
+}
+
+void InferenceServerPrivate::lane_loop(int lane_id)
+{
+    if (!lane_masks.empty())
+    {
+        set_cpu_thread_affinity(lane_masks[lane_id]);
+    }
+
+    // the lane thread allocates blobs alone, the openmp team shares the workspace
+    UnlockedPoolAllocator blob_allocator;
+    PoolAllocator workspace_allocator;
+
+    std::vector<ServerRequest*> requests;
+    std::vector<std::vector<Mat> > outputs;
+
+    for (;;)
+    {
+        requests.clear();
+
+        lock.lock();
+        bool has_work = collect(requests);
+        if (has_work)
+            running += (int)requests.size();
+        lock.unlock();
+
+        if (!has_work)
+            break;
+
+        outputs.clear();
+        int ret = run(requests, &blob_allocator, &workspace_allocator, outputs);
+
+        const double finish_time = get_current_time();
+
+        lock.lock();
+        running -= (int)requests.size();
+        record(requests, ret, finish_time);
+        lock.unlock();
+
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            ServerRequest* r = requests[i];
+
+            std::vector<Mat> request_outputs;
+            if (ret == 0)
+                request_outputs = outputs[i];
+
+            if (r->callback)
+                r->callback(ret, request_outputs, r->userdata);
+
+            delete r;
+        }
+    }
+}
+
+InferenceServer::InferenceServer()
+    : d(new InferenceServerPrivate)
+{
+}
+
+InferenceServer::~InferenceServer()
+{
+    stop();
+
+    delete d;
+}
+
+InferenceServer::InferenceServer(const InferenceServer&)
+    : d(0)
+{
+}
+
+InferenceServer& InferenceServer::operator=(const InferenceServer&)
+{
+    return *this;
+}
+
+Net& InferenceServer::net()
+{
+    return d->net;
+}
+
+const Net& InferenceServer::net() const
+{
+    return d->net;
+}
+
+int InferenceServer::start(const ServerOption& opt)
+{
+    return start(opt, d->net.input_indexes(), d->net.output_indexes());
+}
+
+int InferenceServer::start(const ServerOption& _opt, const std::vector<int>& input_indexes, const std::vector<int>& output_indexes)
+{
+    if (d->started)
+    {
+        NCNN_LOGE("server already started");
+        return -1;
+    }
+
+    if (input_indexes.empty() || output_indexes.empty())
+    {
+        NCNN_LOGE("server needs at least one input and one output blob");
+        return -1;
+    }
+
+    d->opt = _opt;
+    d->opt.num_lanes = std::max(d->opt.num_lanes, 1);
+    d->opt.num_threads = std::max(d->opt.num_threads, 1);
+    d->opt.max_batch_size = std::max(d->opt.max_batch_size, 1);
+#if !NCNN_BATCH
+    d->opt.max_batch_size = 1;
+#endif
+
+    d->input_indexes = input_indexes;
+    d->output_indexes = output_indexes;
+
+    // split cores evenly, leftover cores stay with the first lanes
+    const int num_lanes = d->opt.num_lanes;
+    const int lane_threads = std::max(d->opt.num_threads / num_lanes, 1);
+    d->net.opt.num_threads = lane_threads;
+
+    d->lane_masks.clear();
+    if (d->opt.use_lane_affinity && num_lanes > 1)
+    {
+        const CpuSet& mask = get_cpu_thread_affinity_mask(0);
+
+        std::vector<int> cpus;
+        for (int i = 0; i < get_cpu_count(); i++)
+        {
+            if (mask.is_enabled(i))
+                cpus.push_back(i);
+        }
+
+        const int used_cpus = std::min(d->opt.num_threads, (int)cpus.size());
+        if (used_cpus >= num_lanes)
+        {
+            d->lane_masks.resize(num_lanes);
+            for (int i = 0; i < num_lanes; i++)
+            {
+                d->lane_masks[i].disable_all();
+                for (int j = used_cpus * i / num_lanes; j < used_cpus * (i + 1) / num_lanes; j++)
+                {
+                    d->lane_masks[i].enable(cpus[j]);
+                }
+            }
+        }
+    }
+
+    d->quit = false;
+    d->started = true;
+    reset_stats();
+
+    d->lanes.resize(num_lanes);
+    for (int i = 0; i < num_lanes; i++)
+    {
+        LaneArgs* la = new LaneArgs;
+        la->d = d;
+        la->lane_id = i;
+        d->lanes[i] = new Thread(InferenceServerPrivate::lane_entry, la);
+    }
+
+    return 0;
+}
+
+void InferenceServer::stop()
+{
+    if (!d->started)
+        return;
+
+    d->lock.lock();
+    d->quit = true;
+    d->condition.broadcast();
+    d->space_condition.broadcast();
+    d->lock.unlock();
+
+    for (size_t i = 0; i < d->lanes.size(); i++)
+    {
+        d->lanes[i]->join();
+        delete d->lanes[i];
+    }
+    d->lanes.clear();
+
+    d->started = false;
+}
+
+struct InferWaiter
+{
+    Mutex lock;
+    ConditionVariable condition;
+    bool done;
+    int ret;
+    std::vector<Mat>* outputs;
+};
+
+static void infer_callback(int ret, std::vector<Mat>& outputs, void* userdata)
+{
+    InferWaiter* w = (InferWaiter*)userdata;
+
+    w->lock.lock();
+    w->ret = ret;
+    *w->outputs = outputs;
+    w->done = true;
+    w->condition.signal();
+    w->lock.unlock();
+}
+
+int InferenceServer::infer(const std::vector<Mat>& inputs, std::vector<Mat>& outputs)
+{
+    InferWaiter w;
+    w.done = false;
+    w.ret = 0;
+    w.outputs = &outputs;
+
+    int ret = submit(inputs, infer_callback, &w);
+    if (ret != 0)
+        return ret;
+
+    w.lock.lock();
+    while (!w.done)
+    {
+        w.condition.wait(w.lock);
+    }
+    w.lock.unlock();
+
+    return w.ret;
+}
+
+int InferenceServer::submit(const std::vector<Mat>& inputs, server_callback_func callback, void* userdata)
+{
+    if (inputs.size() != d->input_indexes.size())
+    {
+        NCNN_LOGE("server expects %d inputs but got %d", (int)d->input_indexes.size(), (int)inputs.size());
+        return -1;
+    }
+
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        if (inputs[i].empty() || inputs[i].n != inputs[0].n)
+        {
+            NCNN_LOGE("server input %d is empty or has mismatched batch count", (int)i);
+            return -1;
+        }
+    }
+
+    ServerRequest* r = new ServerRequest;
+    r->inputs = inputs;
+    r->batch = inputs[0].n;
+    r->callback = callback;
+    r->userdata = userdata;
+
+    d->lock.lock();
+
+    while (d->started && !d->quit && d->opt.max_queue_size > 0 && d->queued >= d->opt.max_queue_size)
+    {
+        d->space_condition.wait(d->lock);
+    }
+
+    if (!d->started || d->quit)
+    {
+        d->lock.unlock();
+        delete r;
+        NCNN_LOGE("server not running");
+        return -1;
+    }
+
+    r->submit_time = get_current_time();
+    d->queue.push_back(r);
+    d->queued++;
+    d->condition.signal();
+
+    d->lock.unlock();
+
+    return 0;
+}
+
+ServerStats InferenceServer::stats() const
+{
+    ServerStats s;
+
+    MutexLockGuard guard(d->lock);
+
+    s.completed = d->completed;
+    s.failed = d->failed;
+    s.batches = d->batches;
+    s.elapsed = get_current_time() - d->stats_start_time;
+    s.throughput = s.elapsed > 0.0 ? s.completed * 1000.0 / s.elapsed : 0.0;
+    s.avg_batch_size = s.batches > 0 ? (double)(s.completed + s.failed) / s.batches : 0.0;
+    s.latency_avg = s.completed > 0 ? d->latency_sum / s.completed : 0.0;
+    s.latency_max = d->latency_max;
+    s.queued = d->queued;
+    s.running = d->running;
+
+    if (s.completed > 0)
+    {
+        // ranks of the percentiles, 1-based
+        const int rank50 = std::max((int)(s.completed * 0.50 + 0.5), 1);
+        const int rank99 = std::max((int)(s.completed * 0.99 + 0.5), 1);
+
+        int count = 0;
+        for (int b = 0; b < NCNN_SERVER_LATENCY_BUCKETS; b++)
+        {
+            const int c = d->latency_histogram[b];
+            if (c == 0)
+                continue;
+
+            if (count < rank50 && count + c >= rank50)
+                s.latency_p50 = std::min(latency_bucket_value(b), s.latency_max);
+            if (count < rank99 && count + c >= rank99)
+                s.latency_p99 = std::min(latency_bucket_value(b), s.latency_max);
+
+            count += c;
+        }
+    }
+
+    return s;
+}
+
+void InferenceServer::reset_stats()
+{
+    MutexLockGuard guard(d->lock);
+
+    d->stats_start_time = get_current_time();
+    d->completed = 0;
+    d->failed = 0;
+    d->batches = 0;
+    d->latency_sum = 0.0;
+    d->latency_max = 0.0;
+    for (int i = 0; i < NCNN_SERVER_LATENCY_BUCKETS; i++)
+    {
+        d->latency_histogram[i] = 0;
+    }
+}
+
+} // namespace ncnn
+
+#endif // NCNN_THREADS
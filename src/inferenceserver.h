@@ -0,0 +1,132 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef NCNN_INFERENCESERVER_H
+#define NCNN_INFERENCESERVER_H
+
+#include "platform.h"
+
+#include "mat.h"
+#include "net.h"
+
+#if NCNN_THREADS
+
+namespace ncnn {
+
+class NCNN_EXPORT ServerOption
+{
+public:
+    // default option
+    ServerOption();
+
+public:
+    // number of batches running at the same time
+    // every lane owns one extractor thread and an equal share of num_threads
+    int num_lanes;
+
+    // cpu threads shared by all lanes
+    // default to the number of physical big cores
+    int num_threads;
+
+    // bind each lane and its openmp team on a disjoint slice of cpus
+    bool use_lane_affinity;
+
+    // queued requests with the same input shapes are merged into one Mat with batch count n
+    // 1 = no batching
+    int max_batch_size;
+
+    // the oldest queued request waits at most this long for others to join its batch
+    int max_batch_delay_us;
+
+    // submit blocks while this many requests are queued
+    // 0 = unlimited
+    int max_queue_size;
+};
+
+class NCNN_EXPORT ServerStats
+{
+public:
+    ServerStats();
+
+public:
+    // counters since start or reset_stats
+    int completed;
+    int failed;
+    int batches;
+
+    // in ms
+    double elapsed;
+
+    // completed requests per second
+    double throughput;
+
+    // requests per batch
+    double avg_batch_size;
+
+    // from submit to completion, in ms
+    // percentiles are accurate to about 5%
+    double latency_avg;
+    double latency_p50;
+    double latency_p99;
+    double latency_max;
+
+    // requests waiting in queue or running right now
+    int queued;
+    int running;
+};
+
+// called on a lane thread once the request finished
+// outputs follow the order of output blobs and do not share memory with the batch
+typedef void (*server_callback_func)(int ret, std::vector<Mat>& outputs, void* userdata);
+
+class InferenceServerPrivate;
+class NCNN_EXPORT InferenceServer
+{
+public:
+    InferenceServer();
+    // stop and destroy
+    virtual ~InferenceServer();
+
+    // the served network, load param and model before start
+    // opt.num_threads is replaced by the per-lane share on start
+    Net& net();
+    const Net& net() const;
+
+    // launch the lanes
+    // requests feed the net input blobs and extract the net output blobs
+    // return 0 if success
+    int start(const ServerOption& opt);
+
+    // launch the lanes with explicit input and output blob indexes
+    // return 0 if success
+    int start(const ServerOption& opt, const std::vector<int>& input_indexes, const std::vector<int>& output_indexes);
+
+    // finish the queued requests and join the lanes
+    void stop();
+
+    // run one request and wait for the outputs
+    // safe to call from any number of threads
+    // inputs follow the order of input blobs, all with the same batch count n
+    // return 0 if success
+    int infer(const std::vector<Mat>& inputs, std::vector<Mat>& outputs);
+
+    // queue one request and return without waiting
+    // return 0 if queued
+    int submit(const std::vector<Mat>& inputs, server_callback_func callback, void* userdata = 0);
+
+    ServerStats stats() const;
+    void reset_stats();
+
+private:
+    InferenceServer(const InferenceServer&);
+    InferenceServer& operator=(const InferenceServer&);
+
+private:
+    InferenceServerPrivate* const d;
+};
+
+} // namespace ncnn
+
+#endif // NCNN_THREADS
+
+#endif // NCNN_INFERENCESERVER_H
@@ -256,6 +256,9 @@ public:
             support_tensor_storage = layer_vulkan->support_tensor_storage;
             support_vulkan_packing = layer_vulkan->support_vulkan_packing;
             support_vulkan_any_packing = layer_vulkan->support_vulkan_any_packing;
+
+            // batch support of the cpu implementation does not carry over to gpu
+            support_batch = layer_vulkan->support_batch;
         }
 #endif
     }
@@ -268,6 +268,28 @@ int MultiHeadAttention::create_or_grow_kvcache(const Mat& cache, Mat& new_cache,
         }
     }
 
+    // the caller preallocated the output, such as one sequence slot of a batched cache
+    if (opt.kvcache_allocator && !new_cache.empty() && new_cache.allocator == allocator && new_cache.dims == 3 && new_cache.w == head_dim && new_cache.c == num_kv_head && new_cache.elemsize == elemsize && new_cache.elempack == elempack)
+    {
+        const int capacity = (int)(new_cache.cstep / new_cache.w);
+        if (new_seqlen <= capacity)
+        {
+            if (!cache.empty() && cache.data != new_cache.data)
+            {
+                const size_t valid_head_size = (size_t)cache.w * cache.h * cache.elemsize;
+                for (int q = 0; q < cache.c; q++)
+                {
+                    const unsigned char* src = (const unsigned char*)cache.data + cache.cstep * q * cache.elemsize;
+                    unsigned char* dst = (unsigned char*)new_cache.data + new_cache.cstep * q * new_cache.elemsize;
+                    memcpy(dst, src, valid_head_size);
+                }
+            }
+
+            new_cache.h = new_seqlen;
+            return 0;
+        }
+    }
+
     int capacity = new_seqlen > 0 ? new_seqlen : 1;
     if (opt.kvcache_allocator)
     {
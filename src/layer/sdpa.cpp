@@ -68,6 +68,28 @@ int SDPA::create_or_grow_kvcache(const Mat& cache, Mat& new_cache, int new_seqle
         }
     }
 
+    // the caller preallocated the output, such as one sequence slot of a batched cache
+    if (opt.kvcache_allocator && !new_cache.empty() && new_cache.allocator == allocator && new_cache.dims == 3 && new_cache.w == head_dim && new_cache.c == num_kv_head && new_cache.elemsize == elemsize && new_cache.elempack == elempack)
+    {
+        const int capacity = (int)(new_cache.cstep / new_cache.w);
+        if (new_seqlen <= capacity)
+        {
+            if (!cache.empty() && cache.data != new_cache.data)
+            {
+                const size_t valid_head_size = (size_t)cache.w * cache.h * cache.elemsize;
+                for (int q = 0; q < cache.c; q++)
+                {
+                    const unsigned char* src = (const unsigned char*)cache.data + cache.cstep * q * cache.elemsize;
+                    unsigned char* dst = (unsigned char*)new_cache.data + new_cache.cstep * q * new_cache.elemsize;
+                    memcpy(dst, src, valid_head_size);
+                }
+            }
+
+            new_cache.h = new_seqlen;
+            return 0;
+        }
+    }
+
     int capacity = new_seqlen > 0 ? new_seqlen : 1;
     if (opt.kvcache_allocator)
     {
@@ -98,6 +120,109 @@ int SDPA::create_or_grow_kvcache(const Mat& cache, Mat& new_cache, int new_seqle
     return 0;
 }
 
+bool SDPA::is_paged_kvcache(const Mat& cache, const Option& opt)
+{
+    if (opt.kvcache_block_seqlen <= 0 || !opt.kvcache_allocator || cache.empty() || cache.allocator != opt.kvcache_allocator)
+        return false;
+
+    return ((const PagedKVCacheAllocator*)opt.kvcache_allocator)->is_table(cache.data);
+}
+
+int SDPA::create_or_grow_paged_kvcache(const Mat& cache, Mat& new_cache, int new_seqlen, int num_kv_head, int head_dim, size_t elemsize, int elempack, const Option& opt) const
+{
+    PagedKVCacheAllocator* allocator = (PagedKVCacheAllocator*)opt.kvcache_allocator;
+
+    const int block_seqlen = allocator->block_seqlen();
+    const int block_count = (new_seqlen + block_seqlen - 1) / block_seqlen;
+    const size_t block_size = (size_t)num_kv_head * block_seqlen * head_dim * elemsize;
+
+    const bool cache_is_paged = is_paged_kvcache(cache, opt);
+
+    PagedKVCacheTable* table = cache_is_paged ? (PagedKVCacheTable*)cache.data : 0;
+    if (!table || table->max_block_count < block_count)
+    {
+        // only the block table is reallocated, the blocks are shared
+        const int current_capacity = table ? table->max_block_count * block_seqlen : 0;
+        const int capacity = kvcache_capacity(current_capacity, new_seqlen, opt.kvcache_max_seqlen_hint);
+        const int max_block_count = std::max((capacity + block_seqlen - 1) / block_seqlen, block_count);
+
+        PagedKVCacheTable* new_table = table ? allocator->table_fork(table, (cache.h + block_seqlen - 1) / block_seqlen, max_block_count) : allocator->table_alloc(max_block_count);
+        if (!new_table)
+            return -100;
+
+        new_table->block_size = block_size;
+
+        table = new_table;
+
+        Mat m;
+        m.data = table;
+        m.refcount = &table->refcount;
+        m.elemsize = elemsize;
+        m.elempack = elempack;
+        m.allocator = allocator;
+        m.dims = 3;
+        m.w = head_dim;
+        m.h = 0;
+        m.d = 1;
+        m.c = num_kv_head;
+        m.cstep = (size_t)block_seqlen * head_dim;
+#if NCNN_BATCH
+        m.nstep = m.cstep * num_kv_head;
+#endif
+
+        new_cache = m;
+    }
+    else
+    {
+        new_cache = cache;
+    }
+
+    for (int i = table->block_count; i < block_count; i++)
+    {
+        void* block = allocator->block_alloc(block_size);
+        if (!block)
+            return -100;
+
+        table->blocks[i] = block;
+        table->block_count = i + 1;
+    }
+
+    // copy on write, the partially filled last block may be shared with a forked cache
+    const int past_seqlen = cache_is_paged ? cache.h : 0;
+    if (past_seqlen % block_seqlen != 0 && new_seqlen > past_seqlen)
+    {
+        const int i = past_seqlen / block_seqlen;
+        if (allocator->block_shared(table->blocks[i]))
+        {
+            void* block = allocator->block_alloc(block_size);
+            if (!block)
+                return -100;
+
+            memcpy(block, table->blocks[i], block_size);
+            allocator->block_release(table->blocks[i]);
+            table->blocks[i] = block;
+        }
+    }
+
+    if (!cache.empty() && !cache_is_paged)
+    {
+        // move a contiguous past into blocks once
+        for (int q = 0; q < cache.c; q++)
+        {
+            for (int y = 0; y < cache.h; y++)
+            {
+                const unsigned char* src = (const unsigned char*)cache.data + (cache.cstep * q + (size_t)cache.w * y) * cache.elemsize;
+                unsigned char* dst = (unsigned char*)table->blocks[y / block_seqlen] + (new_cache.cstep * q + (size_t)head_dim * (y % block_seqlen)) * elemsize;
+                memcpy(dst, src, (size_t)cache.w * cache.elemsize);
+            }
+        }
+    }
+
+    new_cache.h = new_seqlen;
+
+    return 0;
+}
+
 // refers to https://pytorch.org/docs/stable/generated/torch.nn.functional.scaled_dot_product_attention.html
 int SDPA::forward(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& top_blobs, const Option& opt) const
 {
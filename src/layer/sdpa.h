@@ -22,6 +22,11 @@ protected:
 
     int create_or_grow_kvcache(const Mat& cache, Mat& new_cache, int new_seqlen, int num_kv_head, int head_dim, size_t elemsize, int elempack, const Option& opt) const;
 
+    // paged kv cache with blocks from opt.kvcache_allocator, cstep is the head stride inside a block
+    static bool is_paged_kvcache(const Mat& cache, const Option& opt);
+
+    int create_or_grow_paged_kvcache(const Mat& cache, Mat& new_cache, int new_seqlen, int num_kv_head, int head_dim, size_t elemsize, int elempack, const Option& opt) const;
+
 #if NCNN_INT8
     int forward_int8(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& top_blobs, const Option& opt) const;
 #endif
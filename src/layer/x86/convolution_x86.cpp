@@ -18,9 +18,11 @@
 #include "x86_activation.h"
 #include "x86_usability.h"
 
+#include "autotunecache.h"
 #include "benchmark.h"
 #include "cpu.h"
 #include "layer_type.h"
+#include "weightcache.h"
 
 namespace ncnn {
 
@@ -73,6 +75,7 @@ Convolution_x86::Convolution_x86()
 
     activation = 0;
     nT = 0;
+    tuned_algorithm = Algorithm_Heuristic;
     convolution_dilation1 = 0;
 }
 
@@ -276,11 +279,38 @@ static bool test_prefer_winograd23(int num_input, int num_output, int w, int h)
     return false;
 }
 
+static void convolution_transform_kernel_packed_x86(const Mat& weight_data, Mat& weight_data_tm, int num_input, int num_output, int kernel_w, int kernel_h, int dilation_w, int dilation_h, int stride_w, int stride_h, int elempack, int out_elempack)
+{
+    if ((elempack == 16 && out_elempack == 1 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
+            || (elempack == 8 && out_elempack == 8 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
+            || (elempack == 8 && out_elempack == 8 && kernel_w == 2 && kernel_h == 2 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
+            || (elempack == 1 && out_elempack == 8 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
+            || (elempack == 1 && out_elempack == 8 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 2 && stride_h == 2)
+            || (elempack == 8 && out_elempack == 1 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
+            || (elempack == 1 && out_elempack == 4 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
+            || (elempack == 1 && out_elempack == 4 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 2 && stride_h == 2))
+    {
+        convolution_transform_kernel_packed_sse(weight_data, weight_data_tm, num_input, num_output, kernel_w, kernel_h, elempack, out_elempack);
+    }
+    else
+    {
+        convolution_transform_kernel_packed(weight_data, weight_data_tm, num_input, num_output, kernel_w, kernel_h);
+    }
+}
+
 int Convolution_x86::create_pipeline(const Option& opt)
 {
     if (dynamic_weight)
         return 0;
 
+    if (opt.weight_cache)
+        return create_pipeline_cached(opt);
+
+#if NCNN_BATCH
+    // dynamic weight keeps the per-sample fallback in net
+    support_batch = true;
+#endif
+
     activation = create_activation_layer(activation_type, activation_params, opt);
     nT = opt.num_threads;
 
@@ -365,6 +395,18 @@ int Convolution_x86::create_pipeline(const Option& opt)
     }
 #endif // __SSE2__
 
+    if (opt.autotune_cache && !bottom_shapes.empty() && bottom_shapes[0].dims == 3 && bottom_shapes[0].w > 0 && bottom_shapes[0].h > 0 && bottom_shapes[0].c == num_input)
+    {
+        int ret = create_pipeline_autotune(num_input, elempack, out_elempack, opt);
+        if (ret != 0)
+            return ret;
+
+        if (opt.lightmode)
+            weight_data.release();
+
+        return 0;
+    }
+
     bool prefer_winograd = (opt.use_winograd23_convolution || opt.use_winograd43_convolution || opt.use_winograd63_convolution) && (num_input > 8 || num_output > 8);
 
     if (opt.use_winograd_convolution && prefer_winograd && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
@@ -477,30 +519,193 @@ int Convolution_x86::create_pipeline(const Option& opt)
         return 0;
     }
 
-    if ((elempack == 16 && out_elempack == 1 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
-            || (elempack == 8 && out_elempack == 8 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
-            || (elempack == 8 && out_elempack == 8 && kernel_w == 2 && kernel_h == 2 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
-            || (elempack == 1 && out_elempack == 8 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
-            || (elempack == 1 && out_elempack == 8 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 2 && stride_h == 2)
-            || (elempack == 8 && out_elempack == 1 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
-            || (elempack == 1 && out_elempack == 4 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
-            || (elempack == 1 && out_elempack == 4 && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 2 && stride_h == 2))
+    convolution_transform_kernel_packed_x86(weight_data, weight_data_tm, num_input, num_output, kernel_w, kernel_h, dilation_w, dilation_h, stride_w, stride_h, elempack, out_elempack);
+
+    if (opt.lightmode)
+        weight_data.release();
+
+    return 0;
+}
+
+int Convolution_x86::create_pipeline_autotune(int num_input, int elempack, int out_elempack, const Option& opt)
+{
+    const Mat& shape = bottom_shapes[0];
+
+    std::vector<int> algorithms;
+    if (opt.use_winograd_convolution && (num_input > 8 || num_output > 8) && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
     {
-        convolution_transform_kernel_packed_sse(weight_data, weight_data_tm, num_input, num_output, kernel_w, kernel_h, elempack, out_elempack);
+        if (opt.use_winograd23_convolution)
+            algorithms.push_back(Algorithm_Winograd23);
+        if (opt.use_winograd43_convolution)
+            algorithms.push_back(Algorithm_Winograd43);
+        if (opt.use_winograd63_convolution)
+            algorithms.push_back(Algorithm_Winograd63);
     }
+    if (opt.use_sgemm_convolution || (kernel_w == 1 && kernel_h == 1))
+        algorithms.push_back(Algorithm_Sgemm);
+    algorithms.push_back(Algorithm_Packed);
+
+    char key[256];
+    sprintf(key, "Convolution_x86_fp32_%dx%dx%d_o%d_k%dx%d_d%dx%d_s%dx%d_p%d_%d_%d_%d_e%d_%d_t%d", shape.w, shape.h, num_input, num_output, kernel_w, kernel_h, dilation_w, dilation_h, stride_w, stride_h, pad_left, pad_right, pad_top, pad_bottom, elempack, out_elempack, nT);
+
+    int algorithm = 0;
+    if (opt.autotune_cache->query(key, &algorithm, 1) != 0 || std::find(algorithms.begin(), algorithms.end(), algorithm) == algorithms.end())
+    {
+        algorithm = algorithms[0];
+
+        if (algorithms.size() > 1)
+        {
+            Mat bottom_blob(shape.w, shape.h, num_input / elempack, 4u * elempack, elempack);
+            if (bottom_blob.empty())
+                return -100;
+
+            const int size = (int)bottom_blob.total() * elempack;
+            float* ptr = bottom_blob;
+            for (int i = 0; i < size; i++)
+            {
+                ptr[i] = (i % 19) * 0.1f - 0.9f;
+            }
+
+            double best_time = 0;
+            for (size_t i = 0; i < algorithms.size(); i++)
+            {
+                tuned_algorithm = algorithms[i];
+                transform_kernel_algorithm(algorithms[i], num_input, elempack, out_elempack, opt);
+
+                // the first run warms up cache and allocator, keep the fastest of the rest
+                double time = 0;
+                for (int j = 0; j < 4; j++)
+                {
+                    Mat top_blob;
+                    double start = get_current_time();
+                    int ret = forward(bottom_blob, top_blob, opt);
+                    double end = get_current_time();
+                    if (ret != 0)
+                        return ret;
+
+                    if (j == 1 || (j > 1 && end - start < time))
+                        time = end - start;
+                }
+
+                weight_data_tm.release();
+                weight_sgemm_data.release();
+                weight_winograd23_data.release();
+                weight_winograd43_data.release();
+                weight_winograd63_data.release();
+
+                if (i == 0 || time < best_time)
+                {
+                    best_time = time;
+                    algorithm = algorithms[i];
+                }
+            }
+        }
+
+        opt.autotune_cache->update(key, &algorithm, 1);
+    }
+
+    tuned_algorithm = algorithm;
+    transform_kernel_algorithm(algorithm, num_input, elempack, out_elempack, opt);
+
+    return 0;
+}
+
+void Convolution_x86::transform_kernel_algorithm(int algorithm, int num_input, int elempack, int out_elempack, const Option& opt)
+{
+    if (algorithm == Algorithm_Winograd23)
+        conv3x3s1_winograd23_transform_kernel(weight_data, weight_winograd23_data, num_input, num_output, opt);
+    else if (algorithm == Algorithm_Winograd43)
+        conv3x3s1_winograd43_transform_kernel(weight_data, weight_winograd43_data, num_input, num_output, opt);
+    else if (algorithm == Algorithm_Winograd63)
+        conv3x3s1_winograd63_transform_kernel(weight_data, weight_winograd63_data, num_input, num_output, opt);
+    else if (algorithm == Algorithm_Sgemm)
+        convolution_im2col_gemm_transform_kernel(weight_data, weight_sgemm_data, num_input, num_output, kernel_w, kernel_h, opt);
     else
+        convolution_transform_kernel_packed_x86(weight_data, weight_data_tm, num_input, num_output, kernel_w, kernel_h, dilation_w, dilation_h, stride_w, stride_h, elempack, out_elempack);
+}
+
+int Convolution_x86::create_pipeline_cached(const Option& opt)
+{
+    // raw weights, params and shape hints decide the prepared weights
+    int params[12] = {num_output, kernel_w, kernel_h, dilation_w, dilation_h, stride_w, stride_h, pad_left, pad_right, pad_top, pad_bottom, weight_data_size};
+    uint64_t fingerprint = WeightCache::fingerprint(Mat(12, (void*)params, 4u));
+    fingerprint = WeightCache::fingerprint(weight_data, fingerprint);
+#if NCNN_INT8
+    fingerprint = WeightCache::fingerprint(weight_data_int8_scales, fingerprint);
+    fingerprint = WeightCache::fingerprint(bottom_blob_int8_scales, fingerprint);
+#endif
+    if (!bottom_shapes.empty())
+        fingerprint = WeightCache::fingerprint(bottom_shapes[0], fingerprint);
+    if (!top_shapes.empty())
+        fingerprint = WeightCache::fingerprint(top_shapes[0], fingerprint);
+
+    // models sharing one cache are told apart by content
+    char key[256];
+    sprintf(key, "Convolution_x86_%016llx_%x_t%d", (unsigned long long)fingerprint, WeightCache::option_flags(opt), opt.num_threads);
+
+    std::vector<Mat> weights;
+    if (opt.weight_cache->query(key, weights) == 0 && weights.size() == 7)
     {
-        convolution_transform_kernel_packed(weight_data, weight_data_tm, num_input, num_output, kernel_w, kernel_h);
+#if NCNN_BATCH
+        support_batch = true;
+#endif
+
+        activation = create_activation_layer(activation_type, activation_params, opt);
+        nT = opt.num_threads;
+
+        weight_data_tm = weights[0];
+        weight_sgemm_data = weights[1];
+        weight_winograd23_data = weights[2];
+        weight_winograd43_data = weights[3];
+        weight_winograd63_data = weights[4];
+#if NCNN_INT8
+        scale_in_data = weights[5];
+#endif
+        tuned_algorithm = weights[6].empty() ? Algorithm_Heuristic : ((const int*)weights[6])[0];
+
+        if (opt.lightmode)
+            weight_data.release();
+
+        return 0;
     }
 
-    if (opt.lightmode)
-        weight_data.release();
+    Option opt1 = opt;
+    opt1.weight_cache = 0;
+
+    int ret = create_pipeline(opt1);
+    if (ret != 0)
+        return ret;
+
+    // the dilation fallback keeps its weights in the inner layer
+    if (convolution_dilation1)
+        return 0;
+
+    weights.resize(7);
+    weights[0] = weight_data_tm;
+    weights[1] = weight_sgemm_data;
+    weights[2] = weight_winograd23_data;
+    weights[3] = weight_winograd43_data;
+    weights[4] = weight_winograd63_data;
+#if NCNN_INT8
+    weights[5] = scale_in_data;
+#endif
+    if (tuned_algorithm != Algorithm_Heuristic)
+    {
+        weights[6].create(1, (size_t)4u);
+        if (weights[6].empty())
+            return -100;
+
+        ((int*)weights[6])[0] = tuned_algorithm;
+    }
+
+    opt.weight_cache->update(key, weights);
 
     return 0;
 }
 
 int Convolution_x86::destroy_pipeline(const Option& opt)
 {
+
     if (activation)
     {
         activation->destroy_pipeline(opt);
@@ -520,6 +725,11 @@ int Convolution_x86::destroy_pipeline(const Option& opt)
 
 int Convolution_x86::forward(const Mat& bottom_blob, Mat& top_blob, const Option& opt) const
 {
+#if NCNN_BATCH
+    if (bottom_blob.n > 1)
+        return forward_batch(bottom_blob, top_blob, opt);
+#endif
+
 #if NCNN_INT8
     if (opt.use_int8_inference && int8_scale_term)
     {
@@ -648,7 +858,11 @@ int Convolution_x86::forward(const Mat& bottom_blob, Mat& top_blob, const Option
 
     bool prefer_winograd = (opt.use_winograd23_convolution || opt.use_winograd43_convolution || opt.use_winograd63_convolution) && (num_input > 8 || num_output > 8);
 
-    if (opt.use_winograd_convolution && prefer_winograd && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1)
+    bool use_winograd = opt.use_winograd_convolution && prefer_winograd && kernel_w == 3 && kernel_h == 3 && dilation_w == 1 && dilation_h == 1 && stride_w == 1 && stride_h == 1;
+    if (tuned_algorithm)
+        use_winograd = tuned_algorithm <= Algorithm_Winograd63;
+
+    if (use_winograd)
     {
         bool prefer_winograd63 = test_prefer_winograd63(num_input, num_output, w, h);
         bool prefer_winograd23 = test_prefer_winograd23(num_input, num_output, w, h);
@@ -720,7 +934,11 @@ int Convolution_x86::forward(const Mat& bottom_blob, Mat& top_blob, const Option
     int l2_cache_size = get_cpu_level2_cache_size();
     bool prefer_sgemm = num_input * num_output * kernel_w * kernel_h * dilation_w * dilation_h * stride_w * stride_h * (int)sizeof(float) * 2 > l2_cache_size || (num_input > 16 || num_output > 16);
 
-    if ((opt.use_sgemm_convolution && prefer_sgemm) || (kernel_w == 1 && kernel_h == 1))
+    bool use_sgemm = (opt.use_sgemm_convolution && prefer_sgemm) || (kernel_w == 1 && kernel_h == 1);
+    if (tuned_algorithm)
+        use_sgemm = tuned_algorithm == Algorithm_Sgemm;
+
+    if (use_sgemm)
     {
         int _nT = nT ? nT : opt.num_threads;
         if (nT != 0 && opt.num_threads != nT)
@@ -852,6 +1070,98 @@ int Convolution_x86::forward(const Mat& bottom_blob, Mat& top_blob, const Option
     return 0;
 }
 
+#if NCNN_BATCH
+int Convolution_x86::forward_batch(const Mat& bottom_blob, Mat& top_blob, const Option& opt) const
+{
+    const int B = bottom_blob.n;
+
+    const bool is_pointwise = kernel_w == 1 && kernel_h == 1 && stride_w == 1 && stride_h == 1;
+    const bool no_padding = pad_left <= 0 && pad_right <= 0 && pad_top <= 0 && pad_bottom <= 0;
+
+    // larger spatial size already fills the gemm tiles on its own
+    const bool is_small_spatial = bottom_blob.w * bottom_blob.h <= 16;
+
+    if (bottom_blob.dims == 3 && is_pointwise && no_padding && is_small_spatial)
+    {
+        // lay the samples side by side so that the batch folds into the gemm N dimension
+        const int w = bottom_blob.w;
+        const int h = bottom_blob.h;
+        const int channels = bottom_blob.c;
+        const size_t elemsize = bottom_blob.elemsize;
+        const size_t size = (size_t)w * h * elemsize;
+
+        Option opt_b = opt;
+        opt_b.blob_allocator = opt.workspace_allocator;
+
+        Mat bottom_blob_stacked(w * h * B, 1, channels, elemsize, bottom_blob.elempack, opt.workspace_allocator);
+        if (bottom_blob_stacked.empty())
+            return -100;
+
+        #pragma omp parallel for num_threads(opt.num_threads)
+        for (int q = 0; q < channels; q++)
+        {
+            unsigned char* outptr = bottom_blob_stacked.channel(q);
+
+            for (int b = 0; b < B; b++)
+            {
+                memcpy(outptr + size * b, bottom_blob.batch(b).channel(q), size);
+            }
+        }
+
+        Mat top_blob_stacked;
+        int ret = forward(bottom_blob_stacked, top_blob_stacked, opt_b);
+        if (ret != 0)
+            return ret;
+
+        const int out_channels = top_blob_stacked.c;
+        const size_t out_elemsize = top_blob_stacked.elemsize;
+        const size_t out_size = (size_t)w * h * out_elemsize;
+
+        top_blob.create(w, h, out_channels, out_elemsize, top_blob_stacked.elempack, B, opt.blob_allocator);
+        if (top_blob.empty())
+            return -100;
+
+        #pragma omp parallel for num_threads(opt.num_threads)
+        for (int q = 0; q < out_channels; q++)
+        {
+            const unsigned char* ptr = top_blob_stacked.channel(q);
+
+            for (int b = 0; b < B; b++)
+            {
+                memcpy(top_blob.batch(b).channel(q), ptr + out_size * b, out_size);
+            }
+        }
+
+        return 0;
+    }
+
+    // forward sample by sample into the batch slots
+    for (int b = 0; b < B; b++)
+    {
+        Mat top_b;
+        if (b > 0)
+            top_b = top_blob.batch(b);
+
+        int ret = forward(bottom_blob.batch(b), top_b, opt);
+        if (ret != 0)
+            return ret;
+
+        if (b == 0)
+        {
+            top_blob.create_like(top_b, B, opt.blob_allocator);
+            if (top_blob.empty())
+                return -100;
+        }
+
+        Mat top_blob_b = top_blob.batch(b);
+        if (top_b.data != top_blob_b.data)
+            memcpy(top_blob_b, top_b, top_b.total() * top_b.elemsize);
+    }
+
+    return 0;
+}
+#endif // NCNN_BATCH
+
 int Convolution_x86::forward(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& top_blobs, const Option& opt) const
 {
     const Mat& bottom_blob = bottom_blobs[0];
@@ -30,11 +30,29 @@ protected:
     int forward_bf16s(const Mat& bottom_blob, Mat& top_blob, const Option& opt) const;
 #endif
     int forwardDilation_x86(const Mat& bottom_blob, Mat& top_blob, const Option& opt) const;
+#if NCNN_BATCH
+    int forward_batch(const Mat& bottom_blob, Mat& top_blob, const Option& opt) const;
+#endif
+    int create_pipeline_autotune(int num_input, int elempack, int out_elempack, const Option& opt);
+    void transform_kernel_algorithm(int algorithm, int num_input, int elempack, int out_elempack, const Option& opt);
+    int create_pipeline_cached(const Option& opt);
+
+    // fp32 kernels measured by autotune
+    enum
+    {
+        Algorithm_Heuristic = 0,
+        Algorithm_Winograd23 = 1,
+        Algorithm_Winograd43 = 2,
+        Algorithm_Winograd63 = 3,
+        Algorithm_Sgemm = 4,
+        Algorithm_Packed = 5
+    };
 
 public:
     Layer* activation;
 
     int nT;
+    int tuned_algorithm;
     Mat weight_data_tm;
     Mat weight_sgemm_data;
     Mat weight_winograd23_data;
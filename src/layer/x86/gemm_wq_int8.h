@@ -13790,3 +13790,552 @@ static void get_optimal_tile_mnk_wq_int8(int M, int N, int K, int block_size, in
             TILE_K = std::min(K, TILE_K);
     }
 }
+
+// 4-bit and 6-bit weights stay packed in memory and are unpacked in registers
+// every 32 k form a group, K is padded with zero weights to whole groups
+// 4-bit group  16 bytes, byte t holds q[t] + 8 in the low nibble and q[t + 16] + 8 in the high nibble
+// 6-bit group  16 bytes of the low 4 bits of q + 32 laid out as 4-bit, then 8 bytes where byte t holds the high 2 bits of q[t + 8 * s] + 32 at bit 2 * s
+static inline int get_wq_lowbit_group_bytes(int bits)
+{
+    return bits == 4 ? 16 : 24;
+}
+
+static inline int unpack_wq_lowbit_raw(const unsigned char* ptr, int k, int bits, int packed_k_bytes)
+{
+    const int bit_offset = k * bits;
+    const int byte_offset = bit_offset / 8;
+    const int bit_shift = bit_offset % 8;
+
+    unsigned int v = ptr[byte_offset];
+    if (byte_offset + 1 < packed_k_bytes)
+        v |= (unsigned int)ptr[byte_offset + 1] << 8;
+
+    const int mask = (1 << bits) - 1;
+    const int sign_bit = 1 << (bits - 1);
+    return (((v >> bit_shift) & mask) ^ sign_bit) - sign_bit;
+}
+
+static void pack_B_wq_lowbit(const Mat& B, const Mat& B_scales, Mat& BT, Mat& BT_descales, int j, int max_jj, int K, int bits)
+{
+    const int packed_k_bytes = (K * bits + 7) / 8;
+    const int group_count = (K + 31) / 32;
+    const int group_bytes = get_wq_lowbit_group_bytes(bits);
+    const int block_count = B_scales.w;
+    const int bias = 1 << (bits - 1);
+
+    for (int jj = 0; jj < max_jj; jj++)
+    {
+        const unsigned char* p0 = B.row<const unsigned char>(j + jj);
+        const float* scales = B_scales.row(j + jj);
+        unsigned char* pp = BT.row<unsigned char>(j + jj);
+        float* descales = BT_descales.row(j + jj);
+
+        for (int g = 0; g < group_count; g++)
+        {
+            unsigned char q[32];
+            for (int t = 0; t < 32; t++)
+            {
+                const int k = g * 32 + t;
+                q[t] = (unsigned char)((k < K ? unpack_wq_lowbit_raw(p0, k, bits, packed_k_bytes) : 0) + bias);
+            }
+
+            for (int t = 0; t < 16; t++)
+            {
+                pp[t] = (q[t] & 15) | ((q[t + 16] & 15) << 4);
+            }
+            if (bits == 6)
+            {
+                for (int t = 0; t < 8; t++)
+                {
+                    pp[16 + t] = (q[t] >> 4) | ((q[t + 8] >> 4) << 2) | ((q[t + 16] >> 4) << 4) | ((q[t + 24] >> 4) << 6);
+                }
+            }
+            pp += group_bytes;
+        }
+
+        for (int b = 0; b < block_count; b++)
+        {
+            descales[b] = 1.f / scales[b];
+        }
+    }
+}
+
+static void pack_A_wq_lowbit(const Mat& A, Mat& AT, const Mat& input_scales, int M, int K)
+{
+    // zero padded to whole groups, with input scales folded in
+    const size_t A_hstep = A.dims == 3 ? A.cstep : (size_t)A.w;
+    const int KK = AT.w;
+    const float* input_scale_ptr = input_scales;
+
+    for (int i = 0; i < M; i++)
+    {
+        const float* p0 = (const float*)A + i * A_hstep;
+        float* pp = AT.row(i);
+
+        int k = 0;
+        if (input_scale_ptr)
+        {
+            for (; k < K; k++)
+            {
+                pp[k] = p0[k] * input_scale_ptr[k];
+            }
+        }
+        else
+        {
+            for (; k < K; k++)
+            {
+                pp[k] = p0[k];
+            }
+        }
+        for (; k < KK; k++)
+        {
+            pp[k] = 0.f;
+        }
+    }
+}
+
+#if __SSE2__
+static NCNN_FORCEINLINE void unpack_B_group_wq_lowbit(const unsigned char* p, int bits, __m128i& _w0, __m128i& _w1)
+{
+    // q[0..15] in _w0 and q[16..31] in _w1
+    const __m128i _p = _mm_loadu_si128((const __m128i*)p);
+    const __m128i _mask = _mm_set1_epi8(15);
+    __m128i _lo = _mm_and_si128(_p, _mask);
+    __m128i _hi = _mm_and_si128(_mm_srli_epi16(_p, 4), _mask);
+    if (bits == 6)
+    {
+        const __m128i _h = _mm_loadl_epi64((const __m128i*)(p + 16));
+        const __m128i _mask3 = _mm_set1_epi8(3);
+        __m128i _h01 = _mm_unpacklo_epi64(_mm_and_si128(_h, _mask3), _mm_and_si128(_mm_srli_epi16(_h, 2), _mask3));
+        __m128i _h23 = _mm_unpacklo_epi64(_mm_and_si128(_mm_srli_epi16(_h, 4), _mask3), _mm_and_si128(_mm_srli_epi16(_h, 6), _mask3));
+        _lo = _mm_or_si128(_lo, _mm_slli_epi16(_h01, 4));
+        _hi = _mm_or_si128(_hi, _mm_slli_epi16(_h23, 4));
+    }
+    const __m128i _bias = _mm_set1_epi8(bits == 4 ? 8 : 32);
+    _w0 = _mm_sub_epi8(_lo, _bias);
+    _w1 = _mm_sub_epi8(_hi, _bias);
+}
+
+#if !__AVX__
+static NCNN_FORCEINLINE void cvt_B_group_wq_lowbit(const __m128i& _w, __m128& _f0, __m128& _f1, __m128& _f2, __m128& _f3)
+{
+#if __SSE4_1__
+    _f0 = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_w));
+    _f1 = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(_w, 4)));
+    _f2 = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(_w, 8)));
+    _f3 = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(_w, 12)));
+#else
+    __m128i _wl = _mm_srai_epi16(_mm_unpacklo_epi8(_w, _w), 8);
+    __m128i _wh = _mm_srai_epi16(_mm_unpackhi_epi8(_w, _w), 8);
+    _f0 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(_wl, _wl), 16));
+    _f1 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(_wl, _wl), 16));
+    _f2 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(_wh, _wh), 16));
+    _f3 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(_wh, _wh), 16));
+#endif // __SSE4_1__
+}
+#endif // !__AVX__
+
+#if __AVX__ && !__AVX512F__
+static NCNN_FORCEINLINE void cvt_B_group_wq_lowbit(const __m128i& _w, __m256& _f0, __m256& _f1)
+{
+#if __AVX2__
+    _f0 = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_w));
+    _f1 = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_unpackhi_epi64(_w, _w)));
+#else
+    _f0 = _mm256_cvtepi32_ps(combine4x2_epi32(_mm_cvtepi8_epi32(_w), _mm_cvtepi8_epi32(_mm_srli_si128(_w, 4))));
+    _f1 = _mm256_cvtepi32_ps(combine4x2_epi32(_mm_cvtepi8_epi32(_mm_srli_si128(_w, 8)), _mm_cvtepi8_epi32(_mm_srli_si128(_w, 12))));
+#endif // __AVX2__
+}
+#endif // __AVX__ && !__AVX512F__
+#endif // __SSE2__
+
+static void gemm_transB_wq_lowbit(const Mat& AT, const Mat& BT, const Mat& BT_descales, const Mat& C, Mat& top_blob, int broadcast_type_C, int bits, int block_size, float alpha, float beta, int nT)
+{
+    const int M = AT.h;
+    const int N = BT.h;
+    const int group_count = AT.w / 32;
+    const int group_bytes = get_wq_lowbit_group_bytes(bits);
+    const int block_groups = block_size / 32;
+    const int block_count = BT_descales.w;
+    const size_t out_hstep = top_blob.dims == 3 ? top_blob.cstep : (size_t)top_blob.w;
+    const float* pC = C;
+
+    // one weight row is unpacked once for up to 4 rows of A
+    #pragma omp parallel for num_threads(nT)
+    for (int j = 0; j < N; j++)
+    {
+        const unsigned char* pB0 = BT.row<const unsigned char>(j);
+        const float* descales = BT_descales.row(j);
+
+        float sums[4];
+
+        int i = 0;
+        for (; i + 3 < M; i += 4)
+        {
+            const float* pA0 = AT.row(i);
+            const float* pA1 = AT.row(i + 1);
+            const float* pA2 = AT.row(i + 2);
+            const float* pA3 = AT.row(i + 3);
+            const unsigned char* pB = pB0;
+
+#if __AVX512F__
+            __m512 _sum0 = _mm512_setzero_ps();
+            __m512 _sum1 = _mm512_setzero_ps();
+            __m512 _sum2 = _mm512_setzero_ps();
+            __m512 _sum3 = _mm512_setzero_ps();
+#elif __AVX__
+            __m256 _sum0 = _mm256_setzero_ps();
+            __m256 _sum1 = _mm256_setzero_ps();
+            __m256 _sum2 = _mm256_setzero_ps();
+            __m256 _sum3 = _mm256_setzero_ps();
+#elif __SSE2__
+            __m128 _sum0 = _mm_setzero_ps();
+            __m128 _sum1 = _mm_setzero_ps();
+            __m128 _sum2 = _mm_setzero_ps();
+            __m128 _sum3 = _mm_setzero_ps();
+#else
+            float sum0 = 0.f;
+            float sum1 = 0.f;
+            float sum2 = 0.f;
+            float sum3 = 0.f;
+#endif
+
+            int g = 0;
+            for (int b = 0; b < block_count; b++)
+            {
+                const int max_g = std::min(g + block_groups, group_count);
+
+#if __AVX512F__
+                __m512 _bsum0 = _mm512_setzero_ps();
+                __m512 _bsum1 = _mm512_setzero_ps();
+                __m512 _bsum2 = _mm512_setzero_ps();
+                __m512 _bsum3 = _mm512_setzero_ps();
+                for (; g < max_g; g++)
+                {
+                    __m128i _w0;
+                    __m128i _w1;
+                    unpack_B_group_wq_lowbit(pB, bits, _w0, _w1);
+                    __m512 _b0 = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_w0));
+                    __m512 _b1 = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_w1));
+                    _bsum0 = _mm512_fmadd_ps(_mm512_loadu_ps(pA0), _b0, _bsum0);
+                    _bsum1 = _mm512_fmadd_ps(_mm512_loadu_ps(pA1), _b0, _bsum1);
+                    _bsum2 = _mm512_fmadd_ps(_mm512_loadu_ps(pA2), _b0, _bsum2);
+                    _bsum3 = _mm512_fmadd_ps(_mm512_loadu_ps(pA3), _b0, _bsum3);
+                    _bsum0 = _mm512_fmadd_ps(_mm512_loadu_ps(pA0 + 16), _b1, _bsum0);
+                    _bsum1 = _mm512_fmadd_ps(_mm512_loadu_ps(pA1 + 16), _b1, _bsum1);
+                    _bsum2 = _mm512_fmadd_ps(_mm512_loadu_ps(pA2 + 16), _b1, _bsum2);
+                    _bsum3 = _mm512_fmadd_ps(_mm512_loadu_ps(pA3 + 16), _b1, _bsum3);
+                    pA0 += 32;
+                    pA1 += 32;
+                    pA2 += 32;
+                    pA3 += 32;
+                    pB += group_bytes;
+                }
+                __m512 _descale = _mm512_set1_ps(descales[b]);
+                _sum0 = _mm512_fmadd_ps(_bsum0, _descale, _sum0);
+                _sum1 = _mm512_fmadd_ps(_bsum1, _descale, _sum1);
+                _sum2 = _mm512_fmadd_ps(_bsum2, _descale, _sum2);
+                _sum3 = _mm512_fmadd_ps(_bsum3, _descale, _sum3);
+#elif __AVX__
+                __m256 _bsum0 = _mm256_setzero_ps();
+                __m256 _bsum1 = _mm256_setzero_ps();
+                __m256 _bsum2 = _mm256_setzero_ps();
+                __m256 _bsum3 = _mm256_setzero_ps();
+                for (; g < max_g; g++)
+                {
+                    __m128i _w0;
+                    __m128i _w1;
+                    unpack_B_group_wq_lowbit(pB, bits, _w0, _w1);
+                    __m256 _b0;
+                    __m256 _b1;
+                    __m256 _b2;
+                    __m256 _b3;
+                    cvt_B_group_wq_lowbit(_w0, _b0, _b1);
+                    cvt_B_group_wq_lowbit(_w1, _b2, _b3);
+                    _bsum0 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA0), _b0, _bsum0);
+                    _bsum1 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA1), _b0, _bsum1);
+                    _bsum2 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA2), _b0, _bsum2);
+                    _bsum3 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA3), _b0, _bsum3);
+                    _bsum0 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA0 + 8), _b1, _bsum0);
+                    _bsum1 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA1 + 8), _b1, _bsum1);
+                    _bsum2 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA2 + 8), _b1, _bsum2);
+                    _bsum3 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA3 + 8), _b1, _bsum3);
+                    _bsum0 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA0 + 16), _b2, _bsum0);
+                    _bsum1 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA1 + 16), _b2, _bsum1);
+                    _bsum2 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA2 + 16), _b2, _bsum2);
+                    _bsum3 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA3 + 16), _b2, _bsum3);
+                    _bsum0 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA0 + 24), _b3, _bsum0);
+                    _bsum1 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA1 + 24), _b3, _bsum1);
+                    _bsum2 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA2 + 24), _b3, _bsum2);
+                    _bsum3 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA3 + 24), _b3, _bsum3);
+                    pA0 += 32;
+                    pA1 += 32;
+                    pA2 += 32;
+                    pA3 += 32;
+                    pB += group_bytes;
+                }
+                __m256 _descale = _mm256_set1_ps(descales[b]);
+                _sum0 = _mm256_comp_fmadd_ps(_bsum0, _descale, _sum0);
+                _sum1 = _mm256_comp_fmadd_ps(_bsum1, _descale, _sum1);
+                _sum2 = _mm256_comp_fmadd_ps(_bsum2, _descale, _sum2);
+                _sum3 = _mm256_comp_fmadd_ps(_bsum3, _descale, _sum3);
+#elif __SSE2__
+                __m128 _bsum0 = _mm_setzero_ps();
+                __m128 _bsum1 = _mm_setzero_ps();
+                __m128 _bsum2 = _mm_setzero_ps();
+                __m128 _bsum3 = _mm_setzero_ps();
+                for (; g < max_g; g++)
+                {
+                    __m128i _w0;
+                    __m128i _w1;
+                    unpack_B_group_wq_lowbit(pB, bits, _w0, _w1);
+                    for (int q = 0; q < 2; q++)
+                    {
+                        __m128 _b0;
+                        __m128 _b1;
+                        __m128 _b2;
+                        __m128 _b3;
+                        cvt_B_group_wq_lowbit(q == 0 ? _w0 : _w1, _b0, _b1, _b2, _b3);
+                        _bsum0 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA0), _b0, _bsum0);
+                        _bsum1 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA1), _b0, _bsum1);
+                        _bsum2 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA2), _b0, _bsum2);
+                        _bsum3 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA3), _b0, _bsum3);
+                        _bsum0 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA0 + 4), _b1, _bsum0);
+                        _bsum1 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA1 + 4), _b1, _bsum1);
+                        _bsum2 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA2 + 4), _b1, _bsum2);
+                        _bsum3 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA3 + 4), _b1, _bsum3);
+                        _bsum0 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA0 + 8), _b2, _bsum0);
+                        _bsum1 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA1 + 8), _b2, _bsum1);
+                        _bsum2 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA2 + 8), _b2, _bsum2);
+                        _bsum3 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA3 + 8), _b2, _bsum3);
+                        _bsum0 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA0 + 12), _b3, _bsum0);
+                        _bsum1 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA1 + 12), _b3, _bsum1);
+                        _bsum2 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA2 + 12), _b3, _bsum2);
+                        _bsum3 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA3 + 12), _b3, _bsum3);
+                        pA0 += 16;
+                        pA1 += 16;
+                        pA2 += 16;
+                        pA3 += 16;
+                    }
+                    pB += group_bytes;
+                }
+                __m128 _descale = _mm_set1_ps(descales[b]);
+                _sum0 = _mm_comp_fmadd_ps(_bsum0, _descale, _sum0);
+                _sum1 = _mm_comp_fmadd_ps(_bsum1, _descale, _sum1);
+                _sum2 = _mm_comp_fmadd_ps(_bsum2, _descale, _sum2);
+                _sum3 = _mm_comp_fmadd_ps(_bsum3, _descale, _sum3);
+#else
+                float bsum0 = 0.f;
+                float bsum1 = 0.f;
+                float bsum2 = 0.f;
+                float bsum3 = 0.f;
+                for (; g < max_g; g++)
+                {
+                    for (int t = 0; t < 32; t++)
+                    {
+                        int u = (pB[t % 16] >> (t / 16 * 4)) & 15;
+                        if (bits == 6)
+                            u |= ((pB[16 + t % 8] >> (t / 8 * 2)) & 3) << 4;
+                        const float w = (float)(u - (bits == 4 ? 8 : 32));
+                        bsum0 += pA0[t] * w;
+                        bsum1 += pA1[t] * w;
+                        bsum2 += pA2[t] * w;
+                        bsum3 += pA3[t] * w;
+                    }
+                    pA0 += 32;
+                    pA1 += 32;
+                    pA2 += 32;
+                    pA3 += 32;
+                    pB += group_bytes;
+                }
+                sum0 += bsum0 * descales[b];
+                sum1 += bsum1 * descales[b];
+                sum2 += bsum2 * descales[b];
+                sum3 += bsum3 * descales[b];
+#endif
+            }
+
+#if __AVX512F__
+            sums[0] = _mm512_comp_reduce_add_ps(_sum0);
+            sums[1] = _mm512_comp_reduce_add_ps(_sum1);
+            sums[2] = _mm512_comp_reduce_add_ps(_sum2);
+            sums[3] = _mm512_comp_reduce_add_ps(_sum3);
+#elif __AVX__
+            sums[0] = _mm256_reduce_add_ps(_sum0);
+            sums[1] = _mm256_reduce_add_ps(_sum1);
+            sums[2] = _mm256_reduce_add_ps(_sum2);
+            sums[3] = _mm256_reduce_add_ps(_sum3);
+#elif __SSE2__
+            sums[0] = _mm_reduce_add_ps(_sum0);
+            sums[1] = _mm_reduce_add_ps(_sum1);
+            sums[2] = _mm_reduce_add_ps(_sum2);
+            sums[3] = _mm_reduce_add_ps(_sum3);
+#else
+            sums[0] = sum0;
+            sums[1] = sum1;
+            sums[2] = sum2;
+            sums[3] = sum3;
+#endif
+
+            for (int ii = 0; ii < 4; ii++)
+            {
+                float sum = sums[ii];
+                if (pC)
+                {
+                    float c = 0.f;
+                    if (broadcast_type_C == 0)
+                        c = pC[0];
+                    if (broadcast_type_C == 1 || broadcast_type_C == 2)
+                        c = pC[i + ii];
+                    if (broadcast_type_C == 3)
+                        c = pC[(i + ii) * N + j];
+                    if (broadcast_type_C == 4)
+                        c = pC[j];
+
+                    sum += c * beta;
+                }
+
+                top_blob[(i + ii) * out_hstep + j] = sum * alpha;
+            }
+        }
+        for (; i < M; i++)
+        {
+            const float* pA = AT.row(i);
+            const unsigned char* pB = pB0;
+
+            // the two halves of a group accumulate apart for a shorter dependency chain
+#if __AVX512F__
+            __m512 _sum0 = _mm512_setzero_ps();
+            __m512 _sum1 = _mm512_setzero_ps();
+#elif __AVX__
+            __m256 _sum0 = _mm256_setzero_ps();
+            __m256 _sum1 = _mm256_setzero_ps();
+#elif __SSE2__
+            __m128 _sum0 = _mm_setzero_ps();
+            __m128 _sum1 = _mm_setzero_ps();
+#else
+            float sum0 = 0.f;
+#endif
+
+            int g = 0;
+            for (int b = 0; b < block_count; b++)
+            {
+                const int max_g = std::min(g + block_groups, group_count);
+
+#if __AVX512F__
+                __m512 _bsum0 = _mm512_setzero_ps();
+                __m512 _bsum1 = _mm512_setzero_ps();
+                for (; g < max_g; g++)
+                {
+                    __m128i _w0;
+                    __m128i _w1;
+                    unpack_B_group_wq_lowbit(pB, bits, _w0, _w1);
+                    __m512 _b0 = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_w0));
+                    __m512 _b1 = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_w1));
+                    _bsum0 = _mm512_fmadd_ps(_mm512_loadu_ps(pA), _b0, _bsum0);
+                    _bsum1 = _mm512_fmadd_ps(_mm512_loadu_ps(pA + 16), _b1, _bsum1);
+                    pA += 32;
+                    pB += group_bytes;
+                }
+                __m512 _descale = _mm512_set1_ps(descales[b]);
+                _sum0 = _mm512_fmadd_ps(_bsum0, _descale, _sum0);
+                _sum1 = _mm512_fmadd_ps(_bsum1, _descale, _sum1);
+#elif __AVX__
+                __m256 _bsum0 = _mm256_setzero_ps();
+                __m256 _bsum1 = _mm256_setzero_ps();
+                for (; g < max_g; g++)
+                {
+                    __m128i _w0;
+                    __m128i _w1;
+                    unpack_B_group_wq_lowbit(pB, bits, _w0, _w1);
+                    __m256 _b0;
+                    __m256 _b1;
+                    __m256 _b2;
+                    __m256 _b3;
+                    cvt_B_group_wq_lowbit(_w0, _b0, _b1);
+                    cvt_B_group_wq_lowbit(_w1, _b2, _b3);
+                    _bsum0 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA), _b0, _bsum0);
+                    _bsum1 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA + 8), _b1, _bsum1);
+                    _bsum0 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA + 16), _b2, _bsum0);
+                    _bsum1 = _mm256_comp_fmadd_ps(_mm256_loadu_ps(pA + 24), _b3, _bsum1);
+                    pA += 32;
+                    pB += group_bytes;
+                }
+                __m256 _descale = _mm256_set1_ps(descales[b]);
+                _sum0 = _mm256_comp_fmadd_ps(_bsum0, _descale, _sum0);
+                _sum1 = _mm256_comp_fmadd_ps(_bsum1, _descale, _sum1);
+#elif __SSE2__
+                __m128 _bsum0 = _mm_setzero_ps();
+                __m128 _bsum1 = _mm_setzero_ps();
+                for (; g < max_g; g++)
+                {
+                    __m128i _w0;
+                    __m128i _w1;
+                    unpack_B_group_wq_lowbit(pB, bits, _w0, _w1);
+                    __m128 _b0;
+                    __m128 _b1;
+                    __m128 _b2;
+                    __m128 _b3;
+                    cvt_B_group_wq_lowbit(_w0, _b0, _b1, _b2, _b3);
+                    _bsum0 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA), _b0, _bsum0);
+                    _bsum1 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA + 4), _b1, _bsum1);
+                    _bsum0 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA + 8), _b2, _bsum0);
+                    _bsum1 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA + 12), _b3, _bsum1);
+                    cvt_B_group_wq_lowbit(_w1, _b0, _b1, _b2, _b3);
+                    _bsum0 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA + 16), _b0, _bsum0);
+                    _bsum1 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA + 20), _b1, _bsum1);
+                    _bsum0 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA + 24), _b2, _bsum0);
+                    _bsum1 = _mm_comp_fmadd_ps(_mm_loadu_ps(pA + 28), _b3, _bsum1);
+                    pA += 32;
+                    pB += group_bytes;
+                }
+                __m128 _descale = _mm_set1_ps(descales[b]);
+                _sum0 = _mm_comp_fmadd_ps(_bsum0, _descale, _sum0);
+                _sum1 = _mm_comp_fmadd_ps(_bsum1, _descale, _sum1);
+#else
+                float bsum0 = 0.f;
+                for (; g < max_g; g++)
+                {
+                    for (int t = 0; t < 32; t++)
+                    {
+                        int u = (pB[t % 16] >> (t / 16 * 4)) & 15;
+                        if (bits == 6)
+                            u |= ((pB[16 + t % 8] >> (t / 8 * 2)) & 3) << 4;
+                        bsum0 += pA[t] * (float)(u - (bits == 4 ? 8 : 32));
+                    }
+                    pA += 32;
+                    pB += group_bytes;
+                }
+                sum0 += bsum0 * descales[b];
+#endif
+            }
+
+#if __AVX512F__
+            float sum = _mm512_comp_reduce_add_ps(_mm512_add_ps(_sum0, _sum1));
+#elif __AVX__
+            float sum = _mm256_reduce_add_ps(_mm256_add_ps(_sum0, _sum1));
+#elif __SSE2__
+            float sum = _mm_reduce_add_ps(_mm_add_ps(_sum0, _sum1));
+#else
+            float sum = sum0;
+#endif
+
+            if (pC)
+            {
+                float c = 0.f;
+                if (broadcast_type_C == 0)
+                    c = pC[0];
+                if (broadcast_type_C == 1 || broadcast_type_C == 2)
+                    c = pC[i];
+                if (broadcast_type_C == 3)
+                    c = pC[i * N + j];
+                if (broadcast_type_C == 4)
+                    c = pC[j];
+
+                sum += c * beta;
+            }
+
+            top_blob[i * out_hstep + j] = sum * alpha;
+        }
+    }
+}
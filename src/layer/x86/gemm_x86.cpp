@@ -16,7 +16,10 @@
 #endif // __SSE2__
 #include "x86_usability.h"
 
+#include "autotunecache.h"
+#include "benchmark.h"
 #include "cpu.h"
+#include "weightcache.h"
 
 namespace ncnn {
 
@@ -38,6 +41,10 @@ Gemm_x86::Gemm_x86()
     support_bf16_storage = true;
 #endif // NCNN_BF16
 
+#if NCNN_BATCH
+    support_batch = true;
+#endif // NCNN_BATCH
+
     nT = 0;
 }
 
@@ -7434,11 +7441,16 @@ static int gemm_AT_BT_x86(const Mat& AT, const Mat& BT, const Mat& C, Mat& top_b
 
 int Gemm_x86::create_pipeline(const Option& opt)
 {
+    if (opt.weight_cache && (constantA || constantB || constantC))
+        return create_pipeline_cached(opt);
+
     if (weight_block_quantize)
     {
 #if NCNN_WEIGHT_QUANT
         if (weight_block_quantize_bits == 8)
             return create_pipeline_wq_int8(opt);
+
+        return create_pipeline_wq_lowbit(opt);
 #endif // NCNN_WEIGHT_QUANT
 
         return 0;
@@ -7505,46 +7517,9 @@ int Gemm_x86::create_pipeline(const Option& opt)
 
     if (constantB)
     {
-        const int N = constantN;
-        const int K = constantK;
-
-        int TILE_M, TILE_N, TILE_K;
-        get_optimal_tile_mnk(0, N, K, constant_TILE_M, constant_TILE_N, constant_TILE_K, TILE_M, TILE_N, TILE_K, opt.num_threads);
-
-        const int nn_N = (N + TILE_N - 1) / TILE_N;
-        const int nn_K = (K + TILE_K - 1) / TILE_K;
-
-        BT_data.create(TILE_K * TILE_N, nn_K, nn_N, 4u, (Allocator*)0);
-        if (BT_data.empty())
-            return -100;
-
-        const int nn_NK = nn_N * nn_K;
-        #pragma omp parallel for num_threads(opt.num_threads)
-        for (int ppjk = 0; ppjk < nn_NK; ppjk++)
-        {
-            const int ppj = ppjk / nn_K;
-            const int ppk = ppjk % nn_K;
-
-            const int j = ppj * TILE_N;
-            const int k = ppk * TILE_K;
-
-            const int max_jj = std::min((N - j), TILE_N);
-            const int max_kk = std::min((K - k), TILE_K);
-
-            Mat BT_tile = BT_data.channel(j / TILE_N).row_range(k / TILE_K, 1);
-
-            if (transB)
-            {
-                pack_B_tile(B_data, BT_tile, j, max_jj, k, max_kk);
-            }
-            else
-            {
-                transpose_pack_B_tile(B_data, BT_tile, j, max_jj, k, max_kk);
-            }
-        }
-
-        if (opt.lightmode)
-            B_data.release();
+        int ret = pack_BT_data(opt);
+        if (ret != 0)
+            return ret;
     }
 
     if (constantC && constant_broadcast_type_C != -1)
@@ -7593,16 +7568,279 @@ int Gemm_x86::create_pipeline(const Option& opt)
         nT = opt.num_threads;
     }
 
+    if (opt.autotune_cache && constantB && !constantA && constant_TILE_M == 0 && constant_TILE_N == 0 && constant_TILE_K == 0 && !bottom_shapes.empty() && bottom_shapes[0].dims == 2)
+    {
+        int ret = create_pipeline_autotune(opt);
+        if (ret != 0)
+            return ret;
+    }
+
+    if (constantB && opt.lightmode)
+        B_data.release();
+
+    return 0;
+}
+
+int Gemm_x86::create_pipeline_cached(const Option& opt)
+{
+    // raw weights, params and shape hints decide the prepared weights
+    float params[16] = {alpha, beta, (float)transA, (float)transB, (float)constantA, (float)constantB, (float)constantC, (float)constantM, (float)constantN, (float)constantK, (float)constant_broadcast_type_C, (float)quantize_term, (float)weight_block_quantize_bits, (float)constant_TILE_M, (float)constant_TILE_N, (float)constant_TILE_K};
+    uint64_t fingerprint = WeightCache::fingerprint(Mat(16, (void*)params, 4u));
+    fingerprint = WeightCache::fingerprint(A_data, fingerprint);
+    fingerprint = WeightCache::fingerprint(B_data, fingerprint);
+    fingerprint = WeightCache::fingerprint(C_data, fingerprint);
+#if NCNN_WEIGHT_QUANT
+    fingerprint = WeightCache::fingerprint(B_data_quantize_scales, fingerprint);
+#endif
+    if (!bottom_shapes.empty())
+        fingerprint = WeightCache::fingerprint(bottom_shapes[0], fingerprint);
+
+    // models sharing one cache are told apart by content
+    char key[256];
+    sprintf(key, "Gemm_x86_%016llx_%x_t%d", (unsigned long long)fingerprint, WeightCache::option_flags(opt), opt.num_threads);
+
+    std::vector<Mat> weights;
+    if (opt.weight_cache->query(key, weights) == 0 && weights.size() == 6)
+    {
+#if NCNN_INT8
+        if (quantize_term)
+        {
+            support_bf16_storage = false;
+        }
+#endif
+
+        AT_data = weights[0];
+        BT_data = weights[1];
+        CT_data = weights[2];
+#if NCNN_WEIGHT_QUANT
+        BT_data_wq_int8 = weights[3];
+        BT_data_wq_int8_descales = weights[4];
+#endif
+        if (!weights[5].empty())
+        {
+            const int* tiles = weights[5];
+            constant_TILE_M = tiles[0];
+            constant_TILE_N = tiles[1];
+            constant_TILE_K = tiles[2];
+        }
+
+        if (!weight_block_quantize)
+            nT = opt.num_threads;
+
+        if (opt.lightmode)
+        {
+            if (constantA)
+                A_data.release();
+            if (constantB)
+                B_data.release();
+            if (constantC && constant_broadcast_type_C != -1)
+                C_data.release();
+#if NCNN_WEIGHT_QUANT
+            if (weight_block_quantize)
+                B_data_quantize_scales.release();
+#endif
+        }
+
+        return 0;
+    }
+
+    Option opt1 = opt;
+    opt1.weight_cache = 0;
+
+    int ret = create_pipeline(opt1);
+    if (ret != 0)
+        return ret;
+
+    weights.resize(6);
+    weights[0] = AT_data;
+    weights[1] = BT_data;
+    weights[2] = CT_data;
+#if NCNN_WEIGHT_QUANT
+    weights[3] = BT_data_wq_int8;
+    weights[4] = BT_data_wq_int8_descales;
+#endif
+
+    // tiles picked by autotune
+    weights[5].create(3, (size_t)4u);
+    if (weights[5].empty())
+        return -100;
+
+    int* tiles = weights[5];
+    tiles[0] = constant_TILE_M;
+    tiles[1] = constant_TILE_N;
+    tiles[2] = constant_TILE_K;
+
+    opt.weight_cache->update(key, weights);
+
+    return 0;
+}
+
+int Gemm_x86::pack_BT_data(const Option& opt)
+{
+    const int N = constantN;
+    const int K = constantK;
+
+    int TILE_M, TILE_N, TILE_K;
+    get_optimal_tile_mnk(0, N, K, constant_TILE_M, constant_TILE_N, constant_TILE_K, TILE_M, TILE_N, TILE_K, opt.num_threads);
+
+    const int nn_N = (N + TILE_N - 1) / TILE_N;
+    const int nn_K = (K + TILE_K - 1) / TILE_K;
+
+    BT_data.create(TILE_K * TILE_N, nn_K, nn_N, 4u, (Allocator*)0);
+    if (BT_data.empty())
+        return -100;
+
+    const int nn_NK = nn_N * nn_K;
+    #pragma omp parallel for num_threads(opt.num_threads)
+    for (int ppjk = 0; ppjk < nn_NK; ppjk++)
+    {
+        const int ppj = ppjk / nn_K;
+        const int ppk = ppjk % nn_K;
+
+        const int j = ppj * TILE_N;
+        const int k = ppk * TILE_K;
+
+        const int max_jj = std::min((N - j), TILE_N);
+        const int max_kk = std::min((K - k), TILE_K);
+
+        Mat BT_tile = BT_data.channel(j / TILE_N).row_range(k / TILE_K, 1);
+
+        if (transB)
+        {
+            pack_B_tile(B_data, BT_tile, j, max_jj, k, max_kk);
+        }
+        else
+        {
+            transpose_pack_B_tile(B_data, BT_tile, j, max_jj, k, max_kk);
+        }
+    }
+
     return 0;
 }
 
+int Gemm_x86::create_pipeline_autotune(const Option& opt)
+{
+    const Mat& shape = bottom_shapes[0];
+
+    const int M = transA ? shape.w : shape.h;
+    const int N = constantN;
+    const int K = constantK;
+
+    if ((transA ? shape.h : shape.w) != K || M <= 0)
+        return 0;
+
+    char key[256];
+    sprintf(key, "Gemm_x86_fp32_m%d_n%d_k%d_ta%d_tb%d_t%d", M, N, K, transA, transB, nT);
+
+    int tiles[3];
+    if (opt.autotune_cache->query(key, tiles, 3) != 0)
+    {
+        int TILE_M, TILE_N, TILE_K;
+        get_optimal_tile_mnk(M, N, K, 0, 0, 0, TILE_M, TILE_N, TILE_K, nT);
+
+        // the heuristic tiles and their neighbours along each dimension
+        std::vector<int> candidates;
+        for (int i = 0; i < 7; i++)
+        {
+            int tile_m = i == 1 ? TILE_M * 2 : i == 2 ? TILE_M / 2 : TILE_M;
+            int tile_n = i == 3 ? TILE_N * 2 : i == 4 ? TILE_N / 2 : TILE_N;
+            int tile_k = i == 5 ? TILE_K * 2 : i == 6 ? TILE_K / 2 : TILE_K;
+
+            // resolve alignment, skip tiles larger than the whole matrix
+            int tm, tn, tk;
+            get_optimal_tile_mnk(M, N, K, tile_m, tile_n, tile_k, tm, tn, tk, nT);
+            if ((tm > TILE_M && TILE_M >= M) || (tn > TILE_N && TILE_N >= N) || (tk > TILE_K && TILE_K >= K))
+                continue;
+
+            bool duplicate = false;
+            for (size_t j = 0; j < candidates.size(); j += 3)
+            {
+                if (candidates[j] == tm && candidates[j + 1] == tn && candidates[j + 2] == tk)
+                    duplicate = true;
+            }
+            if (duplicate)
+                continue;
+
+            candidates.push_back(tm);
+            candidates.push_back(tn);
+            candidates.push_back(tk);
+        }
+
+        Mat A = transA ? Mat(M, K) : Mat(K, M);
+        if (A.empty())
+            return -100;
+
+        const int size = (int)A.total();
+        for (int i = 0; i < size; i++)
+        {
+            A[i] = (i % 23) * 0.1f - 1.1f;
+        }
+
+        std::vector<Mat> bottom_blobs(1, A);
+
+        double best_time = 0;
+        for (size_t i = 0; i < candidates.size(); i += 3)
+        {
+            constant_TILE_M = candidates[i];
+            constant_TILE_N = candidates[i + 1];
+            constant_TILE_K = candidates[i + 2];
+
+            int ret = pack_BT_data(opt);
+            if (ret != 0)
+                return ret;
+
+            // the first run warms up cache and allocator, keep the fastest of the rest
+            double time = 0;
+            for (int j = 0; j < 4; j++)
+            {
+                std::vector<Mat> top_blobs(1);
+                double start = get_current_time();
+                ret = forward(bottom_blobs, top_blobs, opt);
+                double end = get_current_time();
+                if (ret != 0)
+                    return ret;
+
+                if (j == 1 || (j > 1 && end - start < time))
+                    time = end - start;
+            }
+
+            // keep the heuristic tiles unless clearly beaten, timing noise is a few percent
+            if (i == 0 || time < best_time * 0.95)
+            {
+                best_time = time;
+                tiles[0] = candidates[i];
+                tiles[1] = candidates[i + 1];
+                tiles[2] = candidates[i + 2];
+            }
+        }
+
+        opt.autotune_cache->update(key, tiles, 3);
+    }
+
+    constant_TILE_M = tiles[0];
+    constant_TILE_N = tiles[1];
+    constant_TILE_K = tiles[2];
+
+    return pack_BT_data(opt);
+}
+
 int Gemm_x86::forward(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& top_blobs, const Option& opt) const
 {
+#if NCNN_BATCH
+    for (size_t i = 0; i < bottom_blobs.size(); i++)
+    {
+        if (bottom_blobs[i].n > 1)
+            return forward_batch(bottom_blobs, top_blobs, bottom_blobs[i].n, opt);
+    }
+#endif // NCNN_BATCH
+
     if (weight_block_quantize)
     {
 #if NCNN_WEIGHT_QUANT
         if (weight_block_quantize_bits == 8)
             return forward_wq_int8(bottom_blobs, top_blobs, opt);
+
+        return forward_wq_lowbit(bottom_blobs, top_blobs, opt);
 #endif
 
         return Gemm::forward(bottom_blobs, top_blobs, opt);
@@ -7813,6 +8051,141 @@ int Gemm_x86::forward(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& to
     return 0;
 }
 
+#if NCNN_BATCH
+int Gemm_x86::forward_batch(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& top_blobs, int batch, const Option& opt) const
+{
+    for (size_t i = 0; i < bottom_blobs.size(); i++)
+    {
+        if (bottom_blobs[i].n > 1 && bottom_blobs[i].n != batch)
+        {
+            NCNN_LOGE("gemm batch size mismatch, bottom %d has batch %d but expected %d", (int)i, bottom_blobs[i].n, batch);
+            return -1;
+        }
+    }
+
+    Option opt_b = opt;
+    opt_b.blob_allocator = opt.workspace_allocator;
+
+    const Mat& A = bottom_blobs[0];
+
+    // batched A against constant B, stack all samples along M and run one gemm
+    bool stack_M = !constantA && constantB && !transA && !output_transpose && !output_N1M;
+#if NCNN_WEIGHT_QUANT
+    // int8 block quantized weights quantize A per row, so stacked rows stay independent
+    stack_M = stack_M && (!weight_block_quantize || weight_block_quantize_bits == 8) && !quantize_term;
+#else
+    stack_M = stack_M && !weight_block_quantize && !quantize_term;
+#endif
+    stack_M = stack_M && bottom_blobs.size() == 1 && A.dims == 2;
+    stack_M = stack_M && (!constantC || constant_broadcast_type_C == 0 || constant_broadcast_type_C == 4);
+
+    if (stack_M)
+    {
+        const int M = A.h * A.elempack;
+        const size_t size = (size_t)A.w * A.h * A.elemsize;
+
+        std::vector<Mat> bottom_blobs_stacked(1);
+        bottom_blobs_stacked[0].create(A.w, A.h * batch, A.elemsize, A.elempack, opt.workspace_allocator);
+        if (bottom_blobs_stacked[0].empty())
+            return -100;
+
+        for (int b = 0; b < batch; b++)
+        {
+            memcpy((unsigned char*)bottom_blobs_stacked[0].data + size * b, A.batch(b), size);
+        }
+
+        std::vector<Mat> top_blobs_stacked(1);
+        int ret = forward(bottom_blobs_stacked, top_blobs_stacked, opt_b);
+        if (ret != 0)
+            return ret;
+
+        Mat top_blob_stacked = top_blobs_stacked[0];
+        const int N = top_blob_stacked.w;
+
+        // keep the packing a single sample would get
+        int out_elempack = 1;
+#if __SSE2__
+        if (opt.use_packing_layout)
+        {
+#if __AVX512F__
+            out_elempack = M % 16 == 0 ? 16 : M % 8 == 0 ? 8 : M % 4 == 0 ? 4 : 1;
+#elif __AVX__
+            out_elempack = M % 8 == 0 ? 8 : M % 4 == 0 ? 4 : 1;
+#else
+            out_elempack = M % 4 == 0 ? 4 : 1;
+#endif
+        }
+#endif // __SSE2__
+        if (output_elempack)
+            out_elempack = output_elempack;
+
+        if (top_blob_stacked.elempack != out_elempack)
+        {
+            Mat top_blob_stacked_packed;
+            convert_packing(top_blob_stacked, top_blob_stacked_packed, out_elempack, opt_b);
+            if (top_blob_stacked_packed.empty())
+                return -100;
+
+            top_blob_stacked = top_blob_stacked_packed;
+        }
+
+        const size_t out_elemsize = top_blob_stacked.elemsize;
+        const size_t out_size = (size_t)N * (M / out_elempack) * out_elemsize;
+
+        Mat& top_blob = top_blobs[0];
+        top_blob.create(N, M / out_elempack, out_elemsize, out_elempack, batch, opt.blob_allocator);
+        if (top_blob.empty())
+            return -100;
+
+        for (int b = 0; b < batch; b++)
+        {
+            memcpy(top_blob.batch(b), (const unsigned char*)top_blob_stacked.data + out_size * b, out_size);
+        }
+
+        return 0;
+    }
+
+    // forward sample by sample into the batch slots
+    for (int b = 0; b < batch; b++)
+    {
+        std::vector<Mat> bottom_blobs_b(bottom_blobs.size());
+        for (size_t i = 0; i < bottom_blobs.size(); i++)
+        {
+            bottom_blobs_b[i] = bottom_blobs[i].n > 1 ? bottom_blobs[i].batch(b) : bottom_blobs[i];
+        }
+
+        std::vector<Mat> top_blobs_b(top_blobs.size());
+        if (b > 0)
+        {
+            for (size_t i = 0; i < top_blobs.size(); i++)
+            {
+                top_blobs_b[i] = top_blobs[i].batch(b);
+            }
+        }
+
+        int ret = forward(bottom_blobs_b, top_blobs_b, opt);
+        if (ret != 0)
+            return ret;
+
+        for (size_t i = 0; i < top_blobs.size(); i++)
+        {
+            if (b == 0)
+            {
+                top_blobs[i].create_like(top_blobs_b[i], batch, opt.blob_allocator);
+                if (top_blobs[i].empty())
+                    return -100;
+            }
+
+            Mat top_blob_b = top_blobs[i].batch(b);
+            if (top_blobs_b[i].data != top_blob_b.data)
+                memcpy(top_blob_b, top_blobs_b[i], top_blobs_b[i].total() * top_blobs_b[i].elemsize);
+        }
+    }
+
+    return 0;
+}
+#endif // NCNN_BATCH
+
 #if NCNN_INT8
 static void compute_A_tile_int8_scales(const Mat& A, Mat& scales, float B_scale, Mat& out_descales, int i, int max_ii)
 {
@@ -9930,6 +10303,108 @@ int Gemm_x86::forward_wq_int8(const std::vector<Mat>& bottom_blobs, std::vector<
 
     return gemm_BT_x86_wq_int8(A, BT_data_wq_int8, BT_data_wq_int8_descales, B_data_input_scales, C, top_blob, broadcast_type_C, N, K, block_size, transA, output_transpose, alpha, beta, constant_TILE_M, constant_TILE_N, constant_TILE_K, opt.num_threads, output_elemtype, opt);
 }
+int Gemm_x86::create_pipeline_wq_lowbit(const Option& opt)
+{
+    const int N = constantN;
+    const int K = constantK;
+    const int bits = weight_block_quantize_bits;
+    const int block_size = weight_block_quantize_block_size;
+    const int block_count = (K + block_size - 1) / block_size;
+    const int group_count = (K + 31) / 32;
+
+    // stays at 4 or 6 bits per weight, only regrouped for simd unpacking
+    BT_data_wq_int8.create(group_count * get_wq_lowbit_group_bytes(bits), N, (size_t)1u, (Allocator*)0);
+    if (BT_data_wq_int8.empty())
+        return -100;
+
+    BT_data_wq_int8_descales.create(block_count, N, (size_t)4u, (Allocator*)0);
+    if (BT_data_wq_int8_descales.empty())
+        return -100;
+
+    const int nn_N = (N + 15) / 16;
+    #pragma omp parallel for num_threads(opt.num_threads)
+    for (int ppj = 0; ppj < nn_N; ppj++)
+    {
+        const int j = ppj * 16;
+        const int max_jj = std::min(N - j, 16);
+
+        pack_B_wq_lowbit(B_data, B_data_quantize_scales, BT_data_wq_int8, BT_data_wq_int8_descales, j, max_jj, K, bits);
+    }
+
+    if (opt.lightmode)
+    {
+        B_data.release();
+        B_data_quantize_scales.release();
+    }
+
+    return 0;
+}
+
+int Gemm_x86::forward_wq_lowbit(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& top_blobs, const Option& opt) const
+{
+    const Mat& A = bottom_blobs[0];
+
+    // packing, transA, output_transpose and output_N1M are rejected for 4-bit and 6-bit weights
+    const int K = A.w;
+    const int M = A.dims == 3 ? A.c : A.h;
+    const int N = constantN;
+
+    Mat C;
+    int broadcast_type_C = 0;
+    if (constantC)
+    {
+        C = C_data;
+        broadcast_type_C = constant_broadcast_type_C;
+    }
+    else
+    {
+        if (bottom_blobs.size() == 2)
+            C = bottom_blobs[1];
+
+        if (!C.empty())
+        {
+            if (C.dims == 1 && C.w == 1)
+            {
+                broadcast_type_C = 0;
+            }
+            if (C.dims == 1 && C.w == M)
+            {
+                broadcast_type_C = 1;
+            }
+            if (C.dims == 1 && C.w == N)
+            {
+                broadcast_type_C = 4;
+            }
+            if (C.dims == 2 && C.w == 1 && C.h == M)
+            {
+                broadcast_type_C = 2;
+            }
+            if (C.dims == 2 && C.w == N && C.h == M)
+            {
+                broadcast_type_C = 3;
+            }
+            if (C.dims == 2 && C.w == N && C.h == 1)
+            {
+                broadcast_type_C = 4;
+            }
+        }
+    }
+
+    Mat AT((K + 31) / 32 * 32, M, (size_t)4u, opt.workspace_allocator);
+    if (AT.empty())
+        return -100;
+
+    pack_A_wq_lowbit(A, AT, B_data_input_scales, M, K);
+
+    Mat& top_blob = top_blobs[0];
+    top_blob.create(N, M, (size_t)4u, opt.blob_allocator);
+    if (top_blob.empty())
+        return -100;
+
+    gemm_transB_wq_lowbit(AT, BT_data_wq_int8, BT_data_wq_int8_descales, C, top_blob, broadcast_type_C, weight_block_quantize_bits, weight_block_quantize_block_size, alpha, beta, opt.num_threads);
+
+    return 0;
+}
 #endif // NCNN_WEIGHT_QUANT
 
 } // namespace ncnn
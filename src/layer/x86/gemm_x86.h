@@ -18,6 +18,9 @@ public:
     virtual int forward(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& top_blobs, const Option& opt) const;
 
 protected:
+    int pack_BT_data(const Option& opt);
+    int create_pipeline_autotune(const Option& opt);
+    int create_pipeline_cached(const Option& opt);
 #if NCNN_BF16
     int create_pipeline_bf16s(const Option& opt);
     int forward_bf16s(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& top_blobs, const Option& opt) const;
@@ -29,6 +32,11 @@ protected:
 #if NCNN_WEIGHT_QUANT
     int create_pipeline_wq_int8(const Option& opt);
     int forward_wq_int8(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& top_blobs, const Option& opt) const;
+    int create_pipeline_wq_lowbit(const Option& opt);
+    int forward_wq_lowbit(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& top_blobs, const Option& opt) const;
+#endif
+#if NCNN_BATCH
+    int forward_batch(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& top_blobs, int batch, const Option& opt) const;
 #endif
 
 public:
@@ -37,6 +45,7 @@ public:
     Mat BT_data;
     Mat CT_data;
 #if NCNN_WEIGHT_QUANT
+    // int8 tiles, or 32-k groups of packed 4-bit and 6-bit weights
     Mat BT_data_wq_int8;
     Mat BT_data_wq_int8_descales;
 #endif
@@ -16,6 +16,7 @@
 #include "layer_type.h"
 
 #include "cpu.h"
+#include "weightcache.h"
 
 namespace ncnn {
 
@@ -44,11 +45,18 @@ InnerProduct_x86::InnerProduct_x86()
     support_bf16_storage = true;
 #endif
 
+#if NCNN_BATCH
+    support_batch = true;
+#endif
+
     flatten = 0;
 }
 
 int InnerProduct_x86::create_pipeline(const Option& opt)
 {
+    if (opt.weight_cache)
+        return create_pipeline_cached(opt);
+
     //     if (opt.use_packing_layout)
     {
         flatten = ncnn::create_layer_cpu(ncnn::LayerType::Flatten);
@@ -91,6 +99,60 @@ int InnerProduct_x86::create_pipeline(const Option& opt)
     return 0;
 }
 
+int InnerProduct_x86::create_pipeline_cached(const Option& opt)
+{
+    int params[2] = {num_output, weight_data_size};
+    uint64_t fingerprint = WeightCache::fingerprint(Mat(2, (void*)params, 4u));
+    fingerprint = WeightCache::fingerprint(weight_data, fingerprint);
+#if NCNN_INT8
+    fingerprint = WeightCache::fingerprint(weight_data_int8_scales, fingerprint);
+    fingerprint = WeightCache::fingerprint(bottom_blob_int8_scales, fingerprint);
+#endif
+
+    // models sharing one cache are told apart by content
+    char key[256];
+    sprintf(key, "InnerProduct_x86_%016llx_%x_t%d", (unsigned long long)fingerprint, WeightCache::option_flags(opt), opt.num_threads);
+
+    std::vector<Mat> weights;
+    if (opt.weight_cache->query(key, weights) == 0 && weights.size() == 2)
+    {
+        flatten = ncnn::create_layer_cpu(ncnn::LayerType::Flatten);
+
+        ncnn::ParamDict pd;
+
+        flatten->load_param(pd);
+
+        flatten->create_pipeline(opt);
+
+        weight_data_tm = weights[0];
+#if NCNN_INT8
+        scale_in_data = weights[1];
+#endif
+
+        if (opt.lightmode)
+            weight_data.release();
+
+        return 0;
+    }
+
+    Option opt1 = opt;
+    opt1.weight_cache = 0;
+
+    int ret = create_pipeline(opt1);
+    if (ret != 0)
+        return ret;
+
+    weights.resize(2);
+    weights[0] = weight_data_tm;
+#if NCNN_INT8
+    weights[1] = scale_in_data;
+#endif
+
+    opt.weight_cache->update(key, weights);
+
+    return 0;
+}
+
 int InnerProduct_x86::destroy_pipeline(const Option& opt)
 {
     if (flatten)
@@ -105,6 +167,11 @@ int InnerProduct_x86::destroy_pipeline(const Option& opt)
 
 int InnerProduct_x86::forward(const Mat& bottom_blob, Mat& top_blob, const Option& opt) const
 {
+#if NCNN_BATCH
+    if (bottom_blob.n > 1)
+        return forward_batch(bottom_blob, top_blob, opt);
+#endif
+
 #if NCNN_INT8
     if (opt.use_int8_inference && int8_scale_term)
     {
@@ -194,6 +261,171 @@ int InnerProduct_x86::forward(const Mat& bottom_blob, Mat& top_blob, const Optio
     return 0;
 }
 
+#if NCNN_BATCH
+int InnerProduct_x86::forward_batch(const Mat& bottom_blob, Mat& top_blob, const Option& opt) const
+{
+    const int B = bottom_blob.n;
+    const int num_input = weight_data_size / num_output;
+
+    Option opt_b = opt;
+    opt_b.blob_allocator = opt.workspace_allocator;
+
+#if NCNN_INT8
+    if (opt.use_int8_inference && int8_scale_term)
+    {
+        // forward sample by sample into the batch slots
+        for (int b = 0; b < B; b++)
+        {
+            Mat top_b;
+            if (b > 0)
+                top_b = top_blob.batch(b);
+
+            int ret = forward(bottom_blob.batch(b), top_b, opt);
+            if (ret != 0)
+                return ret;
+
+            if (b == 0)
+            {
+                top_blob.create_like(top_b, B, opt.blob_allocator);
+                if (top_blob.empty())
+                    return -100;
+            }
+
+            Mat top_blob_b = top_blob.batch(b);
+            if (top_b.data != top_blob_b.data)
+                memcpy(top_blob_b, top_b, top_b.total() * top_b.elemsize);
+        }
+
+        return 0;
+    }
+#endif
+
+    if (bottom_blob.dims == 2 && bottom_blob.w == num_input)
+    {
+        // stack the rows of all samples into one gemm
+        const int h = bottom_blob.h;
+        const size_t elemsize = bottom_blob.elemsize;
+        const int elempack = bottom_blob.elempack;
+        const size_t size = (size_t)num_input * h * elemsize;
+
+        Mat bottom_blob_stacked(num_input, h * B, elemsize, elempack, opt.workspace_allocator);
+        if (bottom_blob_stacked.empty())
+            return -100;
+
+        for (int b = 0; b < B; b++)
+        {
+            memcpy((unsigned char*)bottom_blob_stacked.data + size * b, bottom_blob.batch(b), size);
+        }
+
+        Mat top_blob_stacked;
+        int ret = forward(bottom_blob_stacked, top_blob_stacked, opt_b);
+        if (ret != 0)
+            return ret;
+
+        const size_t out_elemsize = top_blob_stacked.elemsize;
+        const size_t out_size = (size_t)num_output * h * out_elemsize;
+
+        top_blob.create(num_output, h, out_elemsize, top_blob_stacked.elempack, B, opt.blob_allocator);
+        if (top_blob.empty())
+            return -100;
+
+        for (int b = 0; b < B; b++)
+        {
+            memcpy(top_blob.batch(b), (const unsigned char*)top_blob_stacked.data + out_size * b, out_size);
+        }
+
+        return 0;
+    }
+
+    // one sample per row, the batch becomes the gemm M dimension
+    const size_t elemsize = bottom_blob.elemsize / bottom_blob.elempack;
+
+    Mat bottom_blob_stacked(num_input, B, elemsize, 1, opt.workspace_allocator);
+    if (bottom_blob_stacked.empty())
+        return -100;
+
+    for (int b = 0; b < B; b++)
+    {
+        const Mat bottom_blob_b = bottom_blob.batch(b);
+
+        Mat bottom_blob_flattened = bottom_blob_b;
+        if (bottom_blob_b.dims != 1)
+        {
+            flatten->forward(bottom_blob_b, bottom_blob_flattened, opt_b);
+            if (bottom_blob_flattened.empty())
+                return -100;
+        }
+
+        memcpy(bottom_blob_stacked.row<unsigned char>(b), bottom_blob_flattened, num_input * elemsize);
+    }
+
+    int elempack = 1;
+#if __SSE2__
+    if (opt.use_packing_layout)
+    {
+#if __AVX512F__
+        elempack = B % 16 == 0 ? 16 : B % 8 == 0 ? 8 : B % 4 == 0 ? 4 : 1;
+#elif __AVX__
+        elempack = B % 8 == 0 ? 8 : B % 4 == 0 ? 4 : 1;
+#else
+        elempack = B % 4 == 0 ? 4 : 1;
+#endif
+    }
+#endif // __SSE2__
+
+    if (elempack > 1)
+    {
+        Mat bottom_blob_stacked_packed;
+        convert_packing(bottom_blob_stacked, bottom_blob_stacked_packed, elempack, opt_b);
+        if (bottom_blob_stacked_packed.empty())
+            return -100;
+
+        bottom_blob_stacked = bottom_blob_stacked_packed;
+    }
+
+    Mat top_blob_stacked;
+    int ret = forward(bottom_blob_stacked, top_blob_stacked, opt_b);
+    if (ret != 0)
+        return ret;
+
+    if (top_blob_stacked.elempack > 1)
+    {
+        Mat top_blob_stacked_unpacked;
+        convert_packing(top_blob_stacked, top_blob_stacked_unpacked, 1, opt_b);
+        if (top_blob_stacked_unpacked.empty())
+            return -100;
+
+        top_blob_stacked = top_blob_stacked_unpacked;
+    }
+
+    int out_elempack = 1;
+#if __SSE2__
+    if (opt.use_packing_layout)
+    {
+#if __AVX512F__
+        out_elempack = num_output % 16 == 0 ? 16 : num_output % 8 == 0 ? 8 : num_output % 4 == 0 ? 4 : 1;
+#elif __AVX__
+        out_elempack = num_output % 8 == 0 ? 8 : num_output % 4 == 0 ? 4 : 1;
+#else
+        out_elempack = num_output % 4 == 0 ? 4 : 1;
+#endif
+    }
+#endif // __SSE2__
+    const size_t out_elemsize = top_blob_stacked.elemsize;
+
+    top_blob.create(num_output / out_elempack, out_elemsize * out_elempack, out_elempack, B, opt.blob_allocator);
+    if (top_blob.empty())
+        return -100;
+
+    for (int b = 0; b < B; b++)
+    {
+        memcpy(top_blob.batch(b), top_blob_stacked.row<const unsigned char>(b), num_output * out_elemsize);
+    }
+
+    return 0;
+}
+#endif // NCNN_BATCH
+
 #if NCNN_BF16
 int InnerProduct_x86::create_pipeline_bf16s(const Option& opt)
 {
@@ -0,0 +1,167 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "inversespectrogram_x86.h"
+
+#if __SSE2__
+#include <emmintrin.h>
+#if __AVX__
+#include <immintrin.h>
+#endif // __AVX__
+#endif // __SSE2__
+
+#include "cpu.h"
+
+namespace ncnn {
+
+#include "spectrogram_fft.h"
+
+InverseSpectrogram_x86::InverseSpectrogram_x86()
+{
+}
+
+int InverseSpectrogram_x86::create_pipeline(const Option& /*opt*/)
+{
+    fft_prepare(n_fft, fft_radices, fft_twiddles);
+
+    return 0;
+}
+
+int InverseSpectrogram_x86::forward(const Mat& bottom_blob, Mat& top_blob, const Option& opt) const
+{
+    const int frames = bottom_blob.h;
+    const int freqs = bottom_blob.c;
+
+    const int onesided = freqs == n_fft / 2 + 1 ? 1 : 0;
+
+    const int outsize = center ? (frames - 1) * hoplen + (n_fft - n_fft / 2 * 2) : (frames - 1) * hoplen + n_fft;
+
+    const size_t elemsize = bottom_blob.elemsize;
+
+    if (returns == 0)
+    {
+        top_blob.create(2, outsize, elemsize, opt.blob_allocator);
+    }
+    else
+    {
+        top_blob.create(outsize, elemsize, opt.blob_allocator);
+    }
+    if (top_blob.empty())
+        return -100;
+
+    // windowed inverse dft of every frame, overlap-add afterwards
+    Mat frames_data(n_fft * 2, frames, 4u, opt.workspace_allocator);
+    if (frames_data.empty())
+        return -100;
+
+    const int L = FFT_LANES;
+    const int group_count = (frames + L - 1) / L;
+
+    Mat fft_workspace(n_fft * L * 2, 2, opt.num_threads, 4u, opt.workspace_allocator);
+    if (fft_workspace.empty())
+        return -100;
+
+    float norm = 1.f / n_fft;
+    if (normalized == 1)
+        norm = sqrt(n_fft) / n_fft;
+    if (normalized == 2)
+        norm = window_data[n_fft] / n_fft;
+
+    const float* window_ptr = window_data;
+
+    #pragma omp parallel for num_threads(opt.num_threads)
+    for (int g = 0; g < group_count; g++)
+    {
+        const int j0 = g * L;
+
+        Mat fft_ws = fft_workspace.channel(get_omp_thread_num());
+        float* x = fft_ws.row(0);
+        float* y = fft_ws.row(1);
+
+        // conjugated spectrum, the inverse dft is then the conjugate of the forward dft
+        for (int k = 0; k < n_fft; k++)
+        {
+            const bool mirror = onesided && k > n_fft / 2;
+            const Mat sp = bottom_blob.channel(mirror ? n_fft - k : k);
+            const float im_sign = mirror ? 1.f : -1.f;
+
+            float* xp = x + k * L * 2;
+            for (int l = 0; l < L; l++)
+            {
+                const int j = j0 + l;
+                if (j < frames)
+                {
+                    const float* ptr = sp.row(j);
+                    xp[l] = ptr[0];
+                    xp[L + l] = ptr[1] * im_sign;
+                }
+                else
+                {
+                    xp[l] = 0.f;
+                    xp[L + l] = 0.f;
+                }
+            }
+        }
+
+        const float* z = fft_forward(x, y, n_fft, fft_radices, fft_twiddles);
+
+        for (int l = 0; l < L && j0 + l < frames; l++)
+        {
+            float* outptr = frames_data.row(j0 + l);
+            for (int i = 0; i < n_fft; i++)
+            {
+                const float w = window_ptr[i] * norm;
+                outptr[i * 2] = z[i * L * 2 + l] * w;
+                outptr[i * 2 + 1] = -z[i * L * 2 + L + l] * w;
+            }
+        }
+    }
+
+    // overlap-add, every output sample gathers its frames in order
+    const int offset = center == 1 ? n_fft / 2 : 0;
+
+    #pragma omp parallel for num_threads(opt.num_threads)
+    for (int i = 0; i < outsize; i++)
+    {
+        const int t = i + offset;
+        const int j_start = t >= n_fft ? (t - n_fft) / hoplen + 1 : 0;
+        const int j_end = std::min(frames - 1, t / hoplen);
+
+        float re = 0.f;
+        float im = 0.f;
+        float sumsquare = 0.f;
+        for (int j = j_start; j <= j_end; j++)
+        {
+            const int k = t - j * hoplen;
+            const float* ptr = frames_data.row(j);
+            re += ptr[k * 2];
+            im += ptr[k * 2 + 1];
+            sumsquare += window_ptr[k] * window_ptr[k];
+        }
+
+        // square window norm
+        if (sumsquare != 0.f)
+        {
+            re /= sumsquare;
+            im /= sumsquare;
+        }
+
+        if (returns == 0)
+        {
+            top_blob.row(i)[0] = re;
+            top_blob.row(i)[1] = im;
+        }
+        if (returns == 1)
+        {
+            top_blob[i] = re;
+        }
+        if (returns == 2)
+        {
+            top_blob[i] = im;
+        }
+    }
+
+    return 0;
+}
+
+} // namespace ncnn
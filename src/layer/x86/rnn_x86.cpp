@@ -0,0 +1,730 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "rnn_x86.h"
+
+#if __SSE2__
+#include <emmintrin.h>
+#include "sse_mathfun.h"
+#if __AVX__
+#include <immintrin.h>
+#include "avx_mathfun.h"
+#if __AVX512F__
+#include "avx512_mathfun.h"
+#endif // __AVX512F__
+#endif // __AVX__
+#endif // __SSE2__
+
+#include "x86_activation.h"
+#include "x86_usability.h"
+
+#include "cpu.h"
+
+namespace ncnn {
+
+// outputs are packed in blocks of 8 and 4, the rest one by one
+static inline int rnn_block_row(int q)
+{
+#if __AVX__
+    return q / 8 + (q % 8) / 4 + q % 4;
+#elif __SSE2__
+    return q / 4 + q % 4;
+#else
+    return q;
+#endif
+}
+
+#if NCNN_INT8
+// int8 blocks use the integer unit width, which is 4 without avx2
+static inline int rnn_int8_block_row(int q)
+{
+#if __AVX2__
+    return q / 8 + (q % 8) / 4 + q % 4;
+#elif __SSE2__
+    return q / 4 + q % 4;
+#else
+    return q;
+#endif
+}
+#endif // NCNN_INT8
+
+RNN_x86::RNN_x86()
+{
+    one_blob_only = false;
+    support_inplace = false;
+}
+
+static void rnn_pack_block(const Mat& weight_xc, const Mat& weight_hc, Mat& weight_xc_packed, Mat& weight_hc_packed, int q, int elempack, int row)
+{
+    const int size = weight_xc.w;
+    const int num_output = weight_hc.w;
+
+    float* weight_xc_ptr = weight_xc_packed.row(row);
+    for (int i = 0; i < size; i++)
+    {
+        for (int k = 0; k < elempack; k++)
+        {
+            *weight_xc_ptr++ = weight_xc.row(q + k)[i];
+        }
+    }
+
+    float* weight_hc_ptr = weight_hc_packed.row(row);
+    for (int i = 0; i < num_output; i++)
+    {
+        for (int k = 0; k < elempack; k++)
+        {
+            *weight_hc_ptr++ = weight_hc.row(q + k)[i];
+        }
+    }
+}
+
+int RNN_x86::create_pipeline(const Option& opt)
+{
+#if NCNN_INT8
+    if (int8_scale_term)
+    {
+        return create_pipeline_int8(opt);
+    }
+#endif
+
+    const int num_directions = direction == 2 ? 2 : 1;
+    const int size = weight_data_size / num_directions / num_output;
+
+#if __AVX__
+    const int max_elempack = 8;
+#elif __SSE2__
+    const int max_elempack = 4;
+#else
+    const int max_elempack = 1;
+#endif
+
+    weight_xc_data_packed.create(size * max_elempack, rnn_block_row(num_output), num_directions);
+    weight_hc_data_packed.create(num_output * max_elempack, rnn_block_row(num_output), num_directions);
+    if (weight_xc_data_packed.empty() || weight_hc_data_packed.empty())
+        return -100;
+
+    #pragma omp parallel for num_threads(opt.num_threads)
+    for (int dr = 0; dr < num_directions; dr++)
+    {
+        const Mat weight_xc = weight_xc_data.channel(dr);
+        const Mat weight_hc = weight_hc_data.channel(dr);
+
+        Mat weight_xc_data_packed_dr = weight_xc_data_packed.channel(dr);
+        Mat weight_hc_data_packed_dr = weight_hc_data_packed.channel(dr);
+
+        int q = 0;
+#if __AVX__
+        for (; q + 7 < num_output; q += 8)
+        {
+            rnn_pack_block(weight_xc, weight_hc, weight_xc_data_packed_dr, weight_hc_data_packed_dr, q, 8, rnn_block_row(q));
+        }
+#endif // __AVX__
+#if __SSE2__
+        for (; q + 3 < num_output; q += 4)
+        {
+            rnn_pack_block(weight_xc, weight_hc, weight_xc_data_packed_dr, weight_hc_data_packed_dr, q, 4, rnn_block_row(q));
+        }
+#endif // __SSE2__
+        for (; q < num_output; q++)
+        {
+            rnn_pack_block(weight_xc, weight_hc, weight_xc_data_packed_dr, weight_hc_data_packed_dr, q, 1, rnn_block_row(q));
+        }
+    }
+
+    if (opt.lightmode)
+    {
+        weight_xc_data.release();
+        weight_hc_data.release();
+    }
+
+    return 0;
+}
+
+static int rnn(const Mat& bottom_blob, Mat& top_blob, int reverse, const Mat& weight_xc, const Mat& bias_c, const Mat& weight_hc, Mat& hidden_state, const Option& opt)
+{
+    int size = bottom_blob.w;
+    int T = bottom_blob.h;
+
+    int num_output = top_blob.w;
+
+    // num_output
+    Mat gates(num_output, 4u, opt.workspace_allocator);
+    if (gates.empty())
+        return -100;
+
+    // unroll
+    for (int t = 0; t < T; t++)
+    {
+        int ti = reverse ? T - 1 - t : t;
+
+        const float* x = bottom_blob.row(ti);
+        const float* hidden_ptr = hidden_state;
+
+        int remain_num_output_start = 0;
+#if __AVX__
+        int nn_num_output = num_output >> 3;
+        #pragma omp parallel for num_threads(opt.num_threads)
+        for (int qq = 0; qq < nn_num_output; qq++)
+        {
+            int q = qq * 8;
+
+            const float* weight_xc_ptr = weight_xc.row(rnn_block_row(q));
+            const float* weight_hc_ptr = weight_hc.row(rnn_block_row(q));
+
+            __m256 _H = _mm256_loadu_ps((const float*)bias_c + q);
+            __m256 _Hh = _mm256_setzero_ps();
+
+            for (int i = 0; i < size; i++)
+            {
+                _H = _mm256_comp_fmadd_ps(_mm256_loadu_ps(weight_xc_ptr), _mm256_broadcast_ss(x + i), _H);
+
+                weight_xc_ptr += 8;
+            }
+
+            for (int i = 0; i < num_output; i++)
+            {
+                _Hh = _mm256_comp_fmadd_ps(_mm256_loadu_ps(weight_hc_ptr), _mm256_broadcast_ss(hidden_ptr + i), _Hh);
+
+                weight_hc_ptr += 8;
+            }
+
+            _H = tanh_avx(_mm256_add_ps(_H, _Hh));
+
+            _mm256_storeu_ps((float*)gates + q, _H);
+        }
+        remain_num_output_start += nn_num_output << 3;
+#endif // __AVX__
+#if __SSE2__
+        int nn_num_output_4 = (num_output - remain_num_output_start) >> 2;
+        #pragma omp parallel for num_threads(opt.num_threads)
+        for (int qq = 0; qq < nn_num_output_4; qq++)
+        {
+            int q = remain_num_output_start + qq * 4;
+
+            const float* weight_xc_ptr = weight_xc.row(rnn_block_row(q));
+            const float* weight_hc_ptr = weight_hc.row(rnn_block_row(q));
+
+            __m128 _H = _mm_loadu_ps((const float*)bias_c + q);
+            __m128 _Hh = _mm_setzero_ps();
+
+            for (int i = 0; i < size; i++)
+            {
+                _H = _mm_comp_fmadd_ps(_mm_loadu_ps(weight_xc_ptr), _mm_load1_ps(x + i), _H);
+
+                weight_xc_ptr += 4;
+            }
+
+            for (int i = 0; i < num_output; i++)
+            {
+                _Hh = _mm_comp_fmadd_ps(_mm_loadu_ps(weight_hc_ptr), _mm_load1_ps(hidden_ptr + i), _Hh);
+
+                weight_hc_ptr += 4;
+            }
+
+            _H = tanh_sse(_mm_add_ps(_H, _Hh));
+
+            _mm_storeu_ps((float*)gates + q, _H);
+        }
+        remain_num_output_start += nn_num_output_4 << 2;
+#endif // __SSE2__
+        #pragma omp parallel for num_threads(opt.num_threads)
+        for (int q = remain_num_output_start; q < num_output; q++)
+        {
+            const float* weight_xc_ptr = weight_xc.row(rnn_block_row(q));
+            const float* weight_hc_ptr = weight_hc.row(rnn_block_row(q));
+
+            float H = bias_c[q];
+
+            for (int i = 0; i < size; i++)
+            {
+                H += weight_xc_ptr[i] * x[i];
+            }
+
+            for (int i = 0; i < num_output; i++)
+            {
+                H += weight_hc_ptr[i] * hidden_ptr[i];
+            }
+
+            H = tanhf(H);
+
+            gates[q] = H;
+        }
+
+        float* output_data = top_blob.row(ti);
+        float* hidden_data = hidden_state;
+        memcpy(hidden_data, gates, num_output * sizeof(float));
+        memcpy(output_data, gates, num_output * sizeof(float));
+    }
+
+    return 0;
+}
+
+#if NCNN_INT8
+static inline signed char float2int8(float v)
+{
+    int int32 = static_cast<int>(round(v));
+    if (int32 > 127) return 127;
+    if (int32 < -127) return -127;
+    return (signed char)int32;
+}
+
+static void rnn_pack_block_int8(const Mat& weight_xc, const float* weight_xc_int8_scales, const Mat& weight_hc, const float* weight_hc_int8_scales, Mat& weight_xc_packed, Mat& weight_hc_packed, Mat& descales_packed, int q, int elempack, int row)
+{
+    const int size = weight_xc.w;
+    const int num_output = weight_hc.w;
+
+    // descales xc, then hc
+    float* descales = (float*)descales_packed + q * 2;
+    for (int k = 0; k < elempack; k++)
+    {
+        descales[k] = 1.f / weight_xc_int8_scales[q + k];
+        descales[elempack + k] = 1.f / weight_hc_int8_scales[q + k];
+    }
+
+    // two adjacent inputs of one output sit together, odd tail is padded with zero
+    signed char* weight_xc_ptr = weight_xc_packed.row<signed char>(row);
+    for (int i = 0; i < size; i += 2)
+    {
+        for (int k = 0; k < elempack; k++)
+        {
+            const signed char* p = weight_xc.row<const signed char>(q + k);
+            *weight_xc_ptr++ = p[i];
+            *weight_xc_ptr++ = i + 1 < size ? p[i + 1] : 0;
+        }
+    }
+
+    signed char* weight_hc_ptr = weight_hc_packed.row<signed char>(row);
+    for (int i = 0; i < num_output; i += 2)
+    {
+        for (int k = 0; k < elempack; k++)
+        {
+            const signed char* p = weight_hc.row<const signed char>(q + k);
+            *weight_hc_ptr++ = p[i];
+            *weight_hc_ptr++ = i + 1 < num_output ? p[i + 1] : 0;
+        }
+    }
+}
+
+int RNN_x86::create_pipeline_int8(const Option& opt)
+{
+    const int num_directions = direction == 2 ? 2 : 1;
+    const int size = weight_data_size / num_directions / num_output;
+
+#if __AVX2__
+    const int max_elempack = 8;
+#elif __SSE2__
+    const int max_elempack = 4;
+#else
+    const int max_elempack = 1;
+#endif
+
+    const int size_pairs = (size + 1) / 2;
+    const int num_output_pairs = (num_output + 1) / 2;
+
+    weight_xc_data_packed.create(size_pairs * 2 * max_elempack, rnn_int8_block_row(num_output), num_directions, (size_t)1u, 1);
+    weight_hc_data_packed.create(num_output_pairs * 2 * max_elempack, rnn_int8_block_row(num_output), num_directions, (size_t)1u, 1);
+    weight_data_tm_int8_descales.create(num_output * 2, 1, num_directions);
+    if (weight_xc_data_packed.empty() || weight_hc_data_packed.empty() || weight_data_tm_int8_descales.empty())
+        return -100;
+
+    #pragma omp parallel for num_threads(opt.num_threads)
+    for (int dr = 0; dr < num_directions; dr++)
+    {
+        const Mat weight_xc = weight_xc_data.channel(dr);
+        const Mat weight_hc = weight_hc_data.channel(dr);
+        const float* weight_xc_int8_scales = weight_xc_data_int8_scales.row(dr);
+        const float* weight_hc_int8_scales = weight_hc_data_int8_scales.row(dr);
+
+        Mat weight_xc_data_packed_dr = weight_xc_data_packed.channel(dr);
+        Mat weight_hc_data_packed_dr = weight_hc_data_packed.channel(dr);
+        Mat descales_dr = weight_data_tm_int8_descales.channel(dr);
+
+        int q = 0;
+#if __AVX2__
+        for (; q + 7 < num_output; q += 8)
+        {
+            rnn_pack_block_int8(weight_xc, weight_xc_int8_scales, weight_hc, weight_hc_int8_scales, weight_xc_data_packed_dr, weight_hc_data_packed_dr, descales_dr, q, 8, rnn_int8_block_row(q));
+        }
+#endif // __AVX2__
+#if __SSE2__
+        for (; q + 3 < num_output; q += 4)
+        {
+            rnn_pack_block_int8(weight_xc, weight_xc_int8_scales, weight_hc, weight_hc_int8_scales, weight_xc_data_packed_dr, weight_hc_data_packed_dr, descales_dr, q, 4, rnn_int8_block_row(q));
+        }
+#endif // __SSE2__
+        for (; q < num_output; q++)
+        {
+            rnn_pack_block_int8(weight_xc, weight_xc_int8_scales, weight_hc, weight_hc_int8_scales, weight_xc_data_packed_dr, weight_hc_data_packed_dr, descales_dr, q, 1, rnn_int8_block_row(q));
+        }
+    }
+
+    if (opt.lightmode)
+    {
+        weight_xc_data.release();
+        weight_hc_data.release();
+        weight_xc_data_int8_scales.release();
+        weight_hc_data_int8_scales.release();
+    }
+
+    return 0;
+}
+
+// quantize values to int8 and pair adjacent ones into one int32 for madd
+static void rnn_quantize_pairs(const float* ptr, int size, float scale, int* outptr)
+{
+    for (int i = 0; i < size; i += 2)
+    {
+        int v0 = float2int8(ptr[i] * scale);
+        int v1 = i + 1 < size ? float2int8(ptr[i + 1] * scale) : 0;
+
+        outptr[i / 2] = (int)(((unsigned int)v0 & 0xffff) | ((unsigned int)v1 << 16));
+    }
+}
+
+static int rnn_int8(const Mat& bottom_blob, Mat& top_blob, int reverse, const Mat& weight_xc_int8, const Mat& bias_c, const Mat& weight_hc_int8, const Mat& descales_packed, Mat& hidden_state, const Option& opt)
+{
+    int size = bottom_blob.w;
+    int T = bottom_blob.h;
+
+    int num_output = top_blob.w;
+
+    const int size_pairs = (size + 1) / 2;
+    const int num_output_pairs = (num_output + 1) / 2;
+
+    // num_output
+    Mat gates(num_output, 4u, opt.workspace_allocator);
+    if (gates.empty())
+        return -100;
+
+    // dynamic quantize bottom_blob
+    Mat bottom_blob_int8_pairs(size_pairs, T, 4u, opt.workspace_allocator);
+    Mat bottom_blob_int8_scales(T, 4u, opt.workspace_allocator);
+    if (bottom_blob_int8_pairs.empty() || bottom_blob_int8_scales.empty())
+        return -100;
+
+    for (int t = 0; t < T; t++)
+    {
+        const float* x = bottom_blob.row(t);
+
+        float absmax = 0.f;
+        for (int i = 0; i < size; i++)
+        {
+            absmax = std::max(absmax, (float)fabs(x[i]));
+        }
+
+        bottom_blob_int8_scales[t] = 127.f / absmax;
+
+        rnn_quantize_pairs(x, size, bottom_blob_int8_scales[t], bottom_blob_int8_pairs.row<int>(t));
+    }
+
+    Mat hidden_state_int8_pairs(num_output_pairs, 4u, opt.workspace_allocator);
+    if (hidden_state_int8_pairs.empty())
+        return -100;
+
+    // unroll
+    for (int t = 0; t < T; t++)
+    {
+        int ti = reverse ? T - 1 - t : t;
+
+        // dynamic quantize hidden_state
+        float hidden_state_int8_scale = 1.f;
+        {
+            float absmax = 0.f;
+            for (int i = 0; i < num_output; i++)
+            {
+                absmax = std::max(absmax, (float)fabs(hidden_state[i]));
+            }
+
+            if (absmax == 0.f)
+            {
+                hidden_state_int8_pairs.fill(0);
+            }
+            else
+            {
+                hidden_state_int8_scale = 127.f / absmax;
+
+                rnn_quantize_pairs(hidden_state, num_output, hidden_state_int8_scale, hidden_state_int8_pairs);
+            }
+        }
+
+        const int* x = bottom_blob_int8_pairs.row<const int>(ti);
+        const int* hs = hidden_state_int8_pairs;
+        const float descale_x = 1.f / bottom_blob_int8_scales[ti];
+        const float descale_h = 1.f / hidden_state_int8_scale;
+
+        int remain_num_output_start = 0;
+#if __AVX2__
+        int nn_num_output = num_output >> 3;
+        #pragma omp parallel for num_threads(opt.num_threads)
+        for (int qq = 0; qq < nn_num_output; qq++)
+        {
+            int q = qq * 8;
+
+            const float* descales = (const float*)descales_packed + q * 2;
+            const signed char* weight_xc_ptr = weight_xc_int8.row<const signed char>(rnn_int8_block_row(q));
+            const signed char* weight_hc_ptr = weight_hc_int8.row<const signed char>(rnn_int8_block_row(q));
+
+            __m256i _Hx = _mm256_setzero_si256();
+            for (int i = 0; i < size_pairs; i++)
+            {
+                __m256i _w = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)weight_xc_ptr));
+                _Hx = _mm256_add_epi32(_Hx, _mm256_madd_epi16(_w, _mm256_set1_epi32(x[i])));
+
+                weight_xc_ptr += 16;
+            }
+
+            __m256i _Hh = _mm256_setzero_si256();
+            for (int i = 0; i < num_output_pairs; i++)
+            {
+                __m256i _w = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)weight_hc_ptr));
+                _Hh = _mm256_add_epi32(_Hh, _mm256_madd_epi16(_w, _mm256_set1_epi32(hs[i])));
+
+                weight_hc_ptr += 16;
+            }
+
+            __m256 _H = _mm256_add_ps(_mm256_loadu_ps((const float*)bias_c + q), _mm256_mul_ps(_mm256_cvtepi32_ps(_Hx), _mm256_mul_ps(_mm256_set1_ps(descale_x), _mm256_loadu_ps(descales))));
+            _H = _mm256_add_ps(_H, _mm256_mul_ps(_mm256_cvtepi32_ps(_Hh), _mm256_mul_ps(_mm256_set1_ps(descale_h), _mm256_loadu_ps(descales + 8))));
+            _H = tanh_avx(_H);
+
+            _mm256_storeu_ps((float*)gates + q, _H);
+        }
+        remain_num_output_start += nn_num_output << 3;
+#endif // __AVX2__
+#if __SSE2__
+        int nn_num_output_4 = (num_output - remain_num_output_start) >> 2;
+        #pragma omp parallel for num_threads(opt.num_threads)
+        for (int qq = 0; qq < nn_num_output_4; qq++)
+        {
+            int q = remain_num_output_start + qq * 4;
+
+            const float* descales = (const float*)descales_packed + q * 2;
+            const signed char* weight_xc_ptr = weight_xc_int8.row<const signed char>(rnn_int8_block_row(q));
+            const signed char* weight_hc_ptr = weight_hc_int8.row<const signed char>(rnn_int8_block_row(q));
+
+            __m128i _Hx = _mm_setzero_si128();
+            for (int i = 0; i < size_pairs; i++)
+            {
+                __m128i _w = _mm_loadl_epi64((const __m128i*)weight_xc_ptr);
+                _w = _mm_unpacklo_epi8(_w, _mm_cmpgt_epi8(_mm_setzero_si128(), _w));
+                _Hx = _mm_add_epi32(_Hx, _mm_madd_epi16(_w, _mm_set1_epi32(x[i])));
+
+                weight_xc_ptr += 8;
+            }
+
+            __m128i _Hh = _mm_setzero_si128();
+            for (int i = 0; i < num_output_pairs; i++)
+            {
+                __m128i _w = _mm_loadl_epi64((const __m128i*)weight_hc_ptr);
+                _w = _mm_unpacklo_epi8(_w, _mm_cmpgt_epi8(_mm_setzero_si128(), _w));
+                _Hh = _mm_add_epi32(_Hh, _mm_madd_epi16(_w, _mm_set1_epi32(hs[i])));
+
+                weight_hc_ptr += 8;
+            }
+
+            __m128 _H = _mm_add_ps(_mm_loadu_ps((const float*)bias_c + q), _mm_mul_ps(_mm_cvtepi32_ps(_Hx), _mm_mul_ps(_mm_set1_ps(descale_x), _mm_loadu_ps(descales))));
+            _H = _mm_add_ps(_H, _mm_mul_ps(_mm_cvtepi32_ps(_Hh), _mm_mul_ps(_mm_set1_ps(descale_h), _mm_loadu_ps(descales + 4))));
+            _H = tanh_sse(_H);
+
+            _mm_storeu_ps((float*)gates + q, _H);
+        }
+        remain_num_output_start += nn_num_output_4 << 2;
+#endif // __SSE2__
+        #pragma omp parallel for num_threads(opt.num_threads)
+        for (int q = remain_num_output_start; q < num_output; q++)
+        {
+            const float* descales = (const float*)descales_packed + q * 2;
+            const signed char* weight_xc_ptr = weight_xc_int8.row<const signed char>(rnn_int8_block_row(q));
+            const signed char* weight_hc_ptr = weight_hc_int8.row<const signed char>(rnn_int8_block_row(q));
+
+            int Hx = 0;
+            for (int i = 0; i < size_pairs; i++)
+            {
+                // low 16 bits hold the first value of the pair
+                int x0 = (short)(x[i] & 0xffff);
+                int x1 = (short)(x[i] >> 16);
+
+                Hx += weight_xc_ptr[0] * x0 + weight_xc_ptr[1] * x1;
+
+                weight_xc_ptr += 2;
+            }
+
+            int Hh = 0;
+            for (int i = 0; i < num_output_pairs; i++)
+            {
+                int h0 = (short)(hs[i] & 0xffff);
+                int h1 = (short)(hs[i] >> 16);
+
+                Hh += weight_hc_ptr[0] * h0 + weight_hc_ptr[1] * h1;
+
+                weight_hc_ptr += 2;
+            }
+
+            float H = bias_c[q] + Hx * (descale_x * descales[0]) + Hh * (descale_h * descales[1]);
+            H = tanhf(H);
+
+            gates[q] = H;
+        }
+
+        float* output_data = top_blob.row(ti);
+        float* hidden_data = hidden_state;
+        memcpy(hidden_data, gates, num_output * sizeof(float));
+        memcpy(output_data, gates, num_output * sizeof(float));
+    }
+
+    return 0;
+}
+#endif // NCNN_INT8
+
+int RNN_x86::forward_direction(const Mat& bottom_blob, Mat& top_blob, int dr, int reverse, Mat& hidden_state, const Option& opt) const
+{
+#if NCNN_INT8
+    if (int8_scale_term)
+    {
+        return rnn_int8(bottom_blob, top_blob, reverse, weight_xc_data_packed.channel(dr), bias_c_data.channel(dr), weight_hc_data_packed.channel(dr), weight_data_tm_int8_descales.channel(dr), hidden_state, opt);
+    }
+#endif
+
+    return rnn(bottom_blob, top_blob, reverse, weight_xc_data_packed.channel(dr), bias_c_data.channel(dr), weight_hc_data_packed.channel(dr), hidden_state, opt);
+}
+
+int RNN_x86::forward(const Mat& bottom_blob, Mat& top_blob, const Option& opt) const
+{
+    int T = bottom_blob.h;
+
+    int num_directions = direction == 2 ? 2 : 1;
+
+    // initial hidden state
+    Mat hidden(num_output, 4u, opt.workspace_allocator);
+    if (hidden.empty())
+        return -100;
+    hidden.fill(0.f);
+
+    top_blob.create(num_output * num_directions, T, 4u, opt.blob_allocator);
+    if (top_blob.empty())
+        return -100;
+
+    // Uni directional
+    if (direction == 0 || direction == 1)
+    {
+        int ret = forward_direction(bottom_blob, top_blob, 0, direction, hidden, opt);
+        if (ret != 0)
+            return ret;
+    }
+
+    if (direction == 2)
+    {
+        Mat top_blob_forward(num_output, T, 4u, opt.workspace_allocator);
+        if (top_blob_forward.empty())
+            return -100;
+
+        Mat top_blob_reverse(num_output, T, 4u, opt.workspace_allocator);
+        if (top_blob_reverse.empty())
+            return -100;
+
+        {
+            int ret = forward_direction(bottom_blob, top_blob_forward, 0, 0, hidden, opt);
+            if (ret != 0)
+                return ret;
+        }
+
+        hidden.fill(0.0f);
+
+        {
+            int ret = forward_direction(bottom_blob, top_blob_reverse, 1, 1, hidden, opt);
+            if (ret != 0)
+                return ret;
+        }
+
+        // concat w
+        for (int i = 0; i < T; i++)
+        {
+            const float* pf = top_blob_forward.row(i);
+            const float* pr = top_blob_reverse.row(i);
+            float* ptr = top_blob.row(i);
+
+            memcpy(ptr, pf, num_output * sizeof(float));
+            memcpy(ptr + num_output, pr, num_output * sizeof(float));
+        }
+    }
+
+    return 0;
+}
+
+int RNN_x86::forward(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& top_blobs, const Option& opt) const
+{
+    const Mat& bottom_blob = bottom_blobs[0];
+    int T = bottom_blob.h;
+    int num_directions = direction == 2 ? 2 : 1;
+
+    Mat hidden;
+    Allocator* hidden_allocator = top_blobs.size() == 2 ? opt.blob_allocator : opt.workspace_allocator;
+    if (bottom_blobs.size() == 2)
+    {
+        hidden = bottom_blobs[1].clone(hidden_allocator);
+    }
+    else
+    {
+        hidden.create(num_output, num_directions, 4u, hidden_allocator);
+        if (hidden.empty())
+            return -100;
+        hidden.fill(0.f);
+    }
+
+    Mat& top_blob = top_blobs[0];
+    top_blob.create(num_output * num_directions, T, 4u, opt.blob_allocator);
+    if (top_blob.empty())
+        return -100;
+
+    // Uni directional
+    if (direction == 0 || direction == 1)
+    {
+        int ret = forward_direction(bottom_blob, top_blob, 0, direction, hidden, opt);
+        if (ret != 0)
+            return ret;
+    }
+
+    if (direction == 2)
+    {
+        Mat top_blob_forward(num_output, T, 4u, opt.workspace_allocator);
+        if (top_blob_forward.empty())
+            return -100;
+
+        Mat top_blob_reverse(num_output, T, 4u, opt.workspace_allocator);
+        if (top_blob_reverse.empty())
+            return -100;
+
+        Mat hidden0 = hidden.row_range(0, 1);
+        {
+            int ret = forward_direction(bottom_blob, top_blob_forward, 0, 0, hidden0, opt);
+            if (ret != 0)
+                return ret;
+        }
+
+        Mat hidden1 = hidden.row_range(1, 1);
+        {
+            int ret = forward_direction(bottom_blob, top_blob_reverse, 1, 1, hidden1, opt);
+            if (ret != 0)
+                return ret;
+        }
+
+        // concat w
+        for (int i = 0; i < T; i++)
+        {
+            const float* pf = top_blob_forward.row(i);
+            const float* pr = top_blob_reverse.row(i);
+            float* ptr = top_blob.row(i);
+
+            memcpy(ptr, pf, num_output * sizeof(float));
+            memcpy(ptr + num_output, pr, num_output * sizeof(float));
+        }
+    }
+
+    if (top_blobs.size() == 2)
+    {
+        top_blobs[1] = hidden;
+    }
+
+    return 0;
+}
+
+} // namespace ncnn
@@ -0,0 +1,428 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+// decode attention for a few query rows
+// the query rows of all heads sharing a kv group are handled together so that every key and value row
+// is read once per group, key rows are split into chunks so that short queries still keep all threads busy,
+// and the partial softmax of every chunk is merged at the end
+
+// kv row storage
+#define SDPA_DECODE_FP32 0
+#define SDPA_DECODE_BF16 1
+#define SDPA_DECODE_INT8 2
+
+static float sdpa_decode_dot(const float* q, const unsigned char* p0, int K, int kind)
+{
+    float sum = 0.f;
+
+    int k = 0;
+
+#if NCNN_BF16
+    if (kind == SDPA_DECODE_BF16)
+    {
+        const unsigned short* p = (const unsigned short*)p0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+        __m512 _sum_avx512 = _mm512_setzero_ps();
+        for (; k + 15 < K; k += 16)
+        {
+            __m512 _k = bfloat2float_avx512(_mm256_loadu_si256((const __m256i*)(p + k)));
+            _sum_avx512 = _mm512_fmadd_ps(_mm512_loadu_ps(q + k), _k, _sum_avx512);
+        }
+        sum += _mm512_comp_reduce_add_ps(_sum_avx512);
+#endif // __AVX512F__
+        __m256 _sum_avx = _mm256_setzero_ps();
+        for (; k + 7 < K; k += 8)
+        {
+            __m256 _k = bfloat2float_avx(_mm_loadu_si128((const __m128i*)(p + k)));
+            _sum_avx = _mm256_comp_fmadd_ps(_mm256_loadu_ps(q + k), _k, _sum_avx);
+        }
+        sum += _mm256_reduce_add_ps(_sum_avx);
+#endif // __AVX__
+        __m128 _sum = _mm_setzero_ps();
+        for (; k + 3 < K; k += 4)
+        {
+            __m128 _k = bfloat2float_sse(_mm_loadl_epi64((const __m128i*)(p + k)));
+            _sum = _mm_comp_fmadd_ps(_mm_loadu_ps(q + k), _k, _sum);
+        }
+        sum += _mm_reduce_add_ps(_sum);
+#endif // __SSE2__
+        for (; k < K; k++)
+        {
+            sum += q[k] * bfloat16_to_float32(p[k]);
+        }
+
+        return sum;
+    }
+#endif // NCNN_BF16
+
+    if (kind == SDPA_DECODE_INT8)
+    {
+        const float descale = ((const float*)p0)[0];
+        const signed char* p = (const signed char*)p0 + 4;
+#if __AVX512F__
+        __m512 _sum_avx512 = _mm512_setzero_ps();
+        for (; k + 15 < K; k += 16)
+        {
+            __m512 _k = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)(p + k))));
+            _sum_avx512 = _mm512_fmadd_ps(_mm512_loadu_ps(q + k), _k, _sum_avx512);
+        }
+        sum += _mm512_comp_reduce_add_ps(_sum_avx512);
+#endif // __AVX512F__
+#if __AVX2__
+        __m256 _sum_avx = _mm256_setzero_ps();
+        for (; k + 7 < K; k += 8)
+        {
+            __m256 _k = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(p + k))));
+            _sum_avx = _mm256_comp_fmadd_ps(_mm256_loadu_ps(q + k), _k, _sum_avx);
+        }
+        sum += _mm256_reduce_add_ps(_sum_avx);
+#endif // __AVX2__
+#if __SSE4_1__
+        __m128 _sum = _mm_setzero_ps();
+        for (; k + 3 < K; k += 4)
+        {
+            __m128 _k = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(*(const int*)(p + k))));
+            _sum = _mm_comp_fmadd_ps(_mm_loadu_ps(q + k), _k, _sum);
+        }
+        sum += _mm_reduce_add_ps(_sum);
+#endif // __SSE4_1__
+        for (; k < K; k++)
+        {
+            sum += q[k] * p[k];
+        }
+
+        return sum * descale;
+    }
+
+    const float* p = (const float*)p0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+    __m512 _sum_avx512 = _mm512_setzero_ps();
+    for (; k + 15 < K; k += 16)
+    {
+        _sum_avx512 = _mm512_fmadd_ps(_mm512_loadu_ps(q + k), _mm512_loadu_ps(p + k), _sum_avx512);
+    }
+    sum += _mm512_comp_reduce_add_ps(_sum_avx512);
+#endif // __AVX512F__
+    __m256 _sum_avx = _mm256_setzero_ps();
+    for (; k + 7 < K; k += 8)
+    {
+        _sum_avx = _mm256_comp_fmadd_ps(_mm256_loadu_ps(q + k), _mm256_loadu_ps(p + k), _sum_avx);
+    }
+    sum += _mm256_reduce_add_ps(_sum_avx);
+#endif // __AVX__
+    __m128 _sum = _mm_setzero_ps();
+    for (; k + 3 < K; k += 4)
+    {
+        _sum = _mm_comp_fmadd_ps(_mm_loadu_ps(q + k), _mm_loadu_ps(p + k), _sum);
+    }
+    sum += _mm_reduce_add_ps(_sum);
+#endif // __SSE2__
+    for (; k < K; k++)
+    {
+        sum += q[k] * p[k];
+    }
+
+    return sum;
+}
+
+// o += a * v
+static void sdpa_decode_axpy(float* o, float a, const unsigned char* p0, int N, int kind)
+{
+    int n = 0;
+
+#if NCNN_BF16
+    if (kind == SDPA_DECODE_BF16)
+    {
+        const unsigned short* p = (const unsigned short*)p0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+        __m512 _a_avx512 = _mm512_set1_ps(a);
+        for (; n + 15 < N; n += 16)
+        {
+            __m512 _v = bfloat2float_avx512(_mm256_loadu_si256((const __m256i*)(p + n)));
+            _mm512_storeu_ps(o + n, _mm512_fmadd_ps(_a_avx512, _v, _mm512_loadu_ps(o + n)));
+        }
+#endif // __AVX512F__
+        __m256 _a_avx = _mm256_set1_ps(a);
+        for (; n + 7 < N; n += 8)
+        {
+            __m256 _v = bfloat2float_avx(_mm_loadu_si128((const __m128i*)(p + n)));
+            _mm256_storeu_ps(o + n, _mm256_comp_fmadd_ps(_a_avx, _v, _mm256_loadu_ps(o + n)));
+        }
+#endif // __AVX__
+        __m128 _a = _mm_set1_ps(a);
+        for (; n + 3 < N; n += 4)
+        {
+            __m128 _v = bfloat2float_sse(_mm_loadl_epi64((const __m128i*)(p + n)));
+            _mm_storeu_ps(o + n, _mm_comp_fmadd_ps(_a, _v, _mm_loadu_ps(o + n)));
+        }
+#endif // __SSE2__
+        for (; n < N; n++)
+        {
+            o[n] += a * bfloat16_to_float32(p[n]);
+        }
+
+        return;
+    }
+#endif // NCNN_BF16
+
+    if (kind == SDPA_DECODE_INT8)
+    {
+        a *= ((const float*)p0)[0];
+        const signed char* p = (const signed char*)p0 + 4;
+#if __AVX512F__
+        __m512 _a_avx512 = _mm512_set1_ps(a);
+        for (; n + 15 < N; n += 16)
+        {
+            __m512 _v = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)(p + n))));
+            _mm512_storeu_ps(o + n, _mm512_fmadd_ps(_a_avx512, _v, _mm512_loadu_ps(o + n)));
+        }
+#endif // __AVX512F__
+#if __AVX2__
+        __m256 _a_avx = _mm256_set1_ps(a);
+        for (; n + 7 < N; n += 8)
+        {
+            __m256 _v = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(p + n))));
+            _mm256_storeu_ps(o + n, _mm256_comp_fmadd_ps(_a_avx, _v, _mm256_loadu_ps(o + n)));
+        }
+#endif // __AVX2__
+#if __SSE4_1__
+        __m128 _a = _mm_set1_ps(a);
+        for (; n + 3 < N; n += 4)
+        {
+            __m128 _v = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(*(const int*)(p + n))));
+            _mm_storeu_ps(o + n, _mm_comp_fmadd_ps(_a, _v, _mm_loadu_ps(o + n)));
+        }
+#endif // __SSE4_1__
+        for (; n < N; n++)
+        {
+            o[n] += a * p[n];
+        }
+
+        return;
+    }
+
+    const float* p = (const float*)p0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+    __m512 _a_avx512 = _mm512_set1_ps(a);
+    for (; n + 15 < N; n += 16)
+    {
+        _mm512_storeu_ps(o + n, _mm512_fmadd_ps(_a_avx512, _mm512_loadu_ps(p + n), _mm512_loadu_ps(o + n)));
+    }
+#endif // __AVX512F__
+    __m256 _a_avx = _mm256_set1_ps(a);
+    for (; n + 7 < N; n += 8)
+    {
+        _mm256_storeu_ps(o + n, _mm256_comp_fmadd_ps(_a_avx, _mm256_loadu_ps(p + n), _mm256_loadu_ps(o + n)));
+    }
+#endif // __AVX__
+    __m128 _a = _mm_set1_ps(a);
+    for (; n + 3 < N; n += 4)
+    {
+        _mm_storeu_ps(o + n, _mm_comp_fmadd_ps(_a, _mm_loadu_ps(p + n), _mm_loadu_ps(o + n)));
+    }
+#endif // __SSE2__
+    for (; n < N; n++)
+    {
+        o[n] += a * p[n];
+    }
+}
+
+static void sdpa_decode_scale(float* o, float a, int N)
+{
+    int n = 0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+    __m512 _a_avx512 = _mm512_set1_ps(a);
+    for (; n + 15 < N; n += 16)
+    {
+        _mm512_storeu_ps(o + n, _mm512_mul_ps(_mm512_loadu_ps(o + n), _a_avx512));
+    }
+#endif // __AVX512F__
+    __m256 _a_avx = _mm256_set1_ps(a);
+    for (; n + 7 < N; n += 8)
+    {
+        _mm256_storeu_ps(o + n, _mm256_mul_ps(_mm256_loadu_ps(o + n), _a_avx));
+    }
+#endif // __AVX__
+    __m128 _a = _mm_set1_ps(a);
+    for (; n + 3 < N; n += 4)
+    {
+        _mm_storeu_ps(o + n, _mm_mul_ps(_mm_loadu_ps(o + n), _a));
+    }
+#endif // __SSE2__
+    for (; n < N; n++)
+    {
+        o[n] *= a;
+    }
+}
+
+// row j of kv head q, contiguous or paged kv cache
+static NCNN_FORCEINLINE const unsigned char* sdpa_decode_kv_row(const Mat& m, int q, int j, int block_seqlen)
+{
+    if (block_seqlen)
+    {
+        const PagedKVCacheTable* table = (const PagedKVCacheTable*)m.data;
+        const unsigned char* block = (const unsigned char*)table->blocks[j / block_seqlen];
+        return block + (m.cstep * q + (size_t)m.w * (j % block_seqlen)) * m.elemsize;
+    }
+
+    return (const unsigned char*)m.data + (m.cstep * q + (size_t)m.w * j) * m.elemsize;
+}
+
+// key and value are paged kv caches when block_seqlen > 0
+// key and value are int8 kv caches when elemsize is 1, see sdpa_flash_quantize_row
+static int sdpa_decode_attention(const Mat& query, const Mat& key, const Mat& value, const Mat& attn_mask_blob, Mat& top_blob, float scale, int block_seqlen, const Option& opt)
+{
+    const int embed_dim = query.w;
+    const int src_seqlen = query.h;
+    const int num_heads = query.c;
+    const int dst_seqlen = key.h;
+    const int num_group = key.c;
+    const int out_embed_dim = top_blob.w;
+
+    const int num_heads_per_group = num_heads / num_group;
+
+    // query rows of one kv group
+    const int M = num_heads_per_group * src_seqlen;
+
+    const int kind = key.elemsize == 1 ? SDPA_DECODE_INT8 : key.elembits() == 16 ? SDPA_DECODE_BF16 : SDPA_DECODE_FP32;
+
+    // split key rows so that every thread gets a chunk, but keep chunks long enough to amortize the merge
+    const int TILE_N = 64;
+    int nn_N = std::max(1, std::min((opt.num_threads + num_group - 1) / num_group, dst_seqlen / (TILE_N * 2)));
+    const int chunk = (dst_seqlen + nn_N - 1) / nn_N;
+    nn_N = std::max(1, (dst_seqlen + chunk - 1) / chunk);
+
+    // per chunk: partial output, max, sum
+    const int partial_size = M * out_embed_dim + M * 2;
+    Mat partial(partial_size, nn_N * num_group, 4u, opt.workspace_allocator);
+    if (partial.empty())
+        return -100;
+
+    // per thread scratch: scaled q, scores, rescale
+    const int scratch_size = M * embed_dim + M * TILE_N + M;
+    Mat scratch(scratch_size, 1, opt.num_threads, 4u, opt.workspace_allocator);
+    if (scratch.empty())
+        return -100;
+
+    #pragma omp parallel for num_threads(opt.num_threads)
+    for (int ppj = 0; ppj < num_group * nn_N; ppj++)
+    {
+        const int g = ppj / nn_N;
+        const int j0 = (ppj % nn_N) * chunk;
+        const int j1 = std::min(j0 + chunk, dst_seqlen);
+
+        float* qs = scratch.channel(get_omp_thread_num());
+        float* s = qs + M * embed_dim;
+        float* rescales = s + M * TILE_N;
+
+        float* o = partial.row(ppj);
+        float* maxs = o + M * out_embed_dim;
+        float* sums = maxs + M;
+
+        for (int hh = 0; hh < num_heads_per_group; hh++)
+        {
+            sdpa_flash_pack_q(query.channel(g * num_heads_per_group + hh), qs + hh * src_seqlen * embed_dim, 0, src_seqlen, embed_dim, scale);
+        }
+
+        memset(o, 0, M * out_embed_dim * sizeof(float));
+        for (int m = 0; m < M; m++)
+        {
+            maxs[m] = -FLT_MAX;
+            sums[m] = 0.f;
+        }
+
+        for (int j = j0; j < j1; j += TILE_N)
+        {
+            const int max_jj = std::min(j1 - j, TILE_N);
+
+            // every key row is loaded once for all query rows of the group
+            for (int jj = 0; jj < max_jj; jj++)
+            {
+                const unsigned char* kptr = sdpa_decode_kv_row(key, g, j + jj, block_seqlen);
+
+                for (int m = 0; m < M; m++)
+                {
+                    s[m * TILE_N + jj] = sdpa_decode_dot(qs + m * embed_dim, kptr, embed_dim, kind);
+                }
+            }
+
+            if (!attn_mask_blob.empty())
+            {
+                for (int hh = 0; hh < num_heads_per_group; hh++)
+                {
+                    const int q = g * num_heads_per_group + hh;
+                    const Mat maskm = attn_mask_blob.dims == 3 ? attn_mask_blob.channel(attn_mask_blob.c > 1 ? q : 0) : attn_mask_blob;
+
+                    sdpa_flash_add_mask(maskm, s + hh * src_seqlen * TILE_N, 0, src_seqlen, j, max_jj, TILE_N);
+                }
+            }
+
+            for (int m = 0; m < M; m++)
+            {
+                rescales[m] = sdpa_flash_online_softmax(s + m * TILE_N, max_jj, maxs[m], sums[m]);
+
+                sdpa_decode_scale(o + m * out_embed_dim, rescales[m], out_embed_dim);
+            }
+
+            for (int jj = 0; jj < max_jj; jj++)
+            {
+                const unsigned char* vptr = sdpa_decode_kv_row(value, g, j + jj, block_seqlen);
+
+                for (int m = 0; m < M; m++)
+                {
+                    sdpa_decode_axpy(o + m * out_embed_dim, s[m * TILE_N + jj], vptr, out_embed_dim, kind);
+                }
+            }
+        }
+    }
+
+    // merge the partial softmax of all chunks
+    #pragma omp parallel for num_threads(opt.num_threads)
+    for (int q = 0; q < num_heads; q++)
+    {
+        const int g = q / num_heads_per_group;
+        const int hh = q % num_heads_per_group;
+
+        for (int i = 0; i < src_seqlen; i++)
+        {
+            const int m = hh * src_seqlen + i;
+
+            float max = -FLT_MAX;
+            for (int c = 0; c < nn_N; c++)
+            {
+                const float* maxs = (const float*)partial.row(g * nn_N + c) + M * out_embed_dim;
+                max = std::max(max, maxs[m]);
+            }
+
+            float* outptr = top_blob.channel(q).row(i);
+            memset(outptr, 0, out_embed_dim * sizeof(float));
+
+            float sum = 0.f;
+            for (int c = 0; c < nn_N; c++)
+            {
+                const float* o = partial.row(g * nn_N + c);
+                const float* maxs = o + M * out_embed_dim;
+                const float* sums = maxs + M;
+
+                const float a = expf(maxs[m] - max);
+                sum += sums[m] * a;
+
+                sdpa_decode_axpy(outptr, a, (const unsigned char*)(o + m * out_embed_dim), out_embed_dim, SDPA_DECODE_FP32);
+            }
+
+            sdpa_decode_scale(outptr, 1.f / sum, out_embed_dim);
+        }
+    }
+
+    return 0;
+}
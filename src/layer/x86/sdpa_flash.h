@@ -0,0 +1,1171 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+// flash-style attention
+// stream key/value through cache sized tiles and keep a running max and sum per query row
+// so that the full dst_seqlen x src_seqlen score matrix is never materialized
+
+static void sdpa_flash_pack_q(const Mat& query_head, float* pp, int i, int max_ii, int K, float scale)
+{
+#if NCNN_BF16
+    if (query_head.elembits() == 16)
+    {
+        for (int ii = 0; ii < max_ii; ii++)
+        {
+            const unsigned short* p0 = query_head.row<const unsigned short>(i + ii);
+
+            for (int k = 0; k < K; k++)
+            {
+                pp[k] = bfloat16_to_float32(p0[k]) * scale;
+            }
+
+            pp += K;
+        }
+
+        return;
+    }
+#endif // NCNN_BF16
+
+    for (int ii = 0; ii < max_ii; ii++)
+    {
+        const float* p0 = query_head.row(i + ii);
+
+        int k = 0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+        __m512 _scale_avx512 = _mm512_set1_ps(scale);
+        for (; k + 15 < K; k += 16)
+        {
+            _mm512_storeu_ps(pp + k, _mm512_mul_ps(_mm512_loadu_ps(p0 + k), _scale_avx512));
+        }
+#endif // __AVX512F__
+        __m256 _scale_avx = _mm256_set1_ps(scale);
+        for (; k + 7 < K; k += 8)
+        {
+            _mm256_storeu_ps(pp + k, _mm256_mul_ps(_mm256_loadu_ps(p0 + k), _scale_avx));
+        }
+#endif // __AVX__
+        __m128 _scale = _mm_set1_ps(scale);
+        for (; k + 3 < K; k += 4)
+        {
+            _mm_storeu_ps(pp + k, _mm_mul_ps(_mm_loadu_ps(p0 + k), _scale));
+        }
+#endif // __SSE2__
+        for (; k < K; k++)
+        {
+            pp[k] = p0[k] * scale;
+        }
+
+        pp += K;
+    }
+}
+
+// kt = K^T tile, K x max_jj with row stride ldkt
+static void sdpa_flash_pack_kt(const Mat& key_head, float* kt, int j, int max_jj, int K, int ldkt)
+{
+#if NCNN_BF16
+    if (key_head.elembits() == 16)
+    {
+        for (int jj = 0; jj < max_jj; jj++)
+        {
+            const unsigned short* p0 = key_head.row<const unsigned short>(j + jj);
+
+            for (int k = 0; k < K; k++)
+            {
+                kt[k * ldkt + jj] = bfloat16_to_float32(p0[k]);
+            }
+        }
+
+        return;
+    }
+#endif // NCNN_BF16
+
+    int jj = 0;
+    for (; jj + 3 < max_jj; jj += 4)
+    {
+        const float* p0 = key_head.row(j + jj);
+        const float* p1 = key_head.row(j + jj + 1);
+        const float* p2 = key_head.row(j + jj + 2);
+        const float* p3 = key_head.row(j + jj + 3);
+
+        float* pp = kt + jj;
+        for (int k = 0; k < K; k++)
+        {
+            pp[0] = p0[k];
+            pp[1] = p1[k];
+            pp[2] = p2[k];
+            pp[3] = p3[k];
+            pp += ldkt;
+        }
+    }
+    for (; jj < max_jj; jj++)
+    {
+        const float* p0 = key_head.row(j + jj);
+
+        float* pp = kt + jj;
+        for (int k = 0; k < K; k++)
+        {
+            pp[0] = p0[k];
+            pp += ldkt;
+        }
+    }
+}
+
+#if NCNN_BF16
+static void sdpa_flash_pack_v_bf16(const Mat& value_head, float* vt, int j, int max_jj, int N)
+{
+    for (int jj = 0; jj < max_jj; jj++)
+    {
+        const unsigned short* p0 = value_head.row<const unsigned short>(j + jj);
+
+        for (int n = 0; n < N; n++)
+        {
+            vt[n] = bfloat16_to_float32(p0[n]);
+        }
+
+        vt += N;
+    }
+}
+#endif // NCNN_BF16
+
+// int8 kv cache row, fp32 dequantize scale followed by K int8 padded to 4 bytes
+static int sdpa_flash_int8_rowsize(int K)
+{
+    return 4 + (K + 3) / 4 * 4;
+}
+
+static void sdpa_flash_quantize_row(const Mat& m, int y, unsigned char* outptr, int K)
+{
+    signed char* pq = (signed char*)outptr + 4;
+
+    // fp32 row or bf16 row
+    const float* p0 = m.row(y);
+#if NCNN_BF16
+    const unsigned short* p0_bf16 = m.row<const unsigned short>(y);
+    const bool is_bf16 = m.elembits() == 16;
+#endif // NCNN_BF16
+
+    float absmax = 0.f;
+    for (int k = 0; k < K; k++)
+    {
+#if NCNN_BF16
+        const float v = is_bf16 ? bfloat16_to_float32(p0_bf16[k]) : p0[k];
+#else
+        const float v = p0[k];
+#endif
+        absmax = std::max(absmax, fabsf(v));
+    }
+
+    const float scale = absmax == 0.f ? 1.f : 127.f / absmax;
+    ((float*)outptr)[0] = absmax / 127.f;
+
+    for (int k = 0; k < K; k++)
+    {
+#if NCNN_BF16
+        const float v = is_bf16 ? bfloat16_to_float32(p0_bf16[k]) : p0[k];
+#else
+        const float v = p0[k];
+#endif
+        pq[k] = float2int8(v * scale);
+    }
+    for (int k = K; k < sdpa_flash_int8_rowsize(K) - 4; k++)
+    {
+        pq[k] = 0;
+    }
+}
+
+// kt = dequantized K^T tile from int8 kv cache rows
+static void sdpa_flash_pack_kt_int8(const Mat& key_head, float* kt, int j, int max_jj, int K, int ldkt)
+{
+    for (int jj = 0; jj < max_jj; jj++)
+    {
+        const unsigned char* p0 = key_head.row<const unsigned char>(j + jj);
+        const float descale = ((const float*)p0)[0];
+        const signed char* pq = (const signed char*)p0 + 4;
+
+        float* pp = kt + jj;
+        for (int k = 0; k < K; k++)
+        {
+            pp[0] = pq[k] * descale;
+            pp += ldkt;
+        }
+    }
+}
+
+// s = q * k^T straight from int8 kv cache rows, for a few query rows such as decode
+static void sdpa_flash_qk_int8(const float* qs, const Mat& key_head, float* s, int j, int max_ii, int max_jj, int K, int lds)
+{
+    for (int jj = 0; jj < max_jj; jj++)
+    {
+        const unsigned char* p0 = key_head.row<const unsigned char>(j + jj);
+        const float descale = ((const float*)p0)[0];
+        const signed char* pq = (const signed char*)p0 + 4;
+
+        for (int ii = 0; ii < max_ii; ii++)
+        {
+            const float* q0 = qs + ii * K;
+
+            float sum = 0.f;
+
+            int k = 0;
+#if __AVX512F__
+            __m512 _sum_avx512 = _mm512_setzero_ps();
+            for (; k + 15 < K; k += 16)
+            {
+                __m512 _k = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)(pq + k))));
+                _sum_avx512 = _mm512_fmadd_ps(_mm512_loadu_ps(q0 + k), _k, _sum_avx512);
+            }
+            sum += _mm512_comp_reduce_add_ps(_sum_avx512);
+#endif // __AVX512F__
+#if __AVX2__
+            __m256 _sum_avx = _mm256_setzero_ps();
+            for (; k + 7 < K; k += 8)
+            {
+                __m256 _k = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(pq + k))));
+                _sum_avx = _mm256_comp_fmadd_ps(_mm256_loadu_ps(q0 + k), _k, _sum_avx);
+            }
+            sum += _mm256_reduce_add_ps(_sum_avx);
+#endif // __AVX2__
+#if __SSE4_1__
+            __m128 _sum = _mm_setzero_ps();
+            for (; k + 3 < K; k += 4)
+            {
+                __m128 _k = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(*(const int*)(pq + k))));
+                _sum = _mm_comp_fmadd_ps(_mm_loadu_ps(q0 + k), _k, _sum);
+            }
+            sum += _mm_reduce_add_ps(_sum);
+#endif // __SSE4_1__
+            for (; k < K; k++)
+            {
+                sum += q0[k] * pq[k];
+            }
+
+            s[ii * lds + jj] = sum * descale;
+        }
+    }
+}
+
+// vt = dequantized value tile from int8 kv cache rows
+static void sdpa_flash_pack_v_int8(const Mat& value_head, float* vt, int j, int max_jj, int N)
+{
+    for (int jj = 0; jj < max_jj; jj++)
+    {
+        const unsigned char* p0 = value_head.row<const unsigned char>(j + jj);
+        const float descale = ((const float*)p0)[0];
+        const signed char* pq = (const signed char*)p0 + 4;
+
+        int n = 0;
+#if __AVX512F__
+        __m512 _descale_avx512 = _mm512_set1_ps(descale);
+        for (; n + 15 < N; n += 16)
+        {
+            __m512 _v = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)(pq + n))));
+            _mm512_storeu_ps(vt + n, _mm512_mul_ps(_v, _descale_avx512));
+        }
+#endif // __AVX512F__
+#if __AVX2__
+        __m256 _descale_avx = _mm256_set1_ps(descale);
+        for (; n + 7 < N; n += 8)
+        {
+            __m256 _v = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(pq + n))));
+            _mm256_storeu_ps(vt + n, _mm256_mul_ps(_v, _descale_avx));
+        }
+#endif // __AVX2__
+#if __SSE4_1__
+        __m128 _descale = _mm_set1_ps(descale);
+        for (; n + 3 < N; n += 4)
+        {
+            __m128 _v = _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(*(const int*)(pq + n))));
+            _mm_storeu_ps(vt + n, _mm_mul_ps(_v, _descale));
+        }
+#endif // __SSE4_1__
+        for (; n < N; n++)
+        {
+            vt[n] = pq[n] * descale;
+        }
+
+        vt += N;
+    }
+}
+
+// s = q * kt, max_ii x max_jj with row stride lds
+static void sdpa_flash_qk(const float* qs, const float* kt, float* s, int max_ii, int max_jj, int K, int ldkt, int lds)
+{
+    int ii = 0;
+    for (; ii + 3 < max_ii; ii += 4)
+    {
+        const float* q0 = qs + ii * K;
+        const float* q1 = q0 + K;
+        const float* q2 = q1 + K;
+        const float* q3 = q2 + K;
+
+        float* s0 = s + ii * lds;
+        float* s1 = s0 + lds;
+        float* s2 = s1 + lds;
+        float* s3 = s2 + lds;
+
+        int jj = 0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+        for (; jj + 31 < max_jj; jj += 32)
+        {
+            const float* pk = kt + jj;
+
+            __m512 _sum00 = _mm512_setzero_ps();
+            __m512 _sum01 = _mm512_setzero_ps();
+            __m512 _sum10 = _mm512_setzero_ps();
+            __m512 _sum11 = _mm512_setzero_ps();
+            __m512 _sum20 = _mm512_setzero_ps();
+            __m512 _sum21 = _mm512_setzero_ps();
+            __m512 _sum30 = _mm512_setzero_ps();
+            __m512 _sum31 = _mm512_setzero_ps();
+
+            for (int k = 0; k < K; k++)
+            {
+                __m512 _k0 = _mm512_loadu_ps(pk);
+                __m512 _k1 = _mm512_loadu_ps(pk + 16);
+                __m512 _q0 = _mm512_set1_ps(q0[k]);
+                __m512 _q1 = _mm512_set1_ps(q1[k]);
+                __m512 _q2 = _mm512_set1_ps(q2[k]);
+                __m512 _q3 = _mm512_set1_ps(q3[k]);
+                _sum00 = _mm512_fmadd_ps(_q0, _k0, _sum00);
+                _sum01 = _mm512_fmadd_ps(_q0, _k1, _sum01);
+                _sum10 = _mm512_fmadd_ps(_q1, _k0, _sum10);
+                _sum11 = _mm512_fmadd_ps(_q1, _k1, _sum11);
+                _sum20 = _mm512_fmadd_ps(_q2, _k0, _sum20);
+                _sum21 = _mm512_fmadd_ps(_q2, _k1, _sum21);
+                _sum30 = _mm512_fmadd_ps(_q3, _k0, _sum30);
+                _sum31 = _mm512_fmadd_ps(_q3, _k1, _sum31);
+                pk += ldkt;
+            }
+
+            _mm512_storeu_ps(s0 + jj, _sum00);
+            _mm512_storeu_ps(s0 + jj + 16, _sum01);
+            _mm512_storeu_ps(s1 + jj, _sum10);
+            _mm512_storeu_ps(s1 + jj + 16, _sum11);
+            _mm512_storeu_ps(s2 + jj, _sum20);
+            _mm512_storeu_ps(s2 + jj + 16, _sum21);
+            _mm512_storeu_ps(s3 + jj, _sum30);
+            _mm512_storeu_ps(s3 + jj + 16, _sum31);
+        }
+        for (; jj + 15 < max_jj; jj += 16)
+        {
+            const float* pk = kt + jj;
+
+            __m512 _sum0 = _mm512_setzero_ps();
+            __m512 _sum1 = _mm512_setzero_ps();
+            __m512 _sum2 = _mm512_setzero_ps();
+            __m512 _sum3 = _mm512_setzero_ps();
+
+            for (int k = 0; k < K; k++)
+            {
+                __m512 _k = _mm512_loadu_ps(pk);
+                _sum0 = _mm512_fmadd_ps(_mm512_set1_ps(q0[k]), _k, _sum0);
+                _sum1 = _mm512_fmadd_ps(_mm512_set1_ps(q1[k]), _k, _sum1);
+                _sum2 = _mm512_fmadd_ps(_mm512_set1_ps(q2[k]), _k, _sum2);
+                _sum3 = _mm512_fmadd_ps(_mm512_set1_ps(q3[k]), _k, _sum3);
+                pk += ldkt;
+            }
+
+            _mm512_storeu_ps(s0 + jj, _sum0);
+            _mm512_storeu_ps(s1 + jj, _sum1);
+            _mm512_storeu_ps(s2 + jj, _sum2);
+            _mm512_storeu_ps(s3 + jj, _sum3);
+        }
+#endif // __AVX512F__
+        for (; jj + 15 < max_jj; jj += 16)
+        {
+            const float* pk = kt + jj;
+
+            __m256 _sum00 = _mm256_setzero_ps();
+            __m256 _sum01 = _mm256_setzero_ps();
+            __m256 _sum10 = _mm256_setzero_ps();
+            __m256 _sum11 = _mm256_setzero_ps();
+            __m256 _sum20 = _mm256_setzero_ps();
+            __m256 _sum21 = _mm256_setzero_ps();
+            __m256 _sum30 = _mm256_setzero_ps();
+            __m256 _sum31 = _mm256_setzero_ps();
+
+            for (int k = 0; k < K; k++)
+            {
+                __m256 _k0 = _mm256_loadu_ps(pk);
+                __m256 _k1 = _mm256_loadu_ps(pk + 8);
+                __m256 _q0 = _mm256_set1_ps(q0[k]);
+                __m256 _q1 = _mm256_set1_ps(q1[k]);
+                __m256 _q2 = _mm256_set1_ps(q2[k]);
+                __m256 _q3 = _mm256_set1_ps(q3[k]);
+                _sum00 = _mm256_comp_fmadd_ps(_q0, _k0, _sum00);
+                _sum01 = _mm256_comp_fmadd_ps(_q0, _k1, _sum01);
+                _sum10 = _mm256_comp_fmadd_ps(_q1, _k0, _sum10);
+                _sum11 = _mm256_comp_fmadd_ps(_q1, _k1, _sum11);
+                _sum20 = _mm256_comp_fmadd_ps(_q2, _k0, _sum20);
+                _sum21 = _mm256_comp_fmadd_ps(_q2, _k1, _sum21);
+                _sum30 = _mm256_comp_fmadd_ps(_q3, _k0, _sum30);
+                _sum31 = _mm256_comp_fmadd_ps(_q3, _k1, _sum31);
+                pk += ldkt;
+            }
+
+            _mm256_storeu_ps(s0 + jj, _sum00);
+            _mm256_storeu_ps(s0 + jj + 8, _sum01);
+            _mm256_storeu_ps(s1 + jj, _sum10);
+            _mm256_storeu_ps(s1 + jj + 8, _sum11);
+            _mm256_storeu_ps(s2 + jj, _sum20);
+            _mm256_storeu_ps(s2 + jj + 8, _sum21);
+            _mm256_storeu_ps(s3 + jj, _sum30);
+            _mm256_storeu_ps(s3 + jj + 8, _sum31);
+        }
+        for (; jj + 7 < max_jj; jj += 8)
+        {
+            const float* pk = kt + jj;
+
+            __m256 _sum0 = _mm256_setzero_ps();
+            __m256 _sum1 = _mm256_setzero_ps();
+            __m256 _sum2 = _mm256_setzero_ps();
+            __m256 _sum3 = _mm256_setzero_ps();
+
+            for (int k = 0; k < K; k++)
+            {
+                __m256 _k = _mm256_loadu_ps(pk);
+                _sum0 = _mm256_comp_fmadd_ps(_mm256_set1_ps(q0[k]), _k, _sum0);
+                _sum1 = _mm256_comp_fmadd_ps(_mm256_set1_ps(q1[k]), _k, _sum1);
+                _sum2 = _mm256_comp_fmadd_ps(_mm256_set1_ps(q2[k]), _k, _sum2);
+                _sum3 = _mm256_comp_fmadd_ps(_mm256_set1_ps(q3[k]), _k, _sum3);
+                pk += ldkt;
+            }
+
+            _mm256_storeu_ps(s0 + jj, _sum0);
+            _mm256_storeu_ps(s1 + jj, _sum1);
+            _mm256_storeu_ps(s2 + jj, _sum2);
+            _mm256_storeu_ps(s3 + jj, _sum3);
+        }
+#endif // __AVX__
+        for (; jj + 3 < max_jj; jj += 4)
+        {
+            const float* pk = kt + jj;
+
+            __m128 _sum0 = _mm_setzero_ps();
+            __m128 _sum1 = _mm_setzero_ps();
+            __m128 _sum2 = _mm_setzero_ps();
+            __m128 _sum3 = _mm_setzero_ps();
+
+            for (int k = 0; k < K; k++)
+            {
+                __m128 _k = _mm_loadu_ps(pk);
+                _sum0 = _mm_comp_fmadd_ps(_mm_set1_ps(q0[k]), _k, _sum0);
+                _sum1 = _mm_comp_fmadd_ps(_mm_set1_ps(q1[k]), _k, _sum1);
+                _sum2 = _mm_comp_fmadd_ps(_mm_set1_ps(q2[k]), _k, _sum2);
+                _sum3 = _mm_comp_fmadd_ps(_mm_set1_ps(q3[k]), _k, _sum3);
+                pk += ldkt;
+            }
+
+            _mm_storeu_ps(s0 + jj, _sum0);
+            _mm_storeu_ps(s1 + jj, _sum1);
+            _mm_storeu_ps(s2 + jj, _sum2);
+            _mm_storeu_ps(s3 + jj, _sum3);
+        }
+#endif // __SSE2__
+        for (; jj < max_jj; jj++)
+        {
+            const float* pk = kt + jj;
+
+            float sum0 = 0.f;
+            float sum1 = 0.f;
+            float sum2 = 0.f;
+            float sum3 = 0.f;
+
+            for (int k = 0; k < K; k++)
+            {
+                sum0 += q0[k] * pk[0];
+                sum1 += q1[k] * pk[0];
+                sum2 += q2[k] * pk[0];
+                sum3 += q3[k] * pk[0];
+                pk += ldkt;
+            }
+
+            s0[jj] = sum0;
+            s1[jj] = sum1;
+            s2[jj] = sum2;
+            s3[jj] = sum3;
+        }
+    }
+    for (; ii < max_ii; ii++)
+    {
+        const float* q0 = qs + ii * K;
+
+        float* s0 = s + ii * lds;
+
+        int jj = 0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+        for (; jj + 15 < max_jj; jj += 16)
+        {
+            const float* pk = kt + jj;
+
+            __m512 _sum0 = _mm512_setzero_ps();
+
+            for (int k = 0; k < K; k++)
+            {
+                _sum0 = _mm512_fmadd_ps(_mm512_set1_ps(q0[k]), _mm512_loadu_ps(pk), _sum0);
+                pk += ldkt;
+            }
+
+            _mm512_storeu_ps(s0 + jj, _sum0);
+        }
+#endif // __AVX512F__
+        for (; jj + 7 < max_jj; jj += 8)
+        {
+            const float* pk = kt + jj;
+
+            __m256 _sum0 = _mm256_setzero_ps();
+
+            for (int k = 0; k < K; k++)
+            {
+                _sum0 = _mm256_comp_fmadd_ps(_mm256_set1_ps(q0[k]), _mm256_loadu_ps(pk), _sum0);
+                pk += ldkt;
+            }
+
+            _mm256_storeu_ps(s0 + jj, _sum0);
+        }
+#endif // __AVX__
+        for (; jj + 3 < max_jj; jj += 4)
+        {
+            const float* pk = kt + jj;
+
+            __m128 _sum0 = _mm_setzero_ps();
+
+            for (int k = 0; k < K; k++)
+            {
+                _sum0 = _mm_comp_fmadd_ps(_mm_set1_ps(q0[k]), _mm_loadu_ps(pk), _sum0);
+                pk += ldkt;
+            }
+
+            _mm_storeu_ps(s0 + jj, _sum0);
+        }
+#endif // __SSE2__
+        for (; jj < max_jj; jj++)
+        {
+            const float* pk = kt + jj;
+
+            float sum0 = 0.f;
+
+            for (int k = 0; k < K; k++)
+            {
+                sum0 += q0[k] * pk[0];
+                pk += ldkt;
+            }
+
+            s0[jj] = sum0;
+        }
+    }
+}
+
+static void sdpa_flash_add_mask(const Mat& maskm, float* s, int i, int max_ii, int j, int max_jj, int lds)
+{
+    for (int ii = 0; ii < max_ii; ii++)
+    {
+        float* ptr = s + ii * lds;
+
+#if NCNN_BF16
+        if (maskm.elembits() == 16)
+        {
+            const unsigned short* mptr = maskm.row<const unsigned short>(i + ii) + j;
+
+            for (int jj = 0; jj < max_jj; jj++)
+            {
+                ptr[jj] += bfloat16_to_float32(mptr[jj]);
+            }
+
+            continue;
+        }
+#endif // NCNN_BF16
+
+        const float* mptr = maskm.row(i + ii) + j;
+
+        int jj = 0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+        for (; jj + 15 < max_jj; jj += 16)
+        {
+            _mm512_storeu_ps(ptr + jj, _mm512_add_ps(_mm512_loadu_ps(ptr + jj), _mm512_loadu_ps(mptr + jj)));
+        }
+#endif // __AVX512F__
+        for (; jj + 7 < max_jj; jj += 8)
+        {
+            _mm256_storeu_ps(ptr + jj, _mm256_add_ps(_mm256_loadu_ps(ptr + jj), _mm256_loadu_ps(mptr + jj)));
+        }
+#endif // __AVX__
+        for (; jj + 3 < max_jj; jj += 4)
+        {
+            _mm_storeu_ps(ptr + jj, _mm_add_ps(_mm_loadu_ps(ptr + jj), _mm_loadu_ps(mptr + jj)));
+        }
+#endif // __SSE2__
+        for (; jj < max_jj; jj++)
+        {
+            ptr[jj] += mptr[jj];
+        }
+    }
+}
+
+// turn one score row into exp(s - max) in place, update running max and sum
+// return the rescale factor for the previous partial output
+static float sdpa_flash_online_softmax(float* ptr, int max_jj, float& max, float& sum)
+{
+    float new_max = max;
+    {
+        int jj = 0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+        __m512 _max_avx512 = _mm512_set1_ps(-FLT_MAX);
+        for (; jj + 15 < max_jj; jj += 16)
+        {
+            _max_avx512 = _mm512_max_ps(_max_avx512, _mm512_loadu_ps(ptr + jj));
+        }
+        new_max = std::max(new_max, _mm512_comp_reduce_max_ps(_max_avx512));
+#endif // __AVX512F__
+        __m256 _max_avx = _mm256_set1_ps(-FLT_MAX);
+        for (; jj + 7 < max_jj; jj += 8)
+        {
+            _max_avx = _mm256_max_ps(_max_avx, _mm256_loadu_ps(ptr + jj));
+        }
+        new_max = std::max(new_max, _mm256_reduce_max_ps(_max_avx));
+#endif // __AVX__
+        __m128 _max = _mm_set1_ps(-FLT_MAX);
+        for (; jj + 3 < max_jj; jj += 4)
+        {
+            _max = _mm_max_ps(_max, _mm_loadu_ps(ptr + jj));
+        }
+        new_max = std::max(new_max, _mm_reduce_max_ps(_max));
+#endif // __SSE2__
+        for (; jj < max_jj; jj++)
+        {
+            new_max = std::max(new_max, ptr[jj]);
+        }
+    }
+
+    float tile_sum = 0.f;
+    {
+        int jj = 0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+        __m512 _new_max_avx512 = _mm512_set1_ps(new_max);
+        __m512 _sum_avx512 = _mm512_setzero_ps();
+        for (; jj + 15 < max_jj; jj += 16)
+        {
+            __m512 _p = exp512_ps(_mm512_sub_ps(_mm512_loadu_ps(ptr + jj), _new_max_avx512));
+            _mm512_storeu_ps(ptr + jj, _p);
+            _sum_avx512 = _mm512_add_ps(_sum_avx512, _p);
+        }
+        tile_sum += _mm512_comp_reduce_add_ps(_sum_avx512);
+#endif // __AVX512F__
+        __m256 _new_max_avx = _mm256_set1_ps(new_max);
+        __m256 _sum_avx = _mm256_setzero_ps();
+        for (; jj + 7 < max_jj; jj += 8)
+        {
+            __m256 _p = exp256_ps(_mm256_sub_ps(_mm256_loadu_ps(ptr + jj), _new_max_avx));
+            _mm256_storeu_ps(ptr + jj, _p);
+            _sum_avx = _mm256_add_ps(_sum_avx, _p);
+        }
+        tile_sum += _mm256_reduce_add_ps(_sum_avx);
+#endif // __AVX__
+        __m128 _new_max = _mm_set1_ps(new_max);
+        __m128 _sum = _mm_setzero_ps();
+        for (; jj + 3 < max_jj; jj += 4)
+        {
+            __m128 _p = exp_ps(_mm_sub_ps(_mm_loadu_ps(ptr + jj), _new_max));
+            _mm_storeu_ps(ptr + jj, _p);
+            _sum = _mm_add_ps(_sum, _p);
+        }
+        tile_sum += _mm_reduce_add_ps(_sum);
+#endif // __SSE2__
+        for (; jj < max_jj; jj++)
+        {
+            ptr[jj] = expf(ptr[jj] - new_max);
+            tile_sum += ptr[jj];
+        }
+    }
+
+    const float rescale = expf(max - new_max);
+
+    sum = sum * rescale + tile_sum;
+    max = new_max;
+
+    return rescale;
+}
+
+// o = o * rescale + s * v, v is max_jj x N with row stride ldv
+static void sdpa_flash_pv(const float* s, const float* v, float* o, const float* rescales, int max_ii, int max_jj, int N, int lds, int ldv)
+{
+    int ii = 0;
+    for (; ii + 3 < max_ii; ii += 4)
+    {
+        const float* s0 = s + ii * lds;
+        const float* s1 = s0 + lds;
+        const float* s2 = s1 + lds;
+        const float* s3 = s2 + lds;
+
+        float* o0 = o + ii * N;
+        float* o1 = o0 + N;
+        float* o2 = o1 + N;
+        float* o3 = o2 + N;
+
+        int n = 0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+        for (; n + 31 < N; n += 32)
+        {
+            __m512 _r0 = _mm512_set1_ps(rescales[ii]);
+            __m512 _r1 = _mm512_set1_ps(rescales[ii + 1]);
+            __m512 _r2 = _mm512_set1_ps(rescales[ii + 2]);
+            __m512 _r3 = _mm512_set1_ps(rescales[ii + 3]);
+            __m512 _o00 = _mm512_mul_ps(_mm512_loadu_ps(o0 + n), _r0);
+            __m512 _o01 = _mm512_mul_ps(_mm512_loadu_ps(o0 + n + 16), _r0);
+            __m512 _o10 = _mm512_mul_ps(_mm512_loadu_ps(o1 + n), _r1);
+            __m512 _o11 = _mm512_mul_ps(_mm512_loadu_ps(o1 + n + 16), _r1);
+            __m512 _o20 = _mm512_mul_ps(_mm512_loadu_ps(o2 + n), _r2);
+            __m512 _o21 = _mm512_mul_ps(_mm512_loadu_ps(o2 + n + 16), _r2);
+            __m512 _o30 = _mm512_mul_ps(_mm512_loadu_ps(o3 + n), _r3);
+            __m512 _o31 = _mm512_mul_ps(_mm512_loadu_ps(o3 + n + 16), _r3);
+
+            const float* pv = v + n;
+            for (int jj = 0; jj < max_jj; jj++)
+            {
+                __m512 _v0 = _mm512_loadu_ps(pv);
+                __m512 _v1 = _mm512_loadu_ps(pv + 16);
+                __m512 _s0 = _mm512_set1_ps(s0[jj]);
+                __m512 _s1 = _mm512_set1_ps(s1[jj]);
+                __m512 _s2 = _mm512_set1_ps(s2[jj]);
+                __m512 _s3 = _mm512_set1_ps(s3[jj]);
+                _o00 = _mm512_fmadd_ps(_s0, _v0, _o00);
+                _o01 = _mm512_fmadd_ps(_s0, _v1, _o01);
+                _o10 = _mm512_fmadd_ps(_s1, _v0, _o10);
+                _o11 = _mm512_fmadd_ps(_s1, _v1, _o11);
+                _o20 = _mm512_fmadd_ps(_s2, _v0, _o20);
+                _o21 = _mm512_fmadd_ps(_s2, _v1, _o21);
+                _o30 = _mm512_fmadd_ps(_s3, _v0, _o30);
+                _o31 = _mm512_fmadd_ps(_s3, _v1, _o31);
+                pv += ldv;
+            }
+
+            _mm512_storeu_ps(o0 + n, _o00);
+            _mm512_storeu_ps(o0 + n + 16, _o01);
+            _mm512_storeu_ps(o1 + n, _o10);
+            _mm512_storeu_ps(o1 + n + 16, _o11);
+            _mm512_storeu_ps(o2 + n, _o20);
+            _mm512_storeu_ps(o2 + n + 16, _o21);
+            _mm512_storeu_ps(o3 + n, _o30);
+            _mm512_storeu_ps(o3 + n + 16, _o31);
+        }
+        for (; n + 15 < N; n += 16)
+        {
+            __m512 _o0 = _mm512_mul_ps(_mm512_loadu_ps(o0 + n), _mm512_set1_ps(rescales[ii]));
+            __m512 _o1 = _mm512_mul_ps(_mm512_loadu_ps(o1 + n), _mm512_set1_ps(rescales[ii + 1]));
+            __m512 _o2 = _mm512_mul_ps(_mm512_loadu_ps(o2 + n), _mm512_set1_ps(rescales[ii + 2]));
+            __m512 _o3 = _mm512_mul_ps(_mm512_loadu_ps(o3 + n), _mm512_set1_ps(rescales[ii + 3]));
+
+            const float* pv = v + n;
+            for (int jj = 0; jj < max_jj; jj++)
+            {
+                __m512 _v = _mm512_loadu_ps(pv);
+                _o0 = _mm512_fmadd_ps(_mm512_set1_ps(s0[jj]), _v, _o0);
+                _o1 = _mm512_fmadd_ps(_mm512_set1_ps(s1[jj]), _v, _o1);
+                _o2 = _mm512_fmadd_ps(_mm512_set1_ps(s2[jj]), _v, _o2);
+                _o3 = _mm512_fmadd_ps(_mm512_set1_ps(s3[jj]), _v, _o3);
+                pv += ldv;
+            }
+
+            _mm512_storeu_ps(o0 + n, _o0);
+            _mm512_storeu_ps(o1 + n, _o1);
+            _mm512_storeu_ps(o2 + n, _o2);
+            _mm512_storeu_ps(o3 + n, _o3);
+        }
+#endif // __AVX512F__
+        for (; n + 15 < N; n += 16)
+        {
+            __m256 _r0 = _mm256_set1_ps(rescales[ii]);
+            __m256 _r1 = _mm256_set1_ps(rescales[ii + 1]);
+            __m256 _r2 = _mm256_set1_ps(rescales[ii + 2]);
+            __m256 _r3 = _mm256_set1_ps(rescales[ii + 3]);
+            __m256 _o00 = _mm256_mul_ps(_mm256_loadu_ps(o0 + n), _r0);
+            __m256 _o01 = _mm256_mul_ps(_mm256_loadu_ps(o0 + n + 8), _r0);
+            __m256 _o10 = _mm256_mul_ps(_mm256_loadu_ps(o1 + n), _r1);
+            __m256 _o11 = _mm256_mul_ps(_mm256_loadu_ps(o1 + n + 8), _r1);
+            __m256 _o20 = _mm256_mul_ps(_mm256_loadu_ps(o2 + n), _r2);
+            __m256 _o21 = _mm256_mul_ps(_mm256_loadu_ps(o2 + n + 8), _r2);
+            __m256 _o30 = _mm256_mul_ps(_mm256_loadu_ps(o3 + n), _r3);
+            __m256 _o31 = _mm256_mul_ps(_mm256_loadu_ps(o3 + n + 8), _r3);
+
+            const float* pv = v + n;
+            for (int jj = 0; jj < max_jj; jj++)
+            {
+                __m256 _v0 = _mm256_loadu_ps(pv);
+                __m256 _v1 = _mm256_loadu_ps(pv + 8);
+                __m256 _s0 = _mm256_set1_ps(s0[jj]);
+                __m256 _s1 = _mm256_set1_ps(s1[jj]);
+                __m256 _s2 = _mm256_set1_ps(s2[jj]);
+                __m256 _s3 = _mm256_set1_ps(s3[jj]);
+                _o00 = _mm256_comp_fmadd_ps(_s0, _v0, _o00);
+                _o01 = _mm256_comp_fmadd_ps(_s0, _v1, _o01);
+                _o10 = _mm256_comp_fmadd_ps(_s1, _v0, _o10);
+                _o11 = _mm256_comp_fmadd_ps(_s1, _v1, _o11);
+                _o20 = _mm256_comp_fmadd_ps(_s2, _v0, _o20);
+                _o21 = _mm256_comp_fmadd_ps(_s2, _v1, _o21);
+                _o30 = _mm256_comp_fmadd_ps(_s3, _v0, _o30);
+                _o31 = _mm256_comp_fmadd_ps(_s3, _v1, _o31);
+                pv += ldv;
+            }
+
+            _mm256_storeu_ps(o0 + n, _o00);
+            _mm256_storeu_ps(o0 + n + 8, _o01);
+            _mm256_storeu_ps(o1 + n, _o10);
+            _mm256_storeu_ps(o1 + n + 8, _o11);
+            _mm256_storeu_ps(o2 + n, _o20);
+            _mm256_storeu_ps(o2 + n + 8, _o21);
+            _mm256_storeu_ps(o3 + n, _o30);
+            _mm256_storeu_ps(o3 + n + 8, _o31);
+        }
+        for (; n + 7 < N; n += 8)
+        {
+            __m256 _o0 = _mm256_mul_ps(_mm256_loadu_ps(o0 + n), _mm256_set1_ps(rescales[ii]));
+            __m256 _o1 = _mm256_mul_ps(_mm256_loadu_ps(o1 + n), _mm256_set1_ps(rescales[ii + 1]));
+            __m256 _o2 = _mm256_mul_ps(_mm256_loadu_ps(o2 + n), _mm256_set1_ps(rescales[ii + 2]));
+            __m256 _o3 = _mm256_mul_ps(_mm256_loadu_ps(o3 + n), _mm256_set1_ps(rescales[ii + 3]));
+
+            const float* pv = v + n;
+            for (int jj = 0; jj < max_jj; jj++)
+            {
+                __m256 _v = _mm256_loadu_ps(pv);
+                _o0 = _mm256_comp_fmadd_ps(_mm256_set1_ps(s0[jj]), _v, _o0);
+                _o1 = _mm256_comp_fmadd_ps(_mm256_set1_ps(s1[jj]), _v, _o1);
+                _o2 = _mm256_comp_fmadd_ps(_mm256_set1_ps(s2[jj]), _v, _o2);
+                _o3 = _mm256_comp_fmadd_ps(_mm256_set1_ps(s3[jj]), _v, _o3);
+                pv += ldv;
+            }
+
+            _mm256_storeu_ps(o0 + n, _o0);
+            _mm256_storeu_ps(o1 + n, _o1);
+            _mm256_storeu_ps(o2 + n, _o2);
+            _mm256_storeu_ps(o3 + n, _o3);
+        }
+#endif // __AVX__
+        for (; n + 3 < N; n += 4)
+        {
+            __m128 _o0 = _mm_mul_ps(_mm_loadu_ps(o0 + n), _mm_set1_ps(rescales[ii]));
+            __m128 _o1 = _mm_mul_ps(_mm_loadu_ps(o1 + n), _mm_set1_ps(rescales[ii + 1]));
+            __m128 _o2 = _mm_mul_ps(_mm_loadu_ps(o2 + n), _mm_set1_ps(rescales[ii + 2]));
+            __m128 _o3 = _mm_mul_ps(_mm_loadu_ps(o3 + n), _mm_set1_ps(rescales[ii + 3]));
+
+            const float* pv = v + n;
+            for (int jj = 0; jj < max_jj; jj++)
+            {
+                __m128 _v = _mm_loadu_ps(pv);
+                _o0 = _mm_comp_fmadd_ps(_mm_set1_ps(s0[jj]), _v, _o0);
+                _o1 = _mm_comp_fmadd_ps(_mm_set1_ps(s1[jj]), _v, _o1);
+                _o2 = _mm_comp_fmadd_ps(_mm_set1_ps(s2[jj]), _v, _o2);
+                _o3 = _mm_comp_fmadd_ps(_mm_set1_ps(s3[jj]), _v, _o3);
+                pv += ldv;
+            }
+
+            _mm_storeu_ps(o0 + n, _o0);
+            _mm_storeu_ps(o1 + n, _o1);
+            _mm_storeu_ps(o2 + n, _o2);
+            _mm_storeu_ps(o3 + n, _o3);
+        }
+#endif // __SSE2__
+        for (; n < N; n++)
+        {
+            float sum0 = o0[n] * rescales[ii];
+            float sum1 = o1[n] * rescales[ii + 1];
+            float sum2 = o2[n] * rescales[ii + 2];
+            float sum3 = o3[n] * rescales[ii + 3];
+
+            const float* pv = v + n;
+            for (int jj = 0; jj < max_jj; jj++)
+            {
+                sum0 += s0[jj] * pv[0];
+                sum1 += s1[jj] * pv[0];
+                sum2 += s2[jj] * pv[0];
+                sum3 += s3[jj] * pv[0];
+                pv += ldv;
+            }
+
+            o0[n] = sum0;
+            o1[n] = sum1;
+            o2[n] = sum2;
+            o3[n] = sum3;
+        }
+    }
+    for (; ii < max_ii; ii++)
+    {
+        const float* s0 = s + ii * lds;
+
+        float* o0 = o + ii * N;
+
+        int n = 0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+        for (; n + 15 < N; n += 16)
+        {
+            __m512 _o0 = _mm512_mul_ps(_mm512_loadu_ps(o0 + n), _mm512_set1_ps(rescales[ii]));
+
+            const float* pv = v + n;
+            for (int jj = 0; jj < max_jj; jj++)
+            {
+                _o0 = _mm512_fmadd_ps(_mm512_set1_ps(s0[jj]), _mm512_loadu_ps(pv), _o0);
+                pv += ldv;
+            }
+
+            _mm512_storeu_ps(o0 + n, _o0);
+        }
+#endif // __AVX512F__
+        for (; n + 7 < N; n += 8)
+        {
+            __m256 _o0 = _mm256_mul_ps(_mm256_loadu_ps(o0 + n), _mm256_set1_ps(rescales[ii]));
+
+            const float* pv = v + n;
+            for (int jj = 0; jj < max_jj; jj++)
+            {
+                _o0 = _mm256_comp_fmadd_ps(_mm256_set1_ps(s0[jj]), _mm256_loadu_ps(pv), _o0);
+                pv += ldv;
+            }
+
+            _mm256_storeu_ps(o0 + n, _o0);
+        }
+#endif // __AVX__
+        for (; n + 3 < N; n += 4)
+        {
+            __m128 _o0 = _mm_mul_ps(_mm_loadu_ps(o0 + n), _mm_set1_ps(rescales[ii]));
+
+            const float* pv = v + n;
+            for (int jj = 0; jj < max_jj; jj++)
+            {
+                _o0 = _mm_comp_fmadd_ps(_mm_set1_ps(s0[jj]), _mm_loadu_ps(pv), _o0);
+                pv += ldv;
+            }
+
+            _mm_storeu_ps(o0 + n, _o0);
+        }
+#endif // __SSE2__
+        for (; n < N; n++)
+        {
+            float sum0 = o0[n] * rescales[ii];
+
+            const float* pv = v + n;
+            for (int jj = 0; jj < max_jj; jj++)
+            {
+                sum0 += s0[jj] * pv[0];
+                pv += ldv;
+            }
+
+            o0[n] = sum0;
+        }
+    }
+}
+
+static void sdpa_flash_store_output(const float* o, const float* sums, Mat& top_blob_head, int i, int max_ii, int N)
+{
+    for (int ii = 0; ii < max_ii; ii++)
+    {
+        const float* p0 = o + ii * N;
+        float* outptr = top_blob_head.row(i + ii);
+
+        const float inv_sum = 1.f / sums[ii];
+
+        int n = 0;
+#if __SSE2__
+#if __AVX__
+#if __AVX512F__
+        __m512 _inv_sum_avx512 = _mm512_set1_ps(inv_sum);
+        for (; n + 15 < N; n += 16)
+        {
+            _mm512_storeu_ps(outptr + n, _mm512_mul_ps(_mm512_loadu_ps(p0 + n), _inv_sum_avx512));
+        }
+#endif // __AVX512F__
+        __m256 _inv_sum_avx = _mm256_set1_ps(inv_sum);
+        for (; n + 7 < N; n += 8)
+        {
+            _mm256_storeu_ps(outptr + n, _mm256_mul_ps(_mm256_loadu_ps(p0 + n), _inv_sum_avx));
+        }
+#endif // __AVX__
+        __m128 _inv_sum = _mm_set1_ps(inv_sum);
+        for (; n + 3 < N; n += 4)
+        {
+            _mm_storeu_ps(outptr + n, _mm_mul_ps(_mm_loadu_ps(p0 + n), _inv_sum));
+        }
+#endif // __SSE2__
+        for (; n < N; n++)
+        {
+            outptr[n] = p0[n] * inv_sum;
+        }
+    }
+}
+
+static void sdpa_flash_get_optimal_tile_mn(int M, int N, int K, int V, int num_heads, int nT, int& TILE_M, int& TILE_N)
+{
+    // key and value tiles are shared by the query rows of a block, keep both in half of l2
+    const int l2_cache_size = get_cpu_level2_cache_size();
+
+    TILE_N = l2_cache_size / 2 / (int)((K + V) * sizeof(float));
+    TILE_N = std::max(16, std::min(TILE_N, 512) / 16 * 16);
+    TILE_N = std::min(TILE_N, (N + 3) / 4 * 4);
+
+    TILE_M = 64;
+    if (num_heads * ((M + TILE_M - 1) / TILE_M) < nT)
+    {
+        // split query rows further so that every thread gets a block
+        const int nn_M = std::max(1, nT / num_heads);
+        TILE_M = std::max(4, ((M + nn_M - 1) / nn_M + 3) / 4 * 4);
+    }
+    TILE_M = std::min(TILE_M, M);
+}
+
+// rows of head q in the block holding token j of a paged kv cache
+static Mat sdpa_flash_paged_head(const Mat& cache, int q, int j)
+{
+    const PagedKVCacheTable* table = (const PagedKVCacheTable*)cache.data;
+    const int block_seqlen = table->block_seqlen;
+    unsigned char* block = (unsigned char*)table->blocks[j / block_seqlen];
+
+    return Mat(cache.w, block_seqlen, block + cache.cstep * q * cache.elemsize, cache.elemsize);
+}
+
+// key and value are paged kv caches when block_seqlen > 0, key tiles never cross a block
+// key and value are int8 kv caches when elemsize is 1, see sdpa_flash_quantize_row
+static int sdpa_flash_attention(const Mat& query, const Mat& key, const Mat& value, const Mat& attn_mask_blob, Mat& top_blob, float scale, int block_seqlen, const Option& opt)
+{
+    const int embed_dim = query.w;
+    const int src_seqlen = query.h;
+    const int num_heads = query.c;
+    const int dst_seqlen = key.h;
+    const int num_group = key.c;
+    const int out_embed_dim = top_blob.w;
+
+    const int num_heads_per_group = num_heads / num_group;
+
+    int TILE_M, TILE_N;
+    sdpa_flash_get_optimal_tile_mn(src_seqlen, dst_seqlen, embed_dim, out_embed_dim, num_heads, opt.num_threads, TILE_M, TILE_N);
+
+    const bool value_is_bf16 = value.elembits() == 16;
+
+    // int8 kv cache rows are dequantized tile by tile
+    const bool kvcache_is_int8 = key.elemsize == 1;
+
+    // per thread scratch: q tile, k^T tile, optional fp32 v tile, scores, partial output, max, sum, rescale
+    const size_t qs_size = (size_t)TILE_M * embed_dim;
+    const size_t kt_size = (size_t)embed_dim * TILE_N;
+    const size_t vt_size = value_is_bf16 || kvcache_is_int8 ? (size_t)TILE_N * out_embed_dim : 0;
+    const size_t s_size = (size_t)TILE_M * TILE_N;
+    const size_t o_size = (size_t)TILE_M * out_embed_dim;
+    const size_t scratch_size = qs_size + kt_size + vt_size + s_size + o_size + TILE_M * 3;
+
+    Mat scratch((int)scratch_size, 1, opt.num_threads, 4u, opt.workspace_allocator);
+    if (scratch.empty())
+        return -100;
+
+    const int nn_M = (src_seqlen + TILE_M - 1) / TILE_M;
+
+    #pragma omp parallel for num_threads(opt.num_threads)
+    for (int ppi = 0; ppi < num_heads * nn_M; ppi++)
+    {
+        const int q = ppi / nn_M;
+        const int i = (ppi % nn_M) * TILE_M;
+        const int max_ii = std::min(src_seqlen - i, TILE_M);
+
+        const Mat query_head = query.channel(q);
+        Mat key_head = block_seqlen ? Mat() : key.channel(q / num_heads_per_group);
+        Mat value_head = block_seqlen ? Mat() : value.channel(q / num_heads_per_group);
+        Mat top_blob_head = top_blob.channel(q);
+
+        Mat maskm;
+        if (!attn_mask_blob.empty())
+        {
+            maskm = attn_mask_blob.dims == 3 ? attn_mask_blob.channel(attn_mask_blob.c > 1 ? q : 0) : attn_mask_blob;
+        }
+
+        float* qs = scratch.channel(get_omp_thread_num());
+        float* kt = qs + qs_size;
+        float* vt = kt + kt_size;
+        float* s = vt + vt_size;
+        float* o = s + s_size;
+        float* maxs = o + o_size;
+        float* sums = maxs + TILE_M;
+        float* rescales = sums + TILE_M;
+
+        sdpa_flash_pack_q(query_head, qs, i, max_ii, embed_dim, scale);
+
+        memset(o, 0, max_ii * out_embed_dim * sizeof(float));
+        for (int ii = 0; ii < max_ii; ii++)
+        {
+            maxs[ii] = -FLT_MAX;
+            sums[ii] = 0.f;
+        }
+
+        for (int j = 0; j < dst_seqlen;)
+        {
+            int max_jj = std::min(dst_seqlen - j, TILE_N);
+
+            // row of the tile in key_head and value_head
+            int jk = j;
+            if (block_seqlen)
+            {
+                key_head = sdpa_flash_paged_head(key, q / num_heads_per_group, j);
+                value_head = sdpa_flash_paged_head(value, q / num_heads_per_group, j);
+                jk = j % block_seqlen;
+                max_jj = std::min(max_jj, block_seqlen - jk);
+            }
+
+            if (kvcache_is_int8 && max_ii < 4)
+            {
+                sdpa_flash_qk_int8(qs, key_head, s, jk, max_ii, max_jj, embed_dim, TILE_N);
+            }
+            else
+            {
+                if (kvcache_is_int8)
+                    sdpa_flash_pack_kt_int8(key_head, kt, jk, max_jj, embed_dim, TILE_N);
+                else
+                    sdpa_flash_pack_kt(key_head, kt, jk, max_jj, embed_dim, TILE_N);
+
+                sdpa_flash_qk(qs, kt, s, max_ii, max_jj, embed_dim, TILE_N, TILE_N);
+            }
+
+            if (!maskm.empty())
+            {
+                sdpa_flash_add_mask(maskm, s, i, max_ii, j, max_jj, TILE_N);
+            }
+
+            for (int ii = 0; ii < max_ii; ii++)
+            {
+                rescales[ii] = sdpa_flash_online_softmax(s + ii * TILE_N, max_jj, maxs[ii], sums[ii]);
+            }
+
+            const float* pv = value_head.row(jk);
+            if (kvcache_is_int8)
+            {
+                sdpa_flash_pack_v_int8(value_head, vt, jk, max_jj, out_embed_dim);
+                pv = vt;
+            }
+#if NCNN_BF16
+            if (value_is_bf16)
+            {
+                sdpa_flash_pack_v_bf16(value_head, vt, jk, max_jj, out_embed_dim);
+                pv = vt;
+            }
+#endif // NCNN_BF16
+
+            sdpa_flash_pv(s, pv, o, rescales, max_ii, max_jj, out_embed_dim, TILE_N, out_embed_dim);
+
+            j += max_jj;
+        }
+
+        sdpa_flash_store_output(o, sums, top_blob_head, i, max_ii, out_embed_dim);
+    }
+
+    return 0;
+}
@@ -3,10 +3,30 @@
 
 #include "sdpa_x86.h"
 
+#include <float.h>
+
+#if __SSE2__
+#include <emmintrin.h>
+#include "sse_mathfun.h"
+#if __AVX__
+#include <immintrin.h>
+#include "avx_mathfun.h"
+#if __AVX512F__
+#include "avx512_mathfun.h"
+#endif // __AVX512F__
+#endif // __AVX__
+#endif // __SSE2__
+
+#include "x86_usability.h"
+
+#include "cpu.h"
 #include "layer_type.h"
 
 namespace ncnn {
 
+#include "sdpa_flash.h"
+#include "sdpa_decode.h"
+
 SDPA_x86::SDPA_x86()
 {
 #if NCNN_BF16
@@ -27,6 +47,10 @@ int SDPA_x86::create_pipeline(const Option& _opt)
         support_bf16_storage = false;
     }
 
+    // fp32 and bf16 attention run on the flash and decode kernels
+    if (!int8_scale_term)
+        return 0;
+
     {
         qk_softmax = ncnn::create_layer_cpu(ncnn::LayerType::Softmax);
         ncnn::ParamDict pd;
@@ -38,13 +62,15 @@ int SDPA_x86::create_pipeline(const Option& _opt)
     }
 
     // Q * K^T
-    if (scale != 0.f)
     {
+        // dynamic scale is applied to query in forward
+        const float _scale = scale == 0.f ? 1.f : scale;
+
         qk_gemm = ncnn::create_layer_cpu(ncnn::LayerType::Gemm);
         ncnn::ParamDict pd;
 
-        pd.set(0, scale);               // alpha
-        pd.set(1, 1.f / scale);         // beta
+        pd.set(0, _scale);              // alpha
+        pd.set(1, 1.f / _scale);        // beta
         pd.set(2, 0);                   // transA (Q: Seq x Embed)
         pd.set(3, 1);                   // transB (K: Seq x Embed -> K^T: Embed x Seq) => Q * K^T
         pd.set(4, 0);                   // constantA
@@ -157,19 +183,78 @@ int SDPA_x86::forward(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& to
 
     const size_t elemsize = query.elemsize;
 
+    // int8 kv cache storage, a past kv cache keeps its own storage type
+    const bool kvcache_int8 = kv_cache && !int8_scale_term && (past_key.empty() ? opt.use_int8_kvcache : past_key.elemsize == 1u);
+    const int key_rowsize = kvcache_int8 ? sdpa_flash_int8_rowsize(embed_dim) : embed_dim;
+    const int value_rowsize = kvcache_int8 ? sdpa_flash_int8_rowsize(out_embed_dim) : out_embed_dim;
+    const size_t kvcache_elemsize = kvcache_int8 ? 1u : elemsize;
+
     Mat key;
     Mat value;
 
+    if (kv_cache && opt.kvcache_block_seqlen > 0 && !int8_scale_term)
+    {
+        // paged kv cache, append into the blocks and attend over them in place
+        Mat& cached_key = top_blobs[1];
+        Mat& cached_value = top_blobs[2];
+
+        int retk = create_or_grow_paged_kvcache(past_key, cached_key, dst_seqlen, num_group, key_rowsize, kvcache_elemsize, cur_key.elempack, opt);
+        if (retk != 0)
+            return retk;
+
+        int retv = create_or_grow_paged_kvcache(past_value, cached_value, dst_seqlen, num_group, value_rowsize, kvcache_elemsize, cur_value.elempack, opt);
+        if (retv != 0)
+            return retv;
+
+        #pragma omp parallel for num_threads(opt.num_threads)
+        for (int q = 0; q < num_group; q++)
+        {
+            const Mat cur_key_head = cur_key.channel(q);
+            const Mat cur_value_head = cur_value.channel(q);
+            for (int y = 0; y < cur_seqlen; y++)
+            {
+                Mat key_head = sdpa_flash_paged_head(cached_key, q, past_seqlen + y);
+                Mat value_head = sdpa_flash_paged_head(cached_value, q, past_seqlen + y);
+                unsigned char* kptr = key_head.row<unsigned char>((past_seqlen + y) % key_head.h);
+                unsigned char* vptr = value_head.row<unsigned char>((past_seqlen + y) % value_head.h);
+                if (kvcache_int8)
+                {
+                    sdpa_flash_quantize_row(cur_key_head, y, kptr, embed_dim);
+                    sdpa_flash_quantize_row(cur_value_head, y, vptr, out_embed_dim);
+                }
+                else
+                {
+                    memcpy(kptr, cur_key_head.row<const unsigned char>(y), (size_t)embed_dim * elemsize);
+                    memcpy(vptr, cur_value_head.row<const unsigned char>(y), (size_t)out_embed_dim * elemsize);
+                }
+            }
+        }
+
+        Mat& top_blob = top_blobs[0];
+        top_blob.create(out_embed_dim, src_seqlen, num_heads, 4u, opt.blob_allocator);
+        if (top_blob.empty())
+            return -100;
+
+        const float _scale = scale == 0.f ? 1.f / sqrt(embed_dim) : scale;
+
+        const int block_seqlen = ((const PagedKVCacheTable*)cached_key.data)->block_seqlen;
+
+        if (src_seqlen < 4)
+            return sdpa_decode_attention(query, cached_key, cached_value, attn_mask_blob, top_blob, _scale, block_seqlen, opt);
+
+        return sdpa_flash_attention(query, cached_key, cached_value, attn_mask_blob, top_blob, _scale, block_seqlen, opt);
+    }
+
     if (kv_cache)
     {
         Mat& cached_key = top_blobs[1];
         Mat& cached_value = top_blobs[2];
 
-        int retk = create_or_grow_kvcache(past_key, cached_key, dst_seqlen, num_group, embed_dim, elemsize, cur_key.elempack, opt);
+        int retk = create_or_grow_kvcache(past_key, cached_key, dst_seqlen, num_group, key_rowsize, kvcache_elemsize, cur_key.elempack, opt);
         if (retk != 0)
             return retk;
 
-        int retv = create_or_grow_kvcache(past_value, cached_value, dst_seqlen, num_group, out_embed_dim, elemsize, cur_value.elempack, opt);
+        int retv = create_or_grow_kvcache(past_value, cached_value, dst_seqlen, num_group, value_rowsize, kvcache_elemsize, cur_value.elempack, opt);
         if (retv != 0)
             return retv;
 
@@ -178,8 +263,21 @@ int SDPA_x86::forward(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& to
         {
             Mat key_head = cached_key.channel(q);
             Mat value_head = cached_value.channel(q);
-            memcpy(key_head.row(past_seqlen), cur_key.channel(q), (size_t)embed_dim * cur_seqlen * elemsize);
-            memcpy(value_head.row(past_seqlen), cur_value.channel(q), (size_t)out_embed_dim * cur_seqlen * elemsize);
+            if (kvcache_int8)
+            {
+                const Mat cur_key_head = cur_key.channel(q);
+                const Mat cur_value_head = cur_value.channel(q);
+                for (int y = 0; y < cur_seqlen; y++)
+                {
+                    sdpa_flash_quantize_row(cur_key_head, y, key_head.row<unsigned char>(past_seqlen + y), embed_dim);
+                    sdpa_flash_quantize_row(cur_value_head, y, value_head.row<unsigned char>(past_seqlen + y), out_embed_dim);
+                }
+            }
+            else
+            {
+                memcpy(key_head.row(past_seqlen), cur_key.channel(q), (size_t)embed_dim * cur_seqlen * elemsize);
+                memcpy(value_head.row(past_seqlen), cur_value.channel(q), (size_t)out_embed_dim * cur_seqlen * elemsize);
+            }
         }
 
         key = cached_key;
@@ -191,6 +289,25 @@ int SDPA_x86::forward(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& to
         value = cur_value;
     }
 
+    if (!int8_scale_term)
+    {
+        // stream key/value tiles and never materialize qk_cross
+        Mat& top_blob = top_blobs[0];
+        top_blob.create(out_embed_dim, src_seqlen, num_heads, 4u, opt.blob_allocator);
+        if (top_blob.empty())
+            return -100;
+
+        const float _scale = scale == 0.f ? 1.f / sqrt(embed_dim) : scale;
+
+        if (src_seqlen < 4)
+        {
+            // decode, the heads of a kv group share each key and value row
+            return sdpa_decode_attention(query, key, value, attn_mask_blob, top_blob, _scale, 0, opt);
+        }
+
+        return sdpa_flash_attention(query, key, value, attn_mask_blob, top_blob, _scale, 0, opt);
+    }
+
     const int num_heads_per_group = num_heads / num_group;
 
     Mat qk_cross(dst_seqlen, src_seqlen, num_heads, 4u, opt.workspace_allocator);
@@ -199,38 +316,31 @@ int SDPA_x86::forward(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& to
 
     std::vector<int> retqks(num_heads);
 
-    // Dynamic Scale Calculation and Beta Correction
-    Layer* _qk_gemm = qk_gemm;
+    // dynamic scale is folded into a pre-scaled query, qk_gemm was built with unit alpha
+    Mat query_scaled;
     if (scale == 0.f)
     {
-        float _scale = 1.f / sqrt(embed_dim);
+        const float _scale = 1.f / sqrt(embed_dim);
 
-        _qk_gemm = ncnn::create_layer_cpu(ncnn::LayerType::Gemm);
-        ncnn::ParamDict pd;
+        query_scaled.create(embed_dim, src_seqlen, num_heads, 4u, opt.workspace_allocator);
+        if (query_scaled.empty())
+            return -100;
 
-        pd.set(0, _scale);              // alpha
-        pd.set(1, 1.f / _scale);        // beta
-        pd.set(2, 0);                   // transA (Q: Seq x Embed)
-        pd.set(3, 1);                   // transB (K: Seq x Embed -> K^T: Embed x Seq) => Q * K^T
-        pd.set(4, 0);                   // constantA
-        pd.set(5, 0);                   // constantB
-        pd.set(6, attn_mask ? 0 : 1);   // constantC (if mask exists, use it)
-        pd.set(7, 0);                   // M
-        pd.set(8, 0);                   // N
-        pd.set(9, 0);                   // K
-        pd.set(10, attn_mask ? 3 : -1); // constant_broadcast_type_C (MxN)
-        pd.set(11, 0);                  // output_N1M
-        pd.set(12, 1);                  // output_elempack
-        pd.set(13, 1);                  // output_elemtype = fp32
-#if NCNN_INT8
-        pd.set(18, int8_scale_term);
-#endif
-        _qk_gemm->load_param(pd);
-        _qk_gemm->load_model(ModelBinFromMatArray(0));
+        #pragma omp parallel for num_threads(opt.num_threads)
+        for (int q = 0; q < num_heads; q++)
+        {
+            const float* ptr = query.channel(q);
+            float* outptr = query_scaled.channel(q);
 
-        Option opt1 = opt;
-        opt1.num_threads = 1;
-        _qk_gemm->create_pipeline(opt1);
+            for (int i = 0; i < embed_dim * src_seqlen; i++)
+            {
+                outptr[i] = ptr[i] * _scale;
+            }
+        }
+    }
+    else
+    {
+        query_scaled = query;
     }
 
     #pragma omp parallel for num_threads(opt.num_threads)
@@ -238,7 +348,7 @@ int SDPA_x86::forward(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& to
     {
         // 1. Q * K^T
         std::vector<Mat> qk_bottom_blobs;
-        qk_bottom_blobs.push_back(query.channel(i));                     // Q: [Seq, Embed]
+        qk_bottom_blobs.push_back(query_scaled.channel(i));              // Q: [Seq, Embed]
         qk_bottom_blobs.push_back(key.channel(i / num_heads_per_group)); // K: [DstSeq, Embed]
 
         if (attn_mask)
@@ -259,18 +369,10 @@ int SDPA_x86::forward(const std::vector<Mat>& bottom_blobs, std::vector<Mat>& to
         Option opt1 = opt;
         opt1.num_threads = 1;
         opt1.blob_allocator = qk_cross.allocator;
-        retqks[i] = _qk_gemm->forward(qk_bottom_blobs, qk_top_blobs, opt1);
+        retqks[i] = qk_gemm->forward(qk_bottom_blobs, qk_top_blobs, opt1);
     }
 
-    if (scale == 0.f)
-    {
-        Option opt1 = opt;
-        opt1.num_threads = 1;
-        _qk_gemm->destroy_pipeline(opt1);
-
-        delete _qk_gemm;
-        _qk_gemm = 0;
-    }
+    query_scaled.release();
 
     for (int i = 0; i < num_heads; i++)
     {
@@ -0,0 +1,472 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SPECTROGRAM_FFT_H
+#define SPECTROGRAM_FFT_H
+
+// mixed radix stockham fft over FFT_LANES independent sequences at once
+// element e of a sequence buffer holds FFT_LANES real values followed by FFT_LANES imag values
+
+#if __AVX512F__
+#define FFT_LANES 16
+typedef __m512 fft_float;
+static NCNN_FORCEINLINE fft_float fft_load(const float* p)
+{
+    return _mm512_loadu_ps(p);
+}
+static NCNN_FORCEINLINE void fft_store(float* p, fft_float v)
+{
+    _mm512_storeu_ps(p, v);
+}
+static NCNN_FORCEINLINE fft_float fft_set1(float v)
+{
+    return _mm512_set1_ps(v);
+}
+static NCNN_FORCEINLINE fft_float fft_add(fft_float a, fft_float b)
+{
+    return _mm512_add_ps(a, b);
+}
+static NCNN_FORCEINLINE fft_float fft_sub(fft_float a, fft_float b)
+{
+    return _mm512_sub_ps(a, b);
+}
+static NCNN_FORCEINLINE fft_float fft_mul(fft_float a, fft_float b)
+{
+    return _mm512_mul_ps(a, b);
+}
+static NCNN_FORCEINLINE fft_float fft_sqrt(fft_float a)
+{
+    return _mm512_sqrt_ps(a);
+}
+#elif __AVX__
+#define FFT_LANES 8
+typedef __m256 fft_float;
+static NCNN_FORCEINLINE fft_float fft_load(const float* p)
+{
+    return _mm256_loadu_ps(p);
+}
+static NCNN_FORCEINLINE void fft_store(float* p, fft_float v)
+{
+    _mm256_storeu_ps(p, v);
+}
+static NCNN_FORCEINLINE fft_float fft_set1(float v)
+{
+    return _mm256_set1_ps(v);
+}
+static NCNN_FORCEINLINE fft_float fft_add(fft_float a, fft_float b)
+{
+    return _mm256_add_ps(a, b);
+}
+static NCNN_FORCEINLINE fft_float fft_sub(fft_float a, fft_float b)
+{
+    return _mm256_sub_ps(a, b);
+}
+static NCNN_FORCEINLINE fft_float fft_mul(fft_float a, fft_float b)
+{
+    return _mm256_mul_ps(a, b);
+}
+static NCNN_FORCEINLINE fft_float fft_sqrt(fft_float a)
+{
+    return _mm256_sqrt_ps(a);
+}
+#elif __SSE2__
+#define FFT_LANES 4
+typedef __m128 fft_float;
+static NCNN_FORCEINLINE fft_float fft_load(const float* p)
+{
+    return _mm_loadu_ps(p);
+}
+static NCNN_FORCEINLINE void fft_store(float* p, fft_float v)
+{
+    _mm_storeu_ps(p, v);
+}
+static NCNN_FORCEINLINE fft_float fft_set1(float v)
+{
+    return _mm_set1_ps(v);
+}
+static NCNN_FORCEINLINE fft_float fft_add(fft_float a, fft_float b)
+{
+    return _mm_add_ps(a, b);
+}
+static NCNN_FORCEINLINE fft_float fft_sub(fft_float a, fft_float b)
+{
+    return _mm_sub_ps(a, b);
+}
+static NCNN_FORCEINLINE fft_float fft_mul(fft_float a, fft_float b)
+{
+    return _mm_mul_ps(a, b);
+}
+static NCNN_FORCEINLINE fft_float fft_sqrt(fft_float a)
+{
+    return _mm_sqrt_ps(a);
+}
+#else
+#define FFT_LANES 1
+typedef float fft_float;
+static NCNN_FORCEINLINE fft_float fft_load(const float* p)
+{
+    return *p;
+}
+static NCNN_FORCEINLINE void fft_store(float* p, fft_float v)
+{
+    *p = v;
+}
+static NCNN_FORCEINLINE fft_float fft_set1(float v)
+{
+    return v;
+}
+static NCNN_FORCEINLINE fft_float fft_add(fft_float a, fft_float b)
+{
+    return a + b;
+}
+static NCNN_FORCEINLINE fft_float fft_sub(fft_float a, fft_float b)
+{
+    return a - b;
+}
+static NCNN_FORCEINLINE fft_float fft_mul(fft_float a, fft_float b)
+{
+    return a * b;
+}
+static NCNN_FORCEINLINE fft_float fft_sqrt(fft_float a)
+{
+    return sqrtf(a);
+}
+#endif
+
+// split n into radix 4 2 3 5 and remaining primes, then precompute twiddles of every stage
+// stage with radix r and sub length m stores m * (r - 1) twiddles, plus r roots for generic radix
+static void fft_prepare(int n, std::vector<int>& radices, Mat& twiddles)
+{
+    radices.clear();
+
+    int rest = n;
+    while (rest % 4 == 0)
+    {
+        radices.push_back(4);
+        rest /= 4;
+    }
+    while (rest % 2 == 0)
+    {
+        radices.push_back(2);
+        rest /= 2;
+    }
+    for (int r = 3; rest > 1; r += 2)
+    {
+        while (rest % r == 0)
+        {
+            radices.push_back(r);
+            rest /= r;
+        }
+    }
+
+    int twiddles_size = 0;
+    {
+        int len = n;
+        for (size_t i = 0; i < radices.size(); i++)
+        {
+            const int r = radices[i];
+            const int m = len / r;
+            twiddles_size += m * (r - 1) * 2;
+            if (r > 5)
+                twiddles_size += r * 2;
+            len = m;
+        }
+    }
+
+    twiddles.create(std::max(twiddles_size, 1));
+
+    float* tw = twiddles;
+    int len = n;
+    for (size_t i = 0; i < radices.size(); i++)
+    {
+        const int r = radices[i];
+        const int m = len / r;
+
+        for (int p = 0; p < m; p++)
+        {
+            for (int u = 1; u < r; u++)
+            {
+                double angle = -2 * 3.14159265358979323846 * p * u / len;
+                *tw++ = (float)cos(angle);
+                *tw++ = (float)sin(angle);
+            }
+        }
+
+        if (r > 5)
+        {
+            for (int k = 0; k < r; k++)
+            {
+                double angle = -2 * 3.14159265358979323846 * k / r;
+                *tw++ = (float)cos(angle);
+                *tw++ = (float)sin(angle);
+            }
+        }
+
+        len = m;
+    }
+}
+
+// y = x * (wr + wi * i)
+static NCNN_FORCEINLINE void fft_twiddle_store(float* y, fft_float re, fft_float im, float wr, float wi)
+{
+    fft_float _wr = fft_set1(wr);
+    fft_float _wi = fft_set1(wi);
+    fft_store(y, fft_sub(fft_mul(re, _wr), fft_mul(im, _wi)));
+    fft_store(y + FFT_LANES, fft_add(fft_mul(re, _wi), fft_mul(im, _wr)));
+}
+
+static void fft_radix2(const float* x, float* y, int m, int s, const float* tw)
+{
+    const int L2 = FFT_LANES * 2;
+
+    for (int p = 0; p < m; p++)
+    {
+        const float wr = tw[p * 2];
+        const float wi = tw[p * 2 + 1];
+
+        for (int q = 0; q < s; q++)
+        {
+            const float* x0 = x + (q + s * p) * L2;
+            const float* x1 = x + (q + s * (p + m)) * L2;
+            float* y0 = y + (q + s * (p * 2)) * L2;
+            float* y1 = y + (q + s * (p * 2 + 1)) * L2;
+
+            fft_float a0r = fft_load(x0);
+            fft_float a0i = fft_load(x0 + FFT_LANES);
+            fft_float a1r = fft_load(x1);
+            fft_float a1i = fft_load(x1 + FFT_LANES);
+
+            fft_store(y0, fft_add(a0r, a1r));
+            fft_store(y0 + FFT_LANES, fft_add(a0i, a1i));
+            fft_twiddle_store(y1, fft_sub(a0r, a1r), fft_sub(a0i, a1i), wr, wi);
+        }
+    }
+}
+
+static void fft_radix3(const float* x, float* y, int m, int s, const float* tw)
+{
+    const int L2 = FFT_LANES * 2;
+
+    const fft_float _half = fft_set1(0.5f);
+    const fft_float _sin60 = fft_set1(0.86602540378443864676f);
+
+    for (int p = 0; p < m; p++)
+    {
+        const float* w = tw + p * 4;
+
+        for (int q = 0; q < s; q++)
+        {
+            const float* x0 = x + (q + s * p) * L2;
+            const float* x1 = x + (q + s * (p + m)) * L2;
+            const float* x2 = x + (q + s * (p + m * 2)) * L2;
+            float* y0 = y + (q + s * (p * 3)) * L2;
+
+            fft_float a0r = fft_load(x0);
+            fft_float a0i = fft_load(x0 + FFT_LANES);
+            fft_float a1r = fft_load(x1);
+            fft_float a1i = fft_load(x1 + FFT_LANES);
+            fft_float a2r = fft_load(x2);
+            fft_float a2i = fft_load(x2 + FFT_LANES);
+
+            fft_float t1r = fft_add(a1r, a2r);
+            fft_float t1i = fft_add(a1i, a2i);
+            fft_float t2r = fft_sub(a0r, fft_mul(t1r, _half));
+            fft_float t2i = fft_sub(a0i, fft_mul(t1i, _half));
+            fft_float dr = fft_mul(fft_sub(a1r, a2r), _sin60);
+            fft_float di = fft_mul(fft_sub(a1i, a2i), _sin60);
+
+            fft_store(y0, fft_add(a0r, t1r));
+            fft_store(y0 + FFT_LANES, fft_add(a0i, t1i));
+            fft_twiddle_store(y0 + s * L2, fft_add(t2r, di), fft_sub(t2i, dr), w[0], w[1]);
+            fft_twiddle_store(y0 + s * 2 * L2, fft_sub(t2r, di), fft_add(t2i, dr), w[2], w[3]);
+        }
+    }
+}
+
+static void fft_radix4(const float* x, float* y, int m, int s, const float* tw)
+{
+    const int L2 = FFT_LANES * 2;
+
+    for (int p = 0; p < m; p++)
+    {
+        const float* w = tw + p * 6;
+
+        for (int q = 0; q < s; q++)
+        {
+            const float* x0 = x + (q + s * p) * L2;
+            const float* x1 = x + (q + s * (p + m)) * L2;
+            const float* x2 = x + (q + s * (p + m * 2)) * L2;
+            const float* x3 = x + (q + s * (p + m * 3)) * L2;
+            float* y0 = y + (q + s * (p * 4)) * L2;
+
+            fft_float a0r = fft_load(x0);
+            fft_float a0i = fft_load(x0 + FFT_LANES);
+            fft_float a1r = fft_load(x1);
+            fft_float a1i = fft_load(x1 + FFT_LANES);
+            fft_float a2r = fft_load(x2);
+            fft_float a2i = fft_load(x2 + FFT_LANES);
+            fft_float a3r = fft_load(x3);
+            fft_float a3i = fft_load(x3 + FFT_LANES);
+
+            fft_float t0r = fft_add(a0r, a2r);
+            fft_float t0i = fft_add(a0i, a2i);
+            fft_float t1r = fft_sub(a0r, a2r);
+            fft_float t1i = fft_sub(a0i, a2i);
+            fft_float t2r = fft_add(a1r, a3r);
+            fft_float t2i = fft_add(a1i, a3i);
+            fft_float t3r = fft_sub(a1r, a3r);
+            fft_float t3i = fft_sub(a1i, a3i);
+
+            fft_store(y0, fft_add(t0r, t2r));
+            fft_store(y0 + FFT_LANES, fft_add(t0i, t2i));
+            fft_twiddle_store(y0 + s * L2, fft_add(t1r, t3i), fft_sub(t1i, t3r), w[0], w[1]);
+            fft_twiddle_store(y0 + s * 2 * L2, fft_sub(t0r, t2r), fft_sub(t0i, t2i), w[2], w[3]);
+            fft_twiddle_store(y0 + s * 3 * L2, fft_sub(t1r, t3i), fft_add(t1i, t3r), w[4], w[5]);
+        }
+    }
+}
+
+static void fft_radix5(const float* x, float* y, int m, int s, const float* tw)
+{
+    const int L2 = FFT_LANES * 2;
+
+    // cos and sin of 2pi/5 and 4pi/5
+    const fft_float _c1 = fft_set1(0.30901699437494742410f);
+    const fft_float _c2 = fft_set1(-0.80901699437494742410f);
+    const fft_float _s1 = fft_set1(0.95105651629515357212f);
+    const fft_float _s2 = fft_set1(0.58778525229247312917f);
+
+    for (int p = 0; p < m; p++)
+    {
+        const float* w = tw + p * 8;
+
+        for (int q = 0; q < s; q++)
+        {
+            const float* x0 = x + (q + s * p) * L2;
+            const float* x1 = x + (q + s * (p + m)) * L2;
+            const float* x2 = x + (q + s * (p + m * 2)) * L2;
+            const float* x3 = x + (q + s * (p + m * 3)) * L2;
+            const float* x4 = x + (q + s * (p + m * 4)) * L2;
+            float* y0 = y + (q + s * (p * 5)) * L2;
+
+            fft_float a0r = fft_load(x0);
+            fft_float a0i = fft_load(x0 + FFT_LANES);
+            fft_float a1r = fft_load(x1);
+            fft_float a1i = fft_load(x1 + FFT_LANES);
+            fft_float a2r = fft_load(x2);
+            fft_float a2i = fft_load(x2 + FFT_LANES);
+            fft_float a3r = fft_load(x3);
+            fft_float a3i = fft_load(x3 + FFT_LANES);
+            fft_float a4r = fft_load(x4);
+            fft_float a4i = fft_load(x4 + FFT_LANES);
+
+            fft_float b1r = fft_add(a1r, a4r);
+            fft_float b1i = fft_add(a1i, a4i);
+            fft_float b2r = fft_add(a2r, a3r);
+            fft_float b2i = fft_add(a2i, a3i);
+            fft_float d1r = fft_sub(a1r, a4r);
+            fft_float d1i = fft_sub(a1i, a4i);
+            fft_float d2r = fft_sub(a2r, a3r);
+            fft_float d2i = fft_sub(a2i, a3i);
+
+            fft_float t1r = fft_add(a0r, fft_add(fft_mul(b1r, _c1), fft_mul(b2r, _c2)));
+            fft_float t1i = fft_add(a0i, fft_add(fft_mul(b1i, _c1), fft_mul(b2i, _c2)));
+            fft_float t2r = fft_add(a0r, fft_add(fft_mul(b1r, _c2), fft_mul(b2r, _c1)));
+            fft_float t2i = fft_add(a0i, fft_add(fft_mul(b1i, _c2), fft_mul(b2i, _c1)));
+            fft_float u1r = fft_add(fft_mul(d1r, _s1), fft_mul(d2r, _s2));
+            fft_float u1i = fft_add(fft_mul(d1i, _s1), fft_mul(d2i, _s2));
+            fft_float u2r = fft_sub(fft_mul(d1r, _s2), fft_mul(d2r, _s1));
+            fft_float u2i = fft_sub(fft_mul(d1i, _s2), fft_mul(d2i, _s1));
+
+            fft_store(y0, fft_add(a0r, fft_add(b1r, b2r)));
+            fft_store(y0 + FFT_LANES, fft_add(a0i, fft_add(b1i, b2i)));
+            fft_twiddle_store(y0 + s * L2, fft_add(t1r, u1i), fft_sub(t1i, u1r), w[0], w[1]);
+            fft_twiddle_store(y0 + s * 2 * L2, fft_add(t2r, u2i), fft_sub(t2i, u2r), w[2], w[3]);
+            fft_twiddle_store(y0 + s * 3 * L2, fft_sub(t2r, u2i), fft_add(t2i, u2r), w[4], w[5]);
+            fft_twiddle_store(y0 + s * 4 * L2, fft_sub(t1r, u1i), fft_add(t1i, u1r), w[6], w[7]);
+        }
+    }
+}
+
+static void fft_radix_generic(const float* x, float* y, int r, int m, int s, const float* tw)
+{
+    const int L2 = FFT_LANES * 2;
+
+    // roots of unity for this radix follow the stage twiddles
+    const float* roots = tw + m * (r - 1) * 2;
+
+    for (int p = 0; p < m; p++)
+    {
+        const float* w = tw + p * (r - 1) * 2;
+
+        for (int q = 0; q < s; q++)
+        {
+            float* yp = y + (q + s * (p * r)) * L2;
+
+            for (int u = 0; u < r; u++)
+            {
+                fft_float sumr = fft_set1(0.f);
+                fft_float sumi = fft_set1(0.f);
+                for (int t = 0; t < r; t++)
+                {
+                    const float* xt = x + (q + s * (p + m * t)) * L2;
+                    const int k = (t * u) % r;
+
+                    fft_float ar = fft_load(xt);
+                    fft_float ai = fft_load(xt + FFT_LANES);
+                    fft_float _rr = fft_set1(roots[k * 2]);
+                    fft_float _ri = fft_set1(roots[k * 2 + 1]);
+                    sumr = fft_add(sumr, fft_sub(fft_mul(ar, _rr), fft_mul(ai, _ri)));
+                    sumi = fft_add(sumi, fft_add(fft_mul(ar, _ri), fft_mul(ai, _rr)));
+                }
+
+                if (u == 0)
+                {
+                    fft_store(yp, sumr);
+                    fft_store(yp + FFT_LANES, sumi);
+                }
+                else
+                {
+                    fft_twiddle_store(yp + s * u * L2, sumr, sumi, w[(u - 1) * 2], w[(u - 1) * 2 + 1]);
+                }
+            }
+        }
+    }
+}
+
+// forward dft of FFT_LANES sequences of length n in x, y is scratch of the same size
+// returns the buffer holding the result in natural order
+static float* fft_forward(float* x, float* y, int n, const std::vector<int>& radices, const float* twiddles)
+{
+    const float* tw = twiddles;
+    int len = n;
+    int s = 1;
+    for (size_t i = 0; i < radices.size(); i++)
+    {
+        const int r = radices[i];
+        const int m = len / r;
+
+        if (r == 2)
+            fft_radix2(x, y, m, s, tw);
+        else if (r == 3)
+            fft_radix3(x, y, m, s, tw);
+        else if (r == 4)
+            fft_radix4(x, y, m, s, tw);
+        else if (r == 5)
+            fft_radix5(x, y, m, s, tw);
+        else
+            fft_radix_generic(x, y, r, m, s, tw);
+
+        tw += m * (r - 1) * 2;
+        if (r > 5)
+            tw += r * 2;
+
+        std::swap(x, y);
+        len = m;
+        s *= r;
+    }
+
+    return x;
+}
+
+#endif // SPECTROGRAM_FFT_H
@@ -0,0 +1,201 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "spectrogram_x86.h"
+
+#if __SSE2__
+#include <emmintrin.h>
+#if __AVX__
+#include <immintrin.h>
+#endif // __AVX__
+#endif // __SSE2__
+
+#include "cpu.h"
+
+namespace ncnn {
+
+#include "spectrogram_fft.h"
+
+Spectrogram_x86::Spectrogram_x86()
+{
+}
+
+int Spectrogram_x86::create_pipeline(const Option& /*opt*/)
+{
+    fft_prepare(n_fft, fft_radices, fft_twiddles);
+
+    return 0;
+}
+
+int Spectrogram_x86::forward(const Mat& bottom_blob, Mat& top_blob, const Option& opt) const
+{
+    Mat bottom_blob_bordered = bottom_blob;
+    if (center == 1)
+    {
+        Option opt_b = opt;
+        opt_b.blob_allocator = opt.workspace_allocator;
+        if (pad_type == 0)
+            copy_make_border(bottom_blob, bottom_blob_bordered, 0, 0, n_fft / 2, n_fft / 2, BORDER_CONSTANT, 0.f, opt_b);
+        if (pad_type == 1)
+            copy_make_border(bottom_blob, bottom_blob_bordered, 0, 0, n_fft / 2, n_fft / 2, BORDER_REPLICATE, 0.f, opt_b);
+        if (pad_type == 2)
+            copy_make_border(bottom_blob, bottom_blob_bordered, 0, 0, n_fft / 2, n_fft / 2, BORDER_REFLECT, 0.f, opt_b);
+    }
+
+    const int size = bottom_blob_bordered.w;
+
+    const int frames = (size - n_fft) / hoplen + 1;
+    const int freqs_onesided = n_fft / 2 + 1;
+
+    const size_t elemsize = bottom_blob_bordered.elemsize;
+
+    if (power == 0)
+    {
+        top_blob.create(2, frames, onesided ? freqs_onesided : n_fft, elemsize, opt.blob_allocator);
+    }
+    else
+    {
+        top_blob.create(frames, onesided ? freqs_onesided : n_fft, elemsize, opt.blob_allocator);
+    }
+    if (top_blob.empty())
+        return -100;
+
+    // two real frames share one complex fft, FFT_LANES frames in real part and the next FFT_LANES frames in imag part
+    const int L = FFT_LANES;
+    const int group_count = (frames + L * 2 - 1) / (L * 2);
+
+    Mat fft_workspace(n_fft * L * 2, 2, opt.num_threads, 4u, opt.workspace_allocator);
+    if (fft_workspace.empty())
+        return -100;
+
+    float norm = 0.5f;
+    if (normalized == 1)
+        norm = 0.5f / sqrt(n_fft);
+    if (normalized == 2)
+        norm = 0.5f * window_data[n_fft];
+
+    const float* window_ptr = window_data;
+
+    #pragma omp parallel for num_threads(opt.num_threads)
+    for (int g = 0; g < group_count; g++)
+    {
+        const int j0 = g * L * 2;
+
+        Mat fft_ws = fft_workspace.channel(get_omp_thread_num());
+        float* x = fft_ws.row(0);
+        float* y = fft_ws.row(1);
+
+        // windowed frames, lane l of element k lives at x[k * L * 2 + l]
+        for (int l = 0; l < L * 2; l++)
+        {
+            const int j = j0 + l;
+            float* xp = x + l;
+
+            if (j < frames)
+            {
+                const float* ptr = (const float*)bottom_blob_bordered + j * hoplen;
+                for (int k = 0; k < n_fft; k++)
+                {
+                    xp[k * L * 2] = ptr[k] * window_ptr[k];
+                }
+            }
+            else
+            {
+                for (int k = 0; k < n_fft; k++)
+                {
+                    xp[k * L * 2] = 0.f;
+                }
+            }
+        }
+
+        const float* z = fft_forward(x, y, n_fft, fft_radices, fft_twiddles);
+
+        const fft_float _norm = fft_set1(norm);
+
+        for (int i = 0; i < freqs_onesided; i++)
+        {
+            const float* z0 = z + i * L * 2;
+            const float* z1 = z + ((n_fft - i) % n_fft) * L * 2;
+
+            fft_float _zr = fft_load(z0);
+            fft_float _zi = fft_load(z0 + L);
+            fft_float _yr = fft_load(z1);
+            fft_float _yi = fft_load(z1 + L);
+
+            // split the spectrum of the two real frames
+            fft_float _ar = fft_mul(fft_add(_zr, _yr), _norm);
+            fft_float _ai = fft_mul(fft_sub(_zi, _yi), _norm);
+            fft_float _br = fft_mul(fft_add(_zi, _yi), _norm);
+            fft_float _bi = fft_mul(fft_sub(_yr, _zr), _norm);
+
+            if (power == 0)
+            {
+                float tmp[FFT_LANES * 4];
+                fft_store(tmp, _ar);
+                fft_store(tmp + L, _br);
+                fft_store(tmp + L * 2, _ai);
+                fft_store(tmp + L * 3, _bi);
+
+                float* outptr = top_blob.channel(i);
+                for (int l = 0; l < L * 2 && j0 + l < frames; l++)
+                {
+                    outptr[(j0 + l) * 2] = tmp[l];
+                    outptr[(j0 + l) * 2 + 1] = tmp[L * 2 + l];
+                }
+            }
+            else
+            {
+                fft_float _pa = fft_add(fft_mul(_ar, _ar), fft_mul(_ai, _ai));
+                fft_float _pb = fft_add(fft_mul(_br, _br), fft_mul(_bi, _bi));
+                if (power == 1)
+                {
+                    _pa = fft_sqrt(_pa);
+                    _pb = fft_sqrt(_pb);
+                }
+
+                float tmp[FFT_LANES * 2];
+                fft_store(tmp, _pa);
+                fft_store(tmp + L, _pb);
+
+                float* outptr = top_blob.row(i);
+                for (int l = 0; l < L * 2 && j0 + l < frames; l++)
+                {
+                    outptr[j0 + l] = tmp[l];
+                }
+            }
+        }
+    }
+
+    if (!onesided)
+    {
+        #pragma omp parallel for num_threads(opt.num_threads)
+        for (int i = freqs_onesided; i < n_fft; i++)
+        {
+            if (power == 0)
+            {
+                const float* ptr = top_blob.channel(n_fft - i);
+                float* outptr = top_blob.channel(i);
+
+                for (int j = 0; j < frames; j++)
+                {
+                    // complex as real
+                    outptr[0] = ptr[0];
+                    outptr[1] = -ptr[1];
+                    ptr += 2;
+                    outptr += 2;
+                }
+            }
+            else // if (power == 1 || power == 2)
+            {
+                const float* ptr = top_blob.row(n_fft - i);
+                float* outptr = top_blob.row(i);
+
+                memcpy(outptr, ptr, frames * sizeof(float));
+            }
+        }
+    }
+
+    return 0;
+}
+
+} // namespace ncnn
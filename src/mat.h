@@ -718,6 +718,10 @@ NCNN_EXPORT void resize_bilinear_c3(const unsigned char* src, int srcw, int srch
 NCNN_EXPORT void resize_bilinear_c4(const unsigned char* src, int srcw, int srch, int srcstride, unsigned char* dst, int w, int h, int stride);
 // image pixel bilinear resize, convenient wrapper for yuv420sp(nv21/nv12)
 NCNN_EXPORT void resize_bilinear_yuv420sp(const unsigned char* src, int srcw, int srch, unsigned char* dst, int w, int h);
+// construct network input from pixel data roi in one pass, same result as
+// from_pixels_roi_resize + substract_mean_normalize + packing + storage cast
+// elemtype 0=fp32 1=fp16 2=bf16, rows are split over opt.num_threads, dst comes from opt.blob_allocator
+NCNN_EXPORT int from_pixels_roi_resize_normalize(const unsigned char* pixels, int type, int w, int h, int stride, int roix, int roiy, int roiw, int roih, int target_width, int target_height, const float* mean_vals, const float* norm_vals, Mat& dst, int elempack = 1, int elemtype = 0, const Option& opt = Option());
 #endif // NCNN_PIXEL
 #if NCNN_PIXEL_ROTATE
 // type is the from type, 6 means rotating from 6 to 1
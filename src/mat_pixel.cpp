@@ -8,11 +8,87 @@
 #if __ARM_NEON
 #include <arm_neon.h>
 #endif // __ARM_NEON
+
+#if __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include "platform.h"
 
 namespace ncnn {
 
 #if NCNN_PIXEL
+#if __SSE2__
+// 4 packed 3-channel pixels to one pixel per 32bit lane, c0 | c1 << 8 | c2 << 16
+static NCNN_FORCEINLINE __m128i unpack_c3x4_epi32(const __m128i& _p)
+{
+    // move pixel 2 and 3 to the upper 64bit
+    __m128i _q = _mm_or_si128(_mm_and_si128(_p, _mm_set_epi32(0, 0, 0x0000ffff, -1)), _mm_and_si128(_mm_slli_si128(_p, 2), _mm_set_epi32(0x0000ffff, -1, 0, 0)));
+    // move pixel 1 and 3 to the upper 32bit
+    return _mm_or_si128(_mm_and_si128(_q, _mm_set_epi32(0, 0x00ffffff, 0, 0x00ffffff)), _mm_and_si128(_mm_slli_epi64(_q, 8), _mm_set_epi32(0x00ffffff, 0, 0x00ffffff, 0)));
+}
+
+// inverse of unpack_c3x4_epi32, 12 bytes and 4 zero bytes
+static NCNN_FORCEINLINE __m128i pack_c3x4_epi32(const __m128i& _p)
+{
+    __m128i _q = _mm_or_si128(_mm_and_si128(_p, _mm_set_epi32(0, 0x00ffffff, 0, 0x00ffffff)), _mm_and_si128(_mm_srli_epi64(_p, 8), _mm_set_epi32(0x0000ffff, (int)0xff000000, 0x0000ffff, (int)0xff000000)));
+    return _mm_or_si128(_mm_and_si128(_q, _mm_set_epi32(0, 0, -1, -1)), _mm_and_si128(_mm_srli_si128(_q, 2), _mm_set_epi32(0, -1, (int)0xffff0000, 0)));
+}
+
+static NCNN_FORCEINLINE void load_c3x8_epi32(const unsigned char* p, __m128i& _p0, __m128i& _p1)
+{
+    __m128i _a = _mm_loadu_si128((const __m128i*)p);
+    __m128i _b = _mm_loadl_epi64((const __m128i*)(p + 16));
+    _p0 = unpack_c3x4_epi32(_a);
+    _p1 = unpack_c3x4_epi32(_mm_or_si128(_mm_srli_si128(_a, 12), _mm_slli_si128(_b, 4)));
+}
+
+static NCNN_FORCEINLINE void store_c3x8_epi32(unsigned char* p, const __m128i& _p0, const __m128i& _p1)
+{
+    __m128i _a = pack_c3x4_epi32(_p0);
+    __m128i _b = pack_c3x4_epi32(_p1);
+    _mm_storeu_si128((__m128i*)p, _mm_or_si128(_a, _mm_slli_si128(_b, 12)));
+    _mm_storel_epi64((__m128i*)(p + 16), _mm_srli_si128(_b, 4));
+}
+
+// interleave the low 8 bytes of each channel
+static NCNN_FORCEINLINE void store_c3x8_u8(unsigned char* p, const __m128i& _c0, const __m128i& _c1, const __m128i& _c2)
+{
+    __m128i _c01 = _mm_unpacklo_epi8(_c0, _c1);
+    __m128i _c2z = _mm_unpacklo_epi8(_c2, _mm_setzero_si128());
+    store_c3x8_epi32(p, _mm_unpacklo_epi16(_c01, _c2z), _mm_unpackhi_epi16(_c01, _c2z));
+}
+
+static NCNN_FORCEINLINE void store_c4x8_u8(unsigned char* p, const __m128i& _c0, const __m128i& _c1, const __m128i& _c2, const __m128i& _c3)
+{
+    __m128i _c01 = _mm_unpacklo_epi8(_c0, _c1);
+    __m128i _c23 = _mm_unpacklo_epi8(_c2, _c3);
+    _mm_storeu_si128((__m128i*)p, _mm_unpacklo_epi16(_c01, _c23));
+    _mm_storeu_si128((__m128i*)(p + 16), _mm_unpackhi_epi16(_c01, _c23));
+}
+
+// the channel at bit offset shift of the pixels in 32bit lanes
+static NCNN_FORCEINLINE __m128 pixel_channel_ps(const __m128i& _p, int shift)
+{
+    return _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(_p, shift), _mm_set1_epi32(255)));
+}
+
+// c0 * w0 + c1 * w1 + c2 * w2 of the pixels in 32bit lanes
+static NCNN_FORCEINLINE __m128i pixel_gray_epi32(const __m128i& _p, int w0, int w1, int w2)
+{
+    __m128i _c02 = _mm_and_si128(_p, _mm_set1_epi32(0x00ff00ff));
+    __m128i _c1 = _mm_and_si128(_mm_srli_epi32(_p, 8), _mm_set1_epi32(255));
+    return _mm_add_epi32(_mm_madd_epi16(_c02, _mm_set1_epi32(w0 | (w2 << 16))), _mm_madd_epi16(_c1, _mm_set1_epi32(w1)));
+}
+
+// truncate and saturate to 8 bytes in the low half, like SATURATE_CAST_UCHAR
+static NCNN_FORCEINLINE __m128i float2uint8_sse(const __m128& _v0, const __m128& _v1)
+{
+    __m128i _v16 = _mm_packs_epi32(_mm_cvttps_epi32(_v0), _mm_cvttps_epi32(_v1));
+    return _mm_packus_epi16(_v16, _v16);
+}
+#endif // __SSE2__
+
 static int from_rgb(const unsigned char* rgb, int w, int h, int stride, Mat& m, Allocator* allocator)
 {
     m.create(w, h, 3, 4u, allocator);
@@ -32,7 +108,7 @@ static int from_rgb(const unsigned char* rgb, int w, int h, int stride, Mat& m,
 
     for (int y = 0; y < h; y++)
     {
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -108,6 +184,26 @@ static int from_rgb(const unsigned char* rgb, int w, int h, int stride, Mat& m,
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _p0;
+            __m128i _p1;
+            load_c3x8_epi32(rgb, _p0, _p1);
+
+            _mm_storeu_ps(ptr0, pixel_channel_ps(_p0, 0));
+            _mm_storeu_ps(ptr0 + 4, pixel_channel_ps(_p1, 0));
+            _mm_storeu_ps(ptr1, pixel_channel_ps(_p0, 8));
+            _mm_storeu_ps(ptr1 + 4, pixel_channel_ps(_p1, 8));
+            _mm_storeu_ps(ptr2, pixel_channel_ps(_p0, 16));
+            _mm_storeu_ps(ptr2 + 4, pixel_channel_ps(_p1, 16));
+
+            rgb += 3 * 8;
+            ptr0 += 8;
+            ptr1 += 8;
+            ptr2 += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             *ptr0 = rgb[0];
@@ -146,7 +242,7 @@ static void to_rgb(const Mat& m, unsigned char* rgb, int stride)
     {
 #define SATURATE_CAST_UCHAR(X) (unsigned char)::std::min(::std::max((int)(X), 0), 255);
 
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -180,6 +276,21 @@ static void to_rgb(const Mat& m, unsigned char* rgb, int stride)
             ptr2 += 8;
         }
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _r = float2uint8_sse(_mm_loadu_ps(ptr0), _mm_loadu_ps(ptr0 + 4));
+            __m128i _g = float2uint8_sse(_mm_loadu_ps(ptr1), _mm_loadu_ps(ptr1 + 4));
+            __m128i _b = float2uint8_sse(_mm_loadu_ps(ptr2), _mm_loadu_ps(ptr2 + 4));
+
+            store_c3x8_u8(rgb, _r, _g, _b);
+
+            rgb += 3 * 8;
+            ptr0 += 8;
+            ptr1 += 8;
+            ptr2 += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             rgb[0] = SATURATE_CAST_UCHAR(*ptr0);
@@ -214,7 +325,7 @@ static int from_gray(const unsigned char* gray, int w, int h, int stride, Mat& m
 
     for (int y = 0; y < h; y++)
     {
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 4;
         int remain = w - (nn << 4);
 #else
@@ -273,6 +384,22 @@ static int from_gray(const unsigned char* gray, int w, int h, int stride, Mat& m
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _gray = _mm_loadu_si128((const __m128i*)gray);
+            __m128i _gray16_0 = _mm_unpacklo_epi8(_gray, _mm_setzero_si128());
+            __m128i _gray16_1 = _mm_unpackhi_epi8(_gray, _mm_setzero_si128());
+
+            _mm_storeu_ps(ptr, _mm_cvtepi32_ps(_mm_unpacklo_epi16(_gray16_0, _mm_setzero_si128())));
+            _mm_storeu_ps(ptr + 4, _mm_cvtepi32_ps(_mm_unpackhi_epi16(_gray16_0, _mm_setzero_si128())));
+            _mm_storeu_ps(ptr + 8, _mm_cvtepi32_ps(_mm_unpacklo_epi16(_gray16_1, _mm_setzero_si128())));
+            _mm_storeu_ps(ptr + 12, _mm_cvtepi32_ps(_mm_unpackhi_epi16(_gray16_1, _mm_setzero_si128())));
+
+            gray += 16;
+            ptr += 16;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             *ptr = *gray;
@@ -305,7 +432,7 @@ static void to_gray(const Mat& m, unsigned char* gray, int stride)
     {
 #define SATURATE_CAST_UCHAR(X) (unsigned char)::std::min(::std::max((int)(X), 0), 255);
 
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -328,6 +455,17 @@ static void to_gray(const Mat& m, unsigned char* gray, int stride)
             ptr += 8;
         }
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _gray = float2uint8_sse(_mm_loadu_ps(ptr), _mm_loadu_ps(ptr + 4));
+
+            _mm_storel_epi64((__m128i*)gray, _gray);
+
+            gray += 8;
+            ptr += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             *gray = SATURATE_CAST_UCHAR(*ptr);
@@ -361,7 +499,7 @@ static int from_rgba(const unsigned char* rgba, int w, int h, int stride, Mat& m
 
     for (int y = 0; y < h; y++)
     {
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -451,6 +589,28 @@ static int from_rgba(const unsigned char* rgba, int w, int h, int stride, Mat& m
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _p0 = _mm_loadu_si128((const __m128i*)rgba);
+            __m128i _p1 = _mm_loadu_si128((const __m128i*)(rgba + 16));
+
+            _mm_storeu_ps(ptr0, pixel_channel_ps(_p0, 0));
+            _mm_storeu_ps(ptr0 + 4, pixel_channel_ps(_p1, 0));
+            _mm_storeu_ps(ptr1, pixel_channel_ps(_p0, 8));
+            _mm_storeu_ps(ptr1 + 4, pixel_channel_ps(_p1, 8));
+            _mm_storeu_ps(ptr2, pixel_channel_ps(_p0, 16));
+            _mm_storeu_ps(ptr2 + 4, pixel_channel_ps(_p1, 16));
+            _mm_storeu_ps(ptr3, pixel_channel_ps(_p0, 24));
+            _mm_storeu_ps(ptr3 + 4, pixel_channel_ps(_p1, 24));
+
+            rgba += 4 * 8;
+            ptr0 += 8;
+            ptr1 += 8;
+            ptr2 += 8;
+            ptr3 += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             *ptr0 = rgba[0];
@@ -492,7 +652,7 @@ static void to_rgba(const Mat& m, unsigned char* rgba, int stride)
     {
 #define SATURATE_CAST_UCHAR(X) (unsigned char)::std::min(::std::max((int)(X), 0), 255);
 
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -531,6 +691,23 @@ static void to_rgba(const Mat& m, unsigned char* rgba, int stride)
             ptr3 += 8;
         }
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _r = float2uint8_sse(_mm_loadu_ps(ptr0), _mm_loadu_ps(ptr0 + 4));
+            __m128i _g = float2uint8_sse(_mm_loadu_ps(ptr1), _mm_loadu_ps(ptr1 + 4));
+            __m128i _b = float2uint8_sse(_mm_loadu_ps(ptr2), _mm_loadu_ps(ptr2 + 4));
+            __m128i _a = float2uint8_sse(_mm_loadu_ps(ptr3), _mm_loadu_ps(ptr3 + 4));
+
+            store_c4x8_u8(rgba, _r, _g, _b, _a);
+
+            rgba += 4 * 8;
+            ptr0 += 8;
+            ptr1 += 8;
+            ptr2 += 8;
+            ptr3 += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             rgba[0] = SATURATE_CAST_UCHAR(*ptr0);
@@ -569,7 +746,7 @@ static int from_rgb2bgr(const unsigned char* rgb, int w, int h, int stride, Mat&
 
     for (int y = 0; y < h; y++)
     {
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -645,6 +822,26 @@ static int from_rgb2bgr(const unsigned char* rgb, int w, int h, int stride, Mat&
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _p0;
+            __m128i _p1;
+            load_c3x8_epi32(rgb, _p0, _p1);
+
+            _mm_storeu_ps(ptr2, pixel_channel_ps(_p0, 0));
+            _mm_storeu_ps(ptr2 + 4, pixel_channel_ps(_p1, 0));
+            _mm_storeu_ps(ptr1, pixel_channel_ps(_p0, 8));
+            _mm_storeu_ps(ptr1 + 4, pixel_channel_ps(_p1, 8));
+            _mm_storeu_ps(ptr0, pixel_channel_ps(_p0, 16));
+            _mm_storeu_ps(ptr0 + 4, pixel_channel_ps(_p1, 16));
+
+            rgb += 3 * 8;
+            ptr0 += 8;
+            ptr1 += 8;
+            ptr2 += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             *ptr0 = rgb[2];
@@ -683,7 +880,7 @@ static void to_bgr2rgb(const Mat& m, unsigned char* rgb, int stride)
     {
 #define SATURATE_CAST_UCHAR(X) (unsigned char)::std::min(::std::max((int)(X), 0), 255);
 
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -717,6 +914,21 @@ static void to_bgr2rgb(const Mat& m, unsigned char* rgb, int stride)
             ptr2 += 8;
         }
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _r = float2uint8_sse(_mm_loadu_ps(ptr0), _mm_loadu_ps(ptr0 + 4));
+            __m128i _g = float2uint8_sse(_mm_loadu_ps(ptr1), _mm_loadu_ps(ptr1 + 4));
+            __m128i _b = float2uint8_sse(_mm_loadu_ps(ptr2), _mm_loadu_ps(ptr2 + 4));
+
+            store_c3x8_u8(rgb, _b, _g, _r);
+
+            rgb += 3 * 8;
+            ptr0 += 8;
+            ptr1 += 8;
+            ptr2 += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             rgb[2] = SATURATE_CAST_UCHAR(*ptr0);
@@ -757,7 +969,7 @@ static int from_rgb2gray(const unsigned char* rgb, int w, int h, int stride, Mat
 
     for (int y = 0; y < h; y++)
     {
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -821,6 +1033,20 @@ static int from_rgb2gray(const unsigned char* rgb, int w, int h, int stride, Mat
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _p0;
+            __m128i _p1;
+            load_c3x8_epi32(rgb, _p0, _p1);
+
+            _mm_storeu_ps(ptr, _mm_cvtepi32_ps(_mm_srli_epi32(pixel_gray_epi32(_p0, R2Y, G2Y, B2Y), Y_shift)));
+            _mm_storeu_ps(ptr + 4, _mm_cvtepi32_ps(_mm_srli_epi32(pixel_gray_epi32(_p1, R2Y, G2Y, B2Y), Y_shift)));
+
+            rgb += 3 * 8;
+            ptr += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             *ptr = static_cast<float>((rgb[0] * R2Y + rgb[1] * G2Y + rgb[2] * B2Y) >> Y_shift);
@@ -870,7 +1096,7 @@ static void to_rgb2rgba(const Mat& m, unsigned char* rgba, int stride)
     {
 #define SATURATE_CAST_UCHAR(X) (unsigned char)::std::min(::std::max((int)(X), 0), 255);
 
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -906,6 +1132,22 @@ static void to_rgb2rgba(const Mat& m, unsigned char* rgba, int stride)
             ptr2 += 8;
         }
 #endif // __ARM_NEON
+#if __SSE2__
+        __m128i _a = _mm_set1_epi8(-1);
+        for (; nn > 0; nn--)
+        {
+            __m128i _r = float2uint8_sse(_mm_loadu_ps(ptr0), _mm_loadu_ps(ptr0 + 4));
+            __m128i _g = float2uint8_sse(_mm_loadu_ps(ptr1), _mm_loadu_ps(ptr1 + 4));
+            __m128i _b = float2uint8_sse(_mm_loadu_ps(ptr2), _mm_loadu_ps(ptr2 + 4));
+
+            store_c4x8_u8(rgba, _r, _g, _b, _a);
+
+            rgba += 4 * 8;
+            ptr0 += 8;
+            ptr1 += 8;
+            ptr2 += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             rgba[0] = SATURATE_CAST_UCHAR(*ptr0);
@@ -947,7 +1189,7 @@ static int from_bgr2gray(const unsigned char* bgr, int w, int h, int stride, Mat
 
     for (int y = 0; y < h; y++)
     {
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -1011,6 +1253,20 @@ static int from_bgr2gray(const unsigned char* bgr, int w, int h, int stride, Mat
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _p0;
+            __m128i _p1;
+            load_c3x8_epi32(bgr, _p0, _p1);
+
+            _mm_storeu_ps(ptr, _mm_cvtepi32_ps(_mm_srli_epi32(pixel_gray_epi32(_p0, B2Y, G2Y, R2Y), Y_shift)));
+            _mm_storeu_ps(ptr + 4, _mm_cvtepi32_ps(_mm_srli_epi32(pixel_gray_epi32(_p1, B2Y, G2Y, R2Y), Y_shift)));
+
+            bgr += 3 * 8;
+            ptr += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             *ptr = static_cast<float>((bgr[2] * R2Y + bgr[1] * G2Y + bgr[0] * B2Y) >> Y_shift);
@@ -1060,7 +1316,7 @@ static void to_bgr2rgba(const Mat& m, unsigned char* rgba, int stride)
     {
 #define SATURATE_CAST_UCHAR(X) (unsigned char)::std::min(::std::max((int)(X), 0), 255);
 
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -1096,6 +1352,22 @@ static void to_bgr2rgba(const Mat& m, unsigned char* rgba, int stride)
             ptr2 += 8;
         }
 #endif // __ARM_NEON
+#if __SSE2__
+        __m128i _a = _mm_set1_epi8(-1);
+        for (; nn > 0; nn--)
+        {
+            __m128i _r = float2uint8_sse(_mm_loadu_ps(ptr0), _mm_loadu_ps(ptr0 + 4));
+            __m128i _g = float2uint8_sse(_mm_loadu_ps(ptr1), _mm_loadu_ps(ptr1 + 4));
+            __m128i _b = float2uint8_sse(_mm_loadu_ps(ptr2), _mm_loadu_ps(ptr2 + 4));
+
+            store_c4x8_u8(rgba, _b, _g, _r, _a);
+
+            rgba += 4 * 8;
+            ptr0 += 8;
+            ptr1 += 8;
+            ptr2 += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             rgba[0] = SATURATE_CAST_UCHAR(*ptr2);
@@ -1133,7 +1405,7 @@ static int from_gray2rgb(const unsigned char* gray, int w, int h, int stride, Ma
 
     for (int y = 0; y < h; y++)
     {
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 4;
         int remain = w - (nn << 4);
 #else
@@ -1212,6 +1484,37 @@ static int from_gray2rgb(const unsigned char* gray, int w, int h, int stride, Ma
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _gray = _mm_loadu_si128((const __m128i*)gray);
+            __m128i _gray16_0 = _mm_unpacklo_epi8(_gray, _mm_setzero_si128());
+            __m128i _gray16_1 = _mm_unpackhi_epi8(_gray, _mm_setzero_si128());
+
+            __m128 _graylow_0 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_gray16_0, _mm_setzero_si128()));
+            __m128 _grayhigh_0 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(_gray16_0, _mm_setzero_si128()));
+            __m128 _graylow_1 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_gray16_1, _mm_setzero_si128()));
+            __m128 _grayhigh_1 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(_gray16_1, _mm_setzero_si128()));
+
+            _mm_storeu_ps(ptr0, _graylow_0);
+            _mm_storeu_ps(ptr0 + 4, _grayhigh_0);
+            _mm_storeu_ps(ptr0 + 8, _graylow_1);
+            _mm_storeu_ps(ptr0 + 12, _grayhigh_1);
+            _mm_storeu_ps(ptr1, _graylow_0);
+            _mm_storeu_ps(ptr1 + 4, _grayhigh_0);
+            _mm_storeu_ps(ptr1 + 8, _graylow_1);
+            _mm_storeu_ps(ptr1 + 12, _grayhigh_1);
+            _mm_storeu_ps(ptr2, _graylow_0);
+            _mm_storeu_ps(ptr2 + 4, _grayhigh_0);
+            _mm_storeu_ps(ptr2 + 8, _graylow_1);
+            _mm_storeu_ps(ptr2 + 12, _grayhigh_1);
+
+            gray += 16;
+            ptr0 += 16;
+            ptr1 += 16;
+            ptr2 += 16;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             *ptr0 = *gray;
@@ -1263,7 +1566,7 @@ static void to_gray2rgba(const Mat& m, unsigned char* rgba, int stride)
     {
 #define SATURATE_CAST_UCHAR(X) (unsigned char)::std::min(::std::max((int)(X), 0), 255);
 
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -1293,6 +1596,18 @@ static void to_gray2rgba(const Mat& m, unsigned char* rgba, int stride)
             ptr += 8;
         }
 #endif // __ARM_NEON
+#if __SSE2__
+        __m128i _a = _mm_set1_epi8(-1);
+        for (; nn > 0; nn--)
+        {
+            __m128i _gray = float2uint8_sse(_mm_loadu_ps(ptr), _mm_loadu_ps(ptr + 4));
+
+            store_c4x8_u8(rgba, _gray, _gray, _gray, _a);
+
+            rgba += 4 * 8;
+            ptr += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             unsigned char gray = SATURATE_CAST_UCHAR(*ptr);
@@ -1329,7 +1644,7 @@ static int from_rgba2rgb(const unsigned char* rgba, int w, int h, int stride, Ma
 
     for (int y = 0; y < h; y++)
     {
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -1405,6 +1720,25 @@ static int from_rgba2rgb(const unsigned char* rgba, int w, int h, int stride, Ma
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _p0 = _mm_loadu_si128((const __m128i*)rgba);
+            __m128i _p1 = _mm_loadu_si128((const __m128i*)(rgba + 16));
+
+            _mm_storeu_ps(ptr0, pixel_channel_ps(_p0, 0));
+            _mm_storeu_ps(ptr0 + 4, pixel_channel_ps(_p1, 0));
+            _mm_storeu_ps(ptr1, pixel_channel_ps(_p0, 8));
+            _mm_storeu_ps(ptr1 + 4, pixel_channel_ps(_p1, 8));
+            _mm_storeu_ps(ptr2, pixel_channel_ps(_p0, 16));
+            _mm_storeu_ps(ptr2 + 4, pixel_channel_ps(_p1, 16));
+
+            rgba += 4 * 8;
+            ptr0 += 8;
+            ptr1 += 8;
+            ptr2 += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             *ptr0 = rgba[0];
@@ -1442,7 +1776,7 @@ static int from_rgba2bgr(const unsigned char* rgba, int w, int h, int stride, Ma
 
     for (int y = 0; y < h; y++)
     {
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -1518,6 +1852,25 @@ static int from_rgba2bgr(const unsigned char* rgba, int w, int h, int stride, Ma
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _p0 = _mm_loadu_si128((const __m128i*)rgba);
+            __m128i _p1 = _mm_loadu_si128((const __m128i*)(rgba + 16));
+
+            _mm_storeu_ps(ptr0, pixel_channel_ps(_p0, 16));
+            _mm_storeu_ps(ptr0 + 4, pixel_channel_ps(_p1, 16));
+            _mm_storeu_ps(ptr1, pixel_channel_ps(_p0, 8));
+            _mm_storeu_ps(ptr1 + 4, pixel_channel_ps(_p1, 8));
+            _mm_storeu_ps(ptr2, pixel_channel_ps(_p0, 0));
+            _mm_storeu_ps(ptr2 + 4, pixel_channel_ps(_p1, 0));
+
+            rgba += 4 * 8;
+            ptr0 += 8;
+            ptr1 += 8;
+            ptr2 += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             *ptr0 = rgba[2];
@@ -1559,7 +1912,7 @@ static int from_rgba2gray(const unsigned char* rgba, int w, int h, int stride, M
 
     for (int y = 0; y < h; y++)
     {
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -1623,6 +1976,19 @@ static int from_rgba2gray(const unsigned char* rgba, int w, int h, int stride, M
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _p0 = _mm_loadu_si128((const __m128i*)rgba);
+            __m128i _p1 = _mm_loadu_si128((const __m128i*)(rgba + 16));
+
+            _mm_storeu_ps(ptr, _mm_cvtepi32_ps(_mm_srli_epi32(pixel_gray_epi32(_p0, R2Y, G2Y, B2Y), Y_shift)));
+            _mm_storeu_ps(ptr + 4, _mm_cvtepi32_ps(_mm_srli_epi32(pixel_gray_epi32(_p1, R2Y, G2Y, B2Y), Y_shift)));
+
+            rgba += 4 * 8;
+            ptr += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             *ptr = static_cast<float>((rgba[0] * R2Y + rgba[1] * G2Y + rgba[2] * B2Y) >> Y_shift);
@@ -1657,7 +2023,7 @@ static int from_rgba2bgra(const unsigned char* rgba, int w, int h, int stride, M
 
     for (int y = 0; y < h; y++)
     {
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -1747,6 +2113,28 @@ static int from_rgba2bgra(const unsigned char* rgba, int w, int h, int stride, M
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _p0 = _mm_loadu_si128((const __m128i*)rgba);
+            __m128i _p1 = _mm_loadu_si128((const __m128i*)(rgba + 16));
+
+            _mm_storeu_ps(ptr0, pixel_channel_ps(_p0, 16));
+            _mm_storeu_ps(ptr0 + 4, pixel_channel_ps(_p1, 16));
+            _mm_storeu_ps(ptr1, pixel_channel_ps(_p0, 8));
+            _mm_storeu_ps(ptr1 + 4, pixel_channel_ps(_p1, 8));
+            _mm_storeu_ps(ptr2, pixel_channel_ps(_p0, 0));
+            _mm_storeu_ps(ptr2 + 4, pixel_channel_ps(_p1, 0));
+            _mm_storeu_ps(ptr3, pixel_channel_ps(_p0, 24));
+            _mm_storeu_ps(ptr3 + 4, pixel_channel_ps(_p1, 24));
+
+            rgba += 4 * 8;
+            ptr0 += 8;
+            ptr1 += 8;
+            ptr2 += 8;
+            ptr3 += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             *ptr0 = rgba[2];
@@ -1788,7 +2176,7 @@ static void to_rgba2bgra(const Mat& m, unsigned char* bgra, int stride)
     {
 #define SATURATE_CAST_UCHAR(X) (unsigned char)::std::min(::std::max((int)(X), 0), 255);
 
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -1827,6 +2215,23 @@ static void to_rgba2bgra(const Mat& m, unsigned char* bgra, int stride)
             ptr3 += 8;
         }
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _r = float2uint8_sse(_mm_loadu_ps(ptr0), _mm_loadu_ps(ptr0 + 4));
+            __m128i _g = float2uint8_sse(_mm_loadu_ps(ptr1), _mm_loadu_ps(ptr1 + 4));
+            __m128i _b = float2uint8_sse(_mm_loadu_ps(ptr2), _mm_loadu_ps(ptr2 + 4));
+            __m128i _a = float2uint8_sse(_mm_loadu_ps(ptr3), _mm_loadu_ps(ptr3 + 4));
+
+            store_c4x8_u8(bgra, _b, _g, _r, _a);
+
+            bgra += 4 * 8;
+            ptr0 += 8;
+            ptr1 += 8;
+            ptr2 += 8;
+            ptr3 += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             bgra[0] = SATURATE_CAST_UCHAR(*ptr2);
@@ -1869,7 +2274,7 @@ static int from_bgra2gray(const unsigned char* bgra, int w, int h, int stride, M
 
     for (int y = 0; y < h; y++)
     {
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -1933,6 +2338,19 @@ static int from_bgra2gray(const unsigned char* bgra, int w, int h, int stride, M
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _p0 = _mm_loadu_si128((const __m128i*)bgra);
+            __m128i _p1 = _mm_loadu_si128((const __m128i*)(bgra + 16));
+
+            _mm_storeu_ps(ptr, _mm_cvtepi32_ps(_mm_srli_epi32(pixel_gray_epi32(_p0, B2Y, G2Y, R2Y), Y_shift)));
+            _mm_storeu_ps(ptr + 4, _mm_cvtepi32_ps(_mm_srli_epi32(pixel_gray_epi32(_p1, B2Y, G2Y, R2Y), Y_shift)));
+
+            bgra += 4 * 8;
+            ptr += 8;
+        }
+#endif // __SSE2__
         for (; remain > 0; remain--)
         {
             *ptr = static_cast<float>((bgra[2] * R2Y + bgra[1] * G2Y + bgra[0] * B2Y) >> Y_shift);
@@ -1959,6 +2377,13 @@ void yuv420sp2rgb(const unsigned char* yuv420sp, int w, int h, unsigned char* rg
     int8x8_t _v22 = vdup_n_s8(22);
     int8x8_t _v113 = vdup_n_s8(113);
 #endif // __ARM_NEON
+#if __SSE2__
+    __m128i _v128 = _mm_set1_epi16(128);
+    __m128i _v90 = _mm_set1_epi16(90);
+    __m128i _vn46 = _mm_set1_epi16(-46);
+    __m128i _vn22 = _mm_set1_epi16(-22);
+    __m128i _v113 = _mm_set1_epi16(113);
+#endif // __SSE2__
 
     for (int y = 0; y < h; y += 2)
     {
@@ -1967,7 +2392,7 @@ void yuv420sp2rgb(const unsigned char* yuv420sp, int w, int h, unsigned char* rg
         unsigned char* rgb0 = rgb;
         unsigned char* rgb1 = rgb + w * 3;
 
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -2074,6 +2499,37 @@ void yuv420sp2rgb(const unsigned char* yuv420sp, int w, int h, unsigned char* rg
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _vu = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)vuptr), _mm_setzero_si128()), _v128);
+            __m128i _vv = _mm_shufflehi_epi16(_mm_shufflelo_epi16(_vu, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 2, 0, 0));
+            __m128i _uu = _mm_shufflehi_epi16(_mm_shufflelo_epi16(_vu, _MM_SHUFFLE(3, 3, 1, 1)), _MM_SHUFFLE(3, 3, 1, 1));
+
+            __m128i _ruv = _mm_mullo_epi16(_vv, _v90);
+            __m128i _guv = _mm_add_epi16(_mm_mullo_epi16(_vv, _vn46), _mm_mullo_epi16(_uu, _vn22));
+            __m128i _buv = _mm_mullo_epi16(_uu, _v113);
+
+            __m128i _yy0 = _mm_slli_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)yptr0), _mm_setzero_si128()), 6);
+            __m128i _yy1 = _mm_slli_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)yptr1), _mm_setzero_si128()), 6);
+
+            __m128i _r0 = _mm_srai_epi16(_mm_add_epi16(_yy0, _ruv), 6);
+            __m128i _g0 = _mm_srai_epi16(_mm_add_epi16(_yy0, _guv), 6);
+            __m128i _b0 = _mm_srai_epi16(_mm_add_epi16(_yy0, _buv), 6);
+            __m128i _r1 = _mm_srai_epi16(_mm_add_epi16(_yy1, _ruv), 6);
+            __m128i _g1 = _mm_srai_epi16(_mm_add_epi16(_yy1, _guv), 6);
+            __m128i _b1 = _mm_srai_epi16(_mm_add_epi16(_yy1, _buv), 6);
+
+            store_c3x8_u8(rgb0, _mm_packus_epi16(_r0, _r0), _mm_packus_epi16(_g0, _g0), _mm_packus_epi16(_b0, _b0));
+            store_c3x8_u8(rgb1, _mm_packus_epi16(_r1, _r1), _mm_packus_epi16(_g1, _g1), _mm_packus_epi16(_b1, _b1));
+
+            yptr0 += 8;
+            yptr1 += 8;
+            vuptr += 8;
+            rgb0 += 24;
+            rgb1 += 24;
+        }
+#endif // __SSE2__
 
 #define SATURATE_CAST_UCHAR(X) (unsigned char)::std::min(::std::max((int)(X), 0), 255);
         for (; remain > 0; remain -= 2)
@@ -2150,6 +2606,13 @@ void yuv420sp2rgb_nv12(const unsigned char* yuv420sp, int w, int h, unsigned cha
     int8x8_t _v22 = vdup_n_s8(22);
     int8x8_t _v113 = vdup_n_s8(113);
 #endif // __ARM_NEON
+#if __SSE2__
+    __m128i _v128 = _mm_set1_epi16(128);
+    __m128i _v90 = _mm_set1_epi16(90);
+    __m128i _vn46 = _mm_set1_epi16(-46);
+    __m128i _vn22 = _mm_set1_epi16(-22);
+    __m128i _v113 = _mm_set1_epi16(113);
+#endif // __SSE2__
 
     for (int y = 0; y < h; y += 2)
     {
@@ -2158,7 +2621,7 @@ void yuv420sp2rgb_nv12(const unsigned char* yuv420sp, int w, int h, unsigned cha
         unsigned char* rgb0 = rgb;
         unsigned char* rgb1 = rgb + w * 3;
 
-#if __ARM_NEON
+#if __ARM_NEON || __SSE2__
         int nn = w >> 3;
         int remain = w - (nn << 3);
 #else
@@ -2265,6 +2728,37 @@ void yuv420sp2rgb_nv12(const unsigned char* yuv420sp, int w, int h, unsigned cha
         }
 #endif // __aarch64__
 #endif // __ARM_NEON
+#if __SSE2__
+        for (; nn > 0; nn--)
+        {
+            __m128i _uv = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)uvptr), _mm_setzero_si128()), _v128);
+            __m128i _uu = _mm_shufflehi_epi16(_mm_shufflelo_epi16(_uv, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 2, 0, 0));
+            __m128i _vv = _mm_shufflehi_epi16(_mm_shufflelo_epi16(_uv, _MM_SHUFFLE(3, 3, 1, 1)), _MM_SHUFFLE(3, 3, 1, 1));
+
+            __m128i _ruv = _mm_mullo_epi16(_vv, _v90);
+            __m128i _guv = _mm_add_epi16(_mm_mullo_epi16(_vv, _vn46), _mm_mullo_epi16(_uu, _vn22));
+            __m128i _buv = _mm_mullo_epi16(_uu, _v113);
+
+            __m128i _yy0 = _mm_slli_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)yptr0), _mm_setzero_si128()), 6);
+            __m128i _yy1 = _mm_slli_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)yptr1), _mm_setzero_si128()), 6);
+
+            __m128i _r0 = _mm_srai_epi16(_mm_add_epi16(_yy0, _ruv), 6);
+            __m128i _g0 = _mm_srai_epi16(_mm_add_epi16(_yy0, _guv), 6);
+            __m128i _b0 = _mm_srai_epi16(_mm_add_epi16(_yy0, _buv), 6);
+            __m128i _r1 = _mm_srai_epi16(_mm_add_epi16(_yy1, _ruv), 6);
+            __m128i _g1 = _mm_srai_epi16(_mm_add_epi16(_yy1, _guv), 6);
+            __m128i _b1 = _mm_srai_epi16(_mm_add_epi16(_yy1, _buv), 6);
+
+            store_c3x8_u8(rgb0, _mm_packus_epi16(_r0, _r0), _mm_packus_epi16(_g0, _g0), _mm_packus_epi16(_b0, _b0));
+            store_c3x8_u8(rgb1, _mm_packus_epi16(_r1, _r1), _mm_packus_epi16(_g1, _g1), _mm_packus_epi16(_b1, _b1));
+
+            yptr0 += 8;
+            yptr1 += 8;
+            uvptr += 8;
+            rgb0 += 24;
+            rgb1 += 24;
+        }
+#endif // __SSE2__
 
 #define SATURATE_CAST_UCHAR(X) (unsigned char)::std::min(::std::max((int)(X), 0), 255);
         for (; remain > 0; remain -= 2)
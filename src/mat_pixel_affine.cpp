@@ -5,13 +5,39 @@
 #if __ARM_NEON
 #include <arm_neon.h>
 #endif // __ARM_NEON
+#if __SSE2__
+#include <emmintrin.h>
+#endif // __SSE2__
 #include <limits.h>
+#include <string.h>
 
 #include "platform.h"
 
 namespace ncnn {
 
 #if NCNN_PIXEL_AFFINE
+#if __SSE2__
+static NCNN_FORCEINLINE __m128i load_u8x6_sse2(const unsigned char* p)
+{
+    int v0;
+    unsigned short v1;
+    memcpy(&v0, p, 4);
+    memcpy(&v1, p + 4, 2);
+    return _mm_insert_epi16(_mm_cvtsi32_si128(v0), v1, 2);
+}
+
+// the channel pairs of two source rows are interleaved in 16bit, a0 a1 for each channel
+// horizontal pass >> 5 then vertical pass >> 15, same as the scalar path
+static NCNN_FORCEINLINE int warpaffine_bilinear_interp_sse2(const __m128i& _a01, const __m128i& _b01, const __m128i& _alpha, const __m128i& _beta)
+{
+    __m128i _ta = _mm_srli_epi32(_mm_madd_epi16(_a01, _alpha), 5);
+    __m128i _tb = _mm_srli_epi32(_mm_madd_epi16(_b01, _alpha), 5);
+    __m128i _d = _mm_srli_epi32(_mm_madd_epi16(_mm_or_si128(_ta, _mm_slli_epi32(_tb, 16)), _beta), 15);
+    _d = _mm_packs_epi32(_d, _d);
+    return _mm_cvtsi128_si32(_mm_packus_epi16(_d, _d));
+}
+#endif // __SSE2__
+
 void get_rotation_matrix(float angle, float scale, float dx, float dy, float* tm)
 {
     angle *= (float)(3.14159265358979323846 / 180);
@@ -966,6 +992,36 @@ void warpaffine_bilinear_c3(const unsigned char* src, int srcw, int srch, int sr
                 vst3_u8(dst0, _dst);
 
                 dst0 += 3 * 8;
+#elif __SSE2__
+                for (int xi = 0; xi < 8; xi++)
+                {
+                    int X = X0 + adelta[x + xi];
+                    int Y = Y0 + bdelta[x + xi];
+
+                    short sx = SATURATE_CAST_SHORT((X >> 10));
+                    short sy = SATURATE_CAST_SHORT((Y >> 10));
+
+                    short fx = X & ((1 << 10) - 1);
+                    short fy = Y & ((1 << 10) - 1);
+
+                    __m128i _alpha = _mm_set1_epi32(((1 << 10) - fx) | (fx << 16));
+                    __m128i _beta = _mm_set1_epi32(((1 << 10) - fy) | (fy << 16));
+
+                    const unsigned char* a0 = src0 + srcstride * sy + sx * 3;
+                    const unsigned char* b0 = src0 + srcstride * (sy + 1) + sx * 3;
+
+                    __m128i _a = _mm_unpacklo_epi8(load_u8x6_sse2(a0), _mm_setzero_si128());
+                    __m128i _b = _mm_unpacklo_epi8(load_u8x6_sse2(b0), _mm_setzero_si128());
+                    __m128i _a01 = _mm_unpacklo_epi16(_a, _mm_srli_si128(_a, 6));
+                    __m128i _b01 = _mm_unpacklo_epi16(_b, _mm_srli_si128(_b, 6));
+
+                    int d = warpaffine_bilinear_interp_sse2(_a01, _b01, _alpha, _beta);
+                    dst0[0] = (unsigned char)d;
+                    dst0[1] = (unsigned char)(d >> 8);
+                    dst0[2] = (unsigned char)(d >> 16);
+
+                    dst0 += 3;
+                }
 #else
                 for (int xi = 0; xi < 8; xi++)
                 {
@@ -1368,6 +1424,34 @@ void warpaffine_bilinear_c4(const unsigned char* src, int srcw, int srch, int sr
                 vst4_u8(dst0, _dst);
 
                 dst0 += 4 * 8;
+#elif __SSE2__
+                for (int xi = 0; xi < 8; xi++)
+                {
+                    int X = X0 + adelta[x + xi];
+                    int Y = Y0 + bdelta[x + xi];
+
+                    short sx = SATURATE_CAST_SHORT((X >> 10));
+                    short sy = SATURATE_CAST_SHORT((Y >> 10));
+
+                    short fx = X & ((1 << 10) - 1);
+                    short fy = Y & ((1 << 10) - 1);
+
+                    __m128i _alpha = _mm_set1_epi32(((1 << 10) - fx) | (fx << 16));
+                    __m128i _beta = _mm_set1_epi32(((1 << 10) - fy) | (fy << 16));
+
+                    const unsigned char* a0 = src0 + srcstride * sy + sx * 4;
+                    const unsigned char* b0 = src0 + srcstride * (sy + 1) + sx * 4;
+
+                    __m128i _a = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)a0), _mm_setzero_si128());
+                    __m128i _b = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)b0), _mm_setzero_si128());
+                    __m128i _a01 = _mm_unpacklo_epi16(_a, _mm_srli_si128(_a, 8));
+                    __m128i _b01 = _mm_unpacklo_epi16(_b, _mm_srli_si128(_b, 8));
+
+                    int d = warpaffine_bilinear_interp_sse2(_a01, _b01, _alpha, _beta);
+                    memcpy(dst0, &d, 4);
+
+                    dst0 += 4;
+                }
 #else
                 for (int xi = 0; xi < 8; xi++)
                 {
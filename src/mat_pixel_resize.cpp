@@ -1053,6 +1053,357 @@ void resize_bilinear_yuv420sp(const unsigned char* src, int srcw, int srch, unsi
     unsigned char* dstUV = dst + w * h;
     resize_bilinear_c2(srcUV, srcw / 2, srch / 2, dstUV, w / 2, h / 2);
 }
+
+// source channels, converted channels and where each converted channel comes from
+// index >= 0 picks a source channel, -1 is opaque alpha, -2 is gray from the red channel at gray_r
+static int get_pixel_convert_rule(int type, int& inch, int& outch, int* index, int& gray_r)
+{
+    const int type_from = type & Mat::PIXEL_FORMAT_MASK;
+    const int type_to = (type & Mat::PIXEL_CONVERT_MASK) ? (type >> Mat::PIXEL_CONVERT_SHIFT) : type_from;
+
+    if (type_from == Mat::PIXEL_RGB || type_from == Mat::PIXEL_BGR)
+        inch = 3;
+    else if (type_from == Mat::PIXEL_GRAY)
+        inch = 1;
+    else if (type_from == Mat::PIXEL_RGBA || type_from == Mat::PIXEL_BGRA)
+        inch = 4;
+    else
+        return -1;
+
+    const bool from_bgr = type_from == Mat::PIXEL_BGR || type_from == Mat::PIXEL_BGRA;
+
+    if (type_to == Mat::PIXEL_GRAY)
+    {
+        outch = 1;
+        index[0] = inch == 1 ? 0 : -2;
+        gray_r = from_bgr ? 2 : 0;
+        return 0;
+    }
+
+    if (type_to == Mat::PIXEL_RGB || type_to == Mat::PIXEL_BGR)
+        outch = 3;
+    else if (type_to == Mat::PIXEL_RGBA || type_to == Mat::PIXEL_BGRA)
+        outch = 4;
+    else
+        return -1;
+
+    const bool to_bgr = type_to == Mat::PIXEL_BGR || type_to == Mat::PIXEL_BGRA;
+    const bool swap_rb = inch != 1 && from_bgr != to_bgr;
+
+    for (int k = 0; k < 3; k++)
+    {
+        index[k] = inch == 1 ? 0 : swap_rb ? 2 - k : k;
+    }
+    if (outch == 4)
+    {
+        index[3] = inch == 4 ? 3 : -1;
+    }
+
+    return 0;
+}
+
+static void hresize_bilinear_row(const unsigned char* S, int w, int inch, const int* xofs, const short* ialpha, short* rows)
+{
+    for (int dx = 0; dx < w; dx++)
+    {
+        const unsigned char* Sp = S + xofs[dx];
+        short a0 = ialpha[dx * 2];
+        short a1 = ialpha[dx * 2 + 1];
+
+        for (int k = 0; k < inch; k++)
+        {
+            rows[k] = (Sp[k] * a0 + Sp[k + inch] * a1) >> 4;
+        }
+
+        rows += inch;
+    }
+}
+
+// convert one pixel row to planar float with scale and bias, then store it with the dst elempack and elemtype
+static void convert_normalize_pack_row(const unsigned char* p, int w, int inch, int outch, const int* index, int gray_r, const float* scale, const float* bias, float* rowf, Mat& dst, int y, int elemtype)
+{
+    // coeffs for r g b = 0.299f, 0.587f, 0.114f, same as from_pixels
+    const int Y_shift = 8;
+    const int R2Y = 77;
+    const int G2Y = 150;
+    const int B2Y = 29;
+
+    for (int k = 0; k < outch; k++)
+    {
+        float* ptr = rowf + w * k;
+        const float s = scale[k];
+        const float b = bias[k];
+
+        if (index[k] >= 0)
+        {
+            const unsigned char* pk = p + index[k];
+            for (int x = 0; x < w; x++)
+            {
+                ptr[x] = pk[x * inch] * s + b;
+            }
+        }
+        else if (index[k] == -1)
+        {
+            const float v = 255.f * s + b;
+            for (int x = 0; x < w; x++)
+            {
+                ptr[x] = v;
+            }
+        }
+        else
+        {
+            const unsigned char* pr = p + gray_r;
+            const unsigned char* pb = p + 2 - gray_r;
+            for (int x = 0; x < w; x++)
+            {
+                ptr[x] = (float)((pr[x * inch] * R2Y + p[x * inch + 1] * G2Y + pb[x * inch] * B2Y) >> Y_shift) * s + b;
+            }
+        }
+    }
+
+    const int elempack = dst.elempack;
+    for (int q = 0; q < dst.c; q++)
+    {
+        const float* ptr = rowf + w * q * elempack;
+
+        if (elemtype == 0)
+        {
+            float* outptr = dst.channel(q).row(y);
+
+            if (elempack == 1)
+            {
+                memcpy(outptr, ptr, w * sizeof(float));
+                continue;
+            }
+
+            for (int x = 0; x < w; x++)
+            {
+                for (int k = 0; k < elempack; k++)
+                {
+                    outptr[k] = ptr[w * k + x];
+                }
+                outptr += elempack;
+            }
+        }
+        else
+        {
+            unsigned short* outptr = dst.channel(q).row<unsigned short>(y);
+
+            for (int x = 0; x < w; x++)
+            {
+                for (int k = 0; k < elempack; k++)
+                {
+                    outptr[k] = elemtype == 1 ? float32_to_float16(ptr[w * k + x]) : float32_to_bfloat16(ptr[w * k + x]);
+                }
+                outptr += elempack;
+            }
+        }
+    }
+}
+
+int from_pixels_roi_resize_normalize(const unsigned char* pixels, int type, int w, int h, int stride, int roix, int roiy, int roiw, int roih, int target_width, int target_height, const float* mean_vals, const float* norm_vals, Mat& dst, int elempack, int elemtype, const Option& opt)
+{
+    if (roix < 0 || roiy < 0 || roiw <= 0 || roih <= 0 || roix + roiw > w || roiy + roih > h)
+    {
+        NCNN_LOGE("roi %d %d %d %d out of image %d %d", roix, roiy, roiw, roih, w, h);
+        return -1;
+    }
+
+    int inch = 0;
+    int outch = 0;
+    int index[4] = {0, 0, 0, 0};
+    int gray_r = 0;
+    if (get_pixel_convert_rule(type, inch, outch, index, gray_r) != 0)
+    {
+        NCNN_LOGE("unimplemented convert type %d", type);
+        return -1;
+    }
+
+    if ((elempack != 1 && elempack != 4) || outch % elempack != 0 || elemtype < 0 || elemtype > 2)
+    {
+        NCNN_LOGE("unsupported elempack %d elemtype %d for %d channels", elempack, elemtype, outch);
+        return -1;
+    }
+
+    const bool resize = roiw != target_width || roih != target_height;
+    if (resize && (target_width <= 0 || target_height <= 0 || roiw < 2 || roih < 2))
+    {
+        NCNN_LOGE("cannot resize %d %d to %d %d", roiw, roih, target_width, target_height);
+        return -1;
+    }
+
+    // same as substract_mean_normalize
+    float scale[4];
+    float bias[4];
+    for (int k = 0; k < outch; k++)
+    {
+        scale[k] = norm_vals ? norm_vals[k] : 1.f;
+        bias[k] = mean_vals ? (norm_vals ? -mean_vals[k] * norm_vals[k] : -mean_vals[k]) : 0.f;
+    }
+
+    const size_t elemsize = (elemtype == 0 ? 4u : 2u) * elempack;
+    dst.create(target_width, target_height, outch / elempack, elemsize, elempack, opt.blob_allocator);
+    if (dst.empty())
+        return -100;
+
+    const unsigned char* src = pixels + roiy * stride + roix * inch;
+
+    // bilinear coeffs, same as resize_bilinear_c1 .. c4
+    const int INTER_RESIZE_COEF_BITS = 11;
+    const int INTER_RESIZE_COEF_SCALE = 1 << INTER_RESIZE_COEF_BITS;
+
+    std::vector<int> xofs;
+    std::vector<int> yofs;
+    std::vector<short> ialpha;
+    std::vector<short> ibeta;
+    if (resize)
+    {
+        xofs.resize(target_width);
+        yofs.resize(target_height);
+        ialpha.resize(target_width * 2);
+        ibeta.resize(target_height * 2);
+
+        double scale_x = (double)roiw / target_width;
+        double scale_y = (double)roih / target_height;
+
+#define SATURATE_CAST_SHORT(X) (short)::std::min(::std::max((int)(X + (X >= 0.f ? 0.5f : -0.5f)), SHRT_MIN), SHRT_MAX);
+
+        for (int dx = 0; dx < target_width; dx++)
+        {
+            float fx = (float)((dx + 0.5) * scale_x - 0.5);
+            int sx = static_cast<int>(floor(fx));
+            fx -= sx;
+
+            if (sx < 0)
+            {
+                sx = 0;
+                fx = 0.f;
+            }
+            if (sx >= roiw - 1)
+            {
+                sx = roiw - 2;
+                fx = 1.f;
+            }
+
+            xofs[dx] = sx * inch;
+
+            float a0 = (1.f - fx) * INTER_RESIZE_COEF_SCALE;
+            float a1 = fx * INTER_RESIZE_COEF_SCALE;
+
+            ialpha[dx * 2] = SATURATE_CAST_SHORT(a0);
+            ialpha[dx * 2 + 1] = SATURATE_CAST_SHORT(a1);
+        }
+
+        for (int dy = 0; dy < target_height; dy++)
+        {
+            float fy = (float)((dy + 0.5) * scale_y - 0.5);
+            int sy = static_cast<int>(floor(fy));
+            fy -= sy;
+
+            if (sy < 0)
+            {
+                sy = 0;
+                fy = 0.f;
+            }
+            if (sy >= roih - 1)
+            {
+                sy = roih - 2;
+                fy = 1.f;
+            }
+
+            yofs[dy] = sy;
+
+            float b0 = (1.f - fy) * INTER_RESIZE_COEF_SCALE;
+            float b1 = fy * INTER_RESIZE_COEF_SCALE;
+
+            ibeta[dy * 2] = SATURATE_CAST_SHORT(b0);
+            ibeta[dy * 2 + 1] = SATURATE_CAST_SHORT(b1);
+        }
+
+#undef SATURATE_CAST_SHORT
+    }
+
+    // each thread resizes its own band of rows into small scratch rows
+    const int nT = std::max(1, std::min(opt.num_threads, target_height));
+    const int wsize = target_width * inch;
+
+    int ret = 0;
+    #pragma omp parallel for num_threads(nT)
+    for (int t = 0; t < nT; t++)
+    {
+        const int y0 = target_height * t / nT;
+        const int y1 = target_height * (t + 1) / nT;
+
+        Mat rowf(target_width, outch, (size_t)4u, opt.workspace_allocator);
+        Mat rowsbuf(wsize, 2, (size_t)2u, opt.workspace_allocator);
+        Mat rowu8(wsize, 2, (size_t)1u, opt.workspace_allocator);
+        if (rowf.empty() || rowsbuf.empty() || rowu8.empty())
+        {
+            ret = -100;
+            continue;
+        }
+
+        if (!resize)
+        {
+            for (int dy = y0; dy < y1; dy++)
+            {
+                convert_normalize_pack_row(src + stride * dy, target_width, inch, outch, index, gray_r, scale, bias, rowf, dst, dy, elemtype);
+            }
+            continue;
+        }
+
+        short* rows0 = rowsbuf.row<short>(0);
+        short* rows1 = rowsbuf.row<short>(1);
+        unsigned char* Dp0 = rowu8.row<unsigned char>(0);
+        unsigned char* Dp1 = rowu8.row<unsigned char>(1);
+
+        int prev_sy1 = -2;
+
+        for (int dy = y0; dy < y1; dy++)
+        {
+            int sy = yofs[dy];
+
+            if (sy == prev_sy1)
+            {
+                // reuse all rows
+            }
+            else if (sy == prev_sy1 + 1)
+            {
+                // hresize one row
+                std::swap(rows0, rows1);
+                hresize_bilinear_row(src + stride * (sy + 1), target_width, inch, &xofs[0], &ialpha[0], rows1);
+            }
+            else
+            {
+                // hresize two rows
+                hresize_bilinear_row(src + stride * sy, target_width, inch, &xofs[0], &ialpha[0], rows0);
+                hresize_bilinear_row(src + stride * (sy + 1), target_width, inch, &xofs[0], &ialpha[0], rows1);
+            }
+
+            prev_sy1 = sy;
+
+            if (dy + 1 < y1 && yofs[dy + 1] == sy)
+            {
+                // vresize for two rows
+                vresize_two(rows0, rows1, wsize, Dp0, Dp1, ibeta[dy * 2], ibeta[dy * 2 + 1], ibeta[dy * 2 + 2], ibeta[dy * 2 + 3]);
+
+                convert_normalize_pack_row(Dp0, target_width, inch, outch, index, gray_r, scale, bias, rowf, dst, dy, elemtype);
+                convert_normalize_pack_row(Dp1, target_width, inch, outch, index, gray_r, scale, bias, rowf, dst, dy + 1, elemtype);
+
+                dy += 1;
+            }
+            else
+            {
+                // vresize
+                vresize_one(rows0, rows1, wsize, Dp0, ibeta[dy * 2], ibeta[dy * 2 + 1]);
+
+                convert_normalize_pack_row(Dp0, target_width, inch, outch, index, gray_r, scale, bias, rowf, dst, dy, elemtype);
+            }
+        }
+    }
+
+    return ret;
+}
 #endif // NCNN_PIXEL
 
 } // namespace ncnn
@@ -5,11 +5,51 @@
 #if __ARM_NEON
 #include <arm_neon.h>
 #endif // __ARM_NEON
+#if __SSE2__
+#include <emmintrin.h>
+#endif // __SSE2__
+#include <string.h>
 #include "platform.h"
 
 namespace ncnn {
 
 #if NCNN_PIXEL_ROTATE
+#if __SSE2__
+// 12 bytes of 4 packed 3-channel pixels to one pixel per 32bit lane
+static NCNN_FORCEINLINE __m128i load_c3x4_sse2(const unsigned char* p)
+{
+    int v;
+    memcpy(&v, p + 8, 4);
+    __m128i _p = _mm_or_si128(_mm_loadl_epi64((const __m128i*)p), _mm_slli_si128(_mm_cvtsi32_si128(v), 8));
+
+    // move pixel 2 and 3 to the upper 64bit, then pixel 1 and 3 to the upper 32bit
+    _p = _mm_or_si128(_mm_and_si128(_p, _mm_set_epi32(0, 0, 0x0000ffff, -1)), _mm_and_si128(_mm_slli_si128(_p, 2), _mm_set_epi32(0x0000ffff, -1, 0, 0)));
+    return _mm_or_si128(_mm_and_si128(_p, _mm_set_epi32(0, 0x00ffffff, 0, 0x00ffffff)), _mm_and_si128(_mm_slli_epi64(_p, 8), _mm_set_epi32(0x00ffffff, 0, 0x00ffffff, 0)));
+}
+
+static NCNN_FORCEINLINE void store_c3x4_sse2(unsigned char* p, const __m128i& _p)
+{
+    __m128i _q = _mm_or_si128(_mm_and_si128(_p, _mm_set_epi32(0, 0x00ffffff, 0, 0x00ffffff)), _mm_and_si128(_mm_srli_epi64(_p, 8), _mm_set_epi32(0x0000ffff, (int)0xff000000, 0x0000ffff, (int)0xff000000)));
+    _q = _mm_or_si128(_mm_and_si128(_q, _mm_set_epi32(0, 0, -1, -1)), _mm_and_si128(_mm_srli_si128(_q, 2), _mm_set_epi32(0, -1, (int)0xffff0000, 0)));
+
+    _mm_storel_epi64((__m128i*)p, _q);
+    int v = _mm_cvtsi128_si32(_mm_srli_si128(_q, 8));
+    memcpy(p + 8, &v, 4);
+}
+
+static NCNN_FORCEINLINE void transpose4x4_epi32_sse2(__m128i& _r0, __m128i& _r1, __m128i& _r2, __m128i& _r3)
+{
+    __m128i _t0 = _mm_unpacklo_epi32(_r0, _r1);
+    __m128i _t1 = _mm_unpacklo_epi32(_r2, _r3);
+    __m128i _t2 = _mm_unpackhi_epi32(_r0, _r1);
+    __m128i _t3 = _mm_unpackhi_epi32(_r2, _r3);
+    _r0 = _mm_unpacklo_epi64(_t0, _t1);
+    _r1 = _mm_unpackhi_epi64(_t0, _t1);
+    _r2 = _mm_unpacklo_epi64(_t2, _t3);
+    _r3 = _mm_unpackhi_epi64(_t2, _t3);
+}
+#endif // __SSE2__
+
 // should be a kanna ascii art here in my local branch
 // but we shall ask the original art author for permission first ...
 // https://www.reddit.com/r/anime/comments/5uxjn4/i_recreated_the_kanna_ascii_art_from_kobayashisan/
@@ -745,6 +785,16 @@ static void kanna_rotate_2_c3(const unsigned char* src, int srcw, int srch, int
         dst0 += 7 * 3;
 #else
         int remain = srcw;
+#if __SSE2__
+        for (; remain > 3; remain -= 4)
+        {
+            __m128i _p = _mm_shuffle_epi32(load_c3x4_sse2(src0), _MM_SHUFFLE(0, 1, 2, 3));
+            store_c3x4_sse2(dst0 - 3 * 3, _p);
+
+            src0 += 4 * 3;
+            dst0 -= 4 * 3;
+        }
+#endif // __SSE2__
 #endif // __ARM_NEON
 
         for (; remain > 0; remain--)
@@ -836,6 +886,16 @@ static void kanna_rotate_2_c4(const unsigned char* src, int srcw, int srch, int
         dst0 += 7 * 4;
 #else
         int remain = srcw;
+#if __SSE2__
+        for (; remain > 3; remain -= 4)
+        {
+            __m128i _p = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)src0), _MM_SHUFFLE(0, 1, 2, 3));
+            _mm_storeu_si128((__m128i*)(dst0 - 3 * 4), _p);
+
+            src0 += 4 * 4;
+            dst0 -= 4 * 4;
+        }
+#endif // __SSE2__
 #endif // __ARM_NEON
 
         for (; remain > 0; remain--)
@@ -1088,6 +1148,16 @@ static void kanna_rotate_3_c3(const unsigned char* src, int srcw, int srch, int
         dst0 += 7 * 3;
 #else
         int remain = srcw;
+#if __SSE2__
+        for (; remain > 3; remain -= 4)
+        {
+            __m128i _p = _mm_shuffle_epi32(load_c3x4_sse2(src0), _MM_SHUFFLE(0, 1, 2, 3));
+            store_c3x4_sse2(dst0 - 3 * 3, _p);
+
+            src0 += 4 * 3;
+            dst0 -= 4 * 3;
+        }
+#endif // __SSE2__
 #endif // __ARM_NEON
 
         for (; remain > 0; remain--)
@@ -1182,6 +1252,16 @@ static void kanna_rotate_3_c4(const unsigned char* src, int srcw, int srch, int
         dst0 += 7 * 4;
 #else
         int remain = srcw;
+#if __SSE2__
+        for (; remain > 3; remain -= 4)
+        {
+            __m128i _p = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)src0), _MM_SHUFFLE(0, 1, 2, 3));
+            _mm_storeu_si128((__m128i*)(dst0 - 3 * 4), _p);
+
+            src0 += 4 * 4;
+            dst0 -= 4 * 4;
+        }
+#endif // __SSE2__
 #endif // __ARM_NEON
 
         for (; remain > 0; remain--)
@@ -2420,6 +2500,61 @@ static void kanna_rotate_5_c3(const unsigned char* src, int srcw, int srch, int
         src0 += srcwgap + 7 * srcstride;
     }
 #endif // __ARM_NEON
+#if __SSE2__
+    for (; y + 3 < srch; y += 4)
+    {
+        const unsigned char* src1 = src0 + srcstride;
+        const unsigned char* src2 = src0 + srcstride * 2;
+        const unsigned char* src3 = src0 + srcstride * 3;
+
+        unsigned char* dst0 = dst + y * 3;
+
+        int x = 0;
+        for (; x + 3 < srcw; x += 4)
+        {
+            __m128i _r0 = load_c3x4_sse2(src0);
+            __m128i _r1 = load_c3x4_sse2(src1);
+            __m128i _r2 = load_c3x4_sse2(src2);
+            __m128i _r3 = load_c3x4_sse2(src3);
+
+            transpose4x4_epi32_sse2(_r0, _r1, _r2, _r3);
+
+            store_c3x4_sse2(dst0, _r0);
+            store_c3x4_sse2(dst0 + stride, _r1);
+            store_c3x4_sse2(dst0 + 2 * stride, _r2);
+            store_c3x4_sse2(dst0 + 3 * stride, _r3);
+
+            src0 += 4 * 3;
+            src1 += 4 * 3;
+            src2 += 4 * 3;
+            src3 += 4 * 3;
+            dst0 += 4 * stride;
+        }
+        for (; x < srcw; x++)
+        {
+            dst0[0] = src0[0];
+            dst0[1] = src0[1];
+            dst0[2] = src0[2];
+            dst0[3] = src1[0];
+            dst0[4] = src1[1];
+            dst0[5] = src1[2];
+            dst0[6] = src2[0];
+            dst0[7] = src2[1];
+            dst0[8] = src2[2];
+            dst0[9] = src3[0];
+            dst0[10] = src3[1];
+            dst0[11] = src3[2];
+
+            src0 += 3;
+            src1 += 3;
+            src2 += 3;
+            src3 += 3;
+            dst0 += stride;
+        }
+
+        src0 += srcwgap + 3 * srcstride;
+    }
+#endif // __SSE2__
     for (; y < srch; y++)
     {
         unsigned char* dst0 = dst + y * 3;
@@ -2739,6 +2874,65 @@ static void kanna_rotate_5_c4(const unsigned char* src, int srcw, int srch, int
         src0 += srcwgap + 7 * srcstride;
     }
 #endif // __ARM_NEON
+#if __SSE2__
+    for (; y + 3 < srch; y += 4)
+    {
+        const unsigned char* src1 = src0 + srcstride;
+        const unsigned char* src2 = src0 + srcstride * 2;
+        const unsigned char* src3 = src0 + srcstride * 3;
+
+        unsigned char* dst0 = dst + y * 4;
+
+        int x = 0;
+        for (; x + 3 < srcw; x += 4)
+        {
+            __m128i _r0 = _mm_loadu_si128((const __m128i*)src0);
+            __m128i _r1 = _mm_loadu_si128((const __m128i*)src1);
+            __m128i _r2 = _mm_loadu_si128((const __m128i*)src2);
+            __m128i _r3 = _mm_loadu_si128((const __m128i*)src3);
+
+            transpose4x4_epi32_sse2(_r0, _r1, _r2, _r3);
+
+            _mm_storeu_si128((__m128i*)(dst0), _r0);
+            _mm_storeu_si128((__m128i*)(dst0 + stride), _r1);
+            _mm_storeu_si128((__m128i*)(dst0 + 2 * stride), _r2);
+            _mm_storeu_si128((__m128i*)(dst0 + 3 * stride), _r3);
+
+            src0 += 4 * 4;
+            src1 += 4 * 4;
+            src2 += 4 * 4;
+            src3 += 4 * 4;
+            dst0 += 4 * stride;
+        }
+        for (; x < srcw; x++)
+        {
+            dst0[0] = src0[0];
+            dst0[1] = src0[1];
+            dst0[2] = src0[2];
+            dst0[3] = src0[3];
+            dst0[4] = src1[0];
+            dst0[5] = src1[1];
+            dst0[6] = src1[2];
+            dst0[7] = src1[3];
+            dst0[8] = src2[0];
+            dst0[9] = src2[1];
+            dst0[10] = src2[2];
+            dst0[11] = src2[3];
+            dst0[12] = src3[0];
+            dst0[13] = src3[1];
+            dst0[14] = src3[2];
+            dst0[15] = src3[3];
+
+            src0 += 4;
+            src1 += 4;
+            src2 += 4;
+            src3 += 4;
+            dst0 += stride;
+        }
+
+        src0 += srcwgap + 3 * srcstride;
+    }
+#endif // __SSE2__
     for (; y < srch; y++)
     {
         unsigned char* dst0 = dst + y * 4;
@@ -3470,6 +3664,66 @@ static void kanna_rotate_6_c3(const unsigned char* src, int srcw, int srch, int
         src0 += srcwgap + 7 * srcstride;
     }
 #endif // __ARM_NEON
+#if __SSE2__
+    for (; y + 3 < srch; y += 4)
+    {
+        const unsigned char* src1 = src0 + srcstride;
+        const unsigned char* src2 = src0 + srcstride * 2;
+        const unsigned char* src3 = src0 + srcstride * 3;
+
+        unsigned char* dst0 = dstend - y * 3 - 4 * 3;
+
+        int x = 0;
+        for (; x + 3 < srcw; x += 4)
+        {
+            __m128i _r0 = load_c3x4_sse2(src0);
+            __m128i _r1 = load_c3x4_sse2(src1);
+            __m128i _r2 = load_c3x4_sse2(src2);
+            __m128i _r3 = load_c3x4_sse2(src3);
+
+            transpose4x4_epi32_sse2(_r0, _r1, _r2, _r3);
+
+            _r0 = _mm_shuffle_epi32(_r0, _MM_SHUFFLE(0, 1, 2, 3));
+            _r1 = _mm_shuffle_epi32(_r1, _MM_SHUFFLE(0, 1, 2, 3));
+            _r2 = _mm_shuffle_epi32(_r2, _MM_SHUFFLE(0, 1, 2, 3));
+            _r3 = _mm_shuffle_epi32(_r3, _MM_SHUFFLE(0, 1, 2, 3));
+
+            store_c3x4_sse2(dst0, _r0);
+            store_c3x4_sse2(dst0 + stride, _r1);
+            store_c3x4_sse2(dst0 + 2 * stride, _r2);
+            store_c3x4_sse2(dst0 + 3 * stride, _r3);
+
+            src0 += 4 * 3;
+            src1 += 4 * 3;
+            src2 += 4 * 3;
+            src3 += 4 * 3;
+            dst0 += 4 * stride;
+        }
+        for (; x < srcw; x++)
+        {
+            dst0[0] = src3[0];
+            dst0[1] = src3[1];
+            dst0[2] = src3[2];
+            dst0[3] = src2[0];
+            dst0[4] = src2[1];
+            dst0[5] = src2[2];
+            dst0[6] = src1[0];
+            dst0[7] = src1[1];
+            dst0[8] = src1[2];
+            dst0[9] = src0[0];
+            dst0[10] = src0[1];
+            dst0[11] = src0[2];
+
+            src0 += 3;
+            src1 += 3;
+            src2 += 3;
+            src3 += 3;
+            dst0 += stride;
+        }
+
+        src0 += srcwgap + 3 * srcstride;
+    }
+#endif // __SSE2__
     for (; y < srch; y++)
     {
         unsigned char* dst0 = dstend - y * 3 - 3;
@@ -3792,6 +4046,70 @@ static void kanna_rotate_6_c4(const unsigned char* src, int srcw, int srch, int
         src0 += srcwgap + 7 * srcstride;
     }
 #endif // __ARM_NEON
+#if __SSE2__
+    for (; y + 3 < srch; y += 4)
+    {
+        const unsigned char* src1 = src0 + srcstride;
+        const unsigned char* src2 = src0 + srcstride * 2;
+        const unsigned char* src3 = src0 + srcstride * 3;
+
+        unsigned char* dst0 = dstend - y * 4 - 4 * 4;
+
+        int x = 0;
+        for (; x + 3 < srcw; x += 4)
+        {
+            __m128i _r0 = _mm_loadu_si128((const __m128i*)src0);
+            __m128i _r1 = _mm_loadu_si128((const __m128i*)src1);
+            __m128i _r2 = _mm_loadu_si128((const __m128i*)src2);
+            __m128i _r3 = _mm_loadu_si128((const __m128i*)src3);
+
+            transpose4x4_epi32_sse2(_r0, _r1, _r2, _r3);
+
+            _r0 = _mm_shuffle_epi32(_r0, _MM_SHUFFLE(0, 1, 2, 3));
+            _r1 = _mm_shuffle_epi32(_r1, _MM_SHUFFLE(0, 1, 2, 3));
+            _r2 = _mm_shuffle_epi32(_r2, _MM_SHUFFLE(0, 1, 2, 3));
+            _r3 = _mm_shuffle_epi32(_r3, _MM_SHUFFLE(0, 1, 2, 3));
+
+            _mm_storeu_si128((__m128i*)(dst0), _r0);
+            _mm_storeu_si128((__m128i*)(dst0 + stride), _r1);
+            _mm_storeu_si128((__m128i*)(dst0 + 2 * stride), _r2);
+            _mm_storeu_si128((__m128i*)(dst0 + 3 * stride), _r3);
+
+            src0 += 4 * 4;
+            src1 += 4 * 4;
+            src2 += 4 * 4;
+            src3 += 4 * 4;
+            dst0 += 4 * stride;
+        }
+        for (; x < srcw; x++)
+        {
+            dst0[0] = src3[0];
+            dst0[1] = src3[1];
+            dst0[2] = src3[2];
+            dst0[3] = src3[3];
+            dst0[4] = src2[0];
+            dst0[5] = src2[1];
+            dst0[6] = src2[2];
+            dst0[7] = src2[3];
+            dst0[8] = src1[0];
+            dst0[9] = src1[1];
+            dst0[10] = src1[2];
+            dst0[11] = src1[3];
+            dst0[12] = src0[0];
+            dst0[13] = src0[1];
+            dst0[14] = src0[2];
+            dst0[15] = src0[3];
+
+            src0 += 4;
+            src1 += 4;
+            src2 += 4;
+            src3 += 4;
+            dst0 += stride;
+        }
+
+        src0 += srcwgap + 3 * srcstride;
+    }
+#endif // __SSE2__
     for (; y < srch; y++)
     {
         unsigned char* dst0 = dstend - y * 4 - 4;
@@ -4523,6 +4841,66 @@ static void kanna_rotate_7_c3(const unsigned char* src, int srcw, int srch, int
         src0 += srcwgap + 7 * srcstride;
     }
 #endif // __ARM_NEON
+#if __SSE2__
+    for (; y + 3 < srch; y += 4)
+    {
+        const unsigned char* src1 = src0 + srcstride;
+        const unsigned char* src2 = src0 + srcstride * 2;
+        const unsigned char* src3 = src0 + srcstride * 3;
+
+        unsigned char* dst0 = dstend - y * 3 - 4 * 3;
+
+        int x = 0;
+        for (; x + 3 < srcw; x += 4)
+        {
+            __m128i _r0 = load_c3x4_sse2(src0);
+            __m128i _r1 = load_c3x4_sse2(src1);
+            __m128i _r2 = load_c3x4_sse2(src2);
+            __m128i _r3 = load_c3x4_sse2(src3);
+
+            transpose4x4_epi32_sse2(_r0, _r1, _r2, _r3);
+
+            _r0 = _mm_shuffle_epi32(_r0, _MM_SHUFFLE(0, 1, 2, 3));
+            _r1 = _mm_shuffle_epi32(_r1, _MM_SHUFFLE(0, 1, 2, 3));
+            _r2 = _mm_shuffle_epi32(_r2, _MM_SHUFFLE(0, 1, 2, 3));
+            _r3 = _mm_shuffle_epi32(_r3, _MM_SHUFFLE(0, 1, 2, 3));
+
+            store_c3x4_sse2(dst0, _r0);
+            store_c3x4_sse2(dst0 - stride, _r1);
+            store_c3x4_sse2(dst0 - 2 * stride, _r2);
+            store_c3x4_sse2(dst0 - 3 * stride, _r3);
+
+            src0 += 4 * 3;
+            src1 += 4 * 3;
+            src2 += 4 * 3;
+            src3 += 4 * 3;
+            dst0 -= 4 * stride;
+        }
+        for (; x < srcw; x++)
+        {
+            dst0[0] = src3[0];
+            dst0[1] = src3[1];
+            dst0[2] = src3[2];
+            dst0[3] = src2[0];
+            dst0[4] = src2[1];
+            dst0[5] = src2[2];
+            dst0[6] = src1[0];
+            dst0[7] = src1[1];
+            dst0[8] = src1[2];
+            dst0[9] = src0[0];
+            dst0[10] = src0[1];
+            dst0[11] = src0[2];
+
+            src0 += 3;
+            src1 += 3;
+            src2 += 3;
+            src3 += 3;
+            dst0 -= stride;
+        }
+
+        src0 += srcwgap + 3 * srcstride;
+    }
+#endif // __SSE2__
     for (; y < srch; y++)
     {
         unsigned char* dst0 = dstend - y * 3 - 3;
@@ -4845,6 +5223,70 @@ static void kanna_rotate_7_c4(const unsigned char* src, int srcw, int srch, int
         src0 += srcwgap + 7 * srcstride;
     }
 #endif // __ARM_NEON
+#if __SSE2__
+    for (; y + 3 < srch; y += 4)
+    {
+        const unsigned char* src1 = src0 + srcstride;
+        const unsigned char* src2 = src0 + srcstride * 2;
+        const unsigned char* src3 = src0 + srcstride * 3;
+
+        unsigned char* dst0 = dstend - y * 4 - 4 * 4;
+
+        int x = 0;
+        for (; x + 3 < srcw; x += 4)
+        {
+            __m128i _r0 = _mm_loadu_si128((const __m128i*)src0);
+            __m128i _r1 = _mm_loadu_si128((const __m128i*)src1);
+            __m128i _r2 = _mm_loadu_si128((const __m128i*)src2);
+            __m128i _r3 = _mm_loadu_si128((const __m128i*)src3);
+
+            transpose4x4_epi32_sse2(_r0, _r1, _r2, _r3);
+
+            _r0 = _mm_shuffle_epi32(_r0, _MM_SHUFFLE(0, 1, 2, 3));
+            _r1 = _mm_shuffle_epi32(_r1, _MM_SHUFFLE(0, 1, 2, 3));
+            _r2 = _mm_shuffle_epi32(_r2, _MM_SHUFFLE(0, 1, 2, 3));
+            _r3 = _mm_shuffle_epi32(_r3, _MM_SHUFFLE(0, 1, 2, 3));
+
+            _mm_storeu_si128((__m128i*)(dst0), _r0);
+            _mm_storeu_si128((__m128i*)(dst0 - stride), _r1);
+            _mm_storeu_si128((__m128i*)(dst0 - 2 * stride), _r2);
+            _mm_storeu_si128((__m128i*)(dst0 - 3 * stride), _r3);
+
+            src0 += 4 * 4;
+            src1 += 4 * 4;
+            src2 += 4 * 4;
+            src3 += 4 * 4;
+            dst0 -= 4 * stride;
+        }
+        for (; x < srcw; x++)
+        {
+            dst0[0] = src3[0];
+            dst0[1] = src3[1];
+            dst0[2] = src3[2];
+            dst0[3] = src3[3];
+            dst0[4] = src2[0];
+            dst0[5] = src2[1];
+            dst0[6] = src2[2];
+            dst0[7] = src2[3];
+            dst0[8] = src1[0];
+            dst0[9] = src1[1];
+            dst0[10] = src1[2];
+            dst0[11] = src1[3];
+            dst0[12] = src0[0];
+            dst0[13] = src0[1];
+            dst0[14] = src0[2];
+            dst0[15] = src0[3];
+
+            src0 += 4;
+            src1 += 4;
+            src2 += 4;
+            src3 += 4;
+            dst0 -= stride;
+        }
+
+        src0 += srcwgap + 3 * srcstride;
+    }
+#endif // __SSE2__
     for (; y < srch; y++)
     {
         unsigned char* dst0 = dstend - y * 4 - 4;
@@ -5576,6 +6018,61 @@ static void kanna_rotate_8_c3(const unsigned char* src, int srcw, int srch, int
         src0 += srcwgap + 7 * srcstride;
     }
 #endif // __ARM_NEON
+#if __SSE2__
+    for (; y + 3 < srch; y += 4)
+    {
+        const unsigned char* src1 = src0 + srcstride;
+        const unsigned char* src2 = src0 + srcstride * 2;
+        const unsigned char* src3 = src0 + srcstride * 3;
+
+        unsigned char* dst0 = dstend + y * 3;
+
+        int x = 0;
+        for (; x + 3 < srcw; x += 4)
+        {
+            __m128i _r0 = load_c3x4_sse2(src0);
+            __m128i _r1 = load_c3x4_sse2(src1);
+            __m128i _r2 = load_c3x4_sse2(src2);
+            __m128i _r3 = load_c3x4_sse2(src3);
+
+            transpose4x4_epi32_sse2(_r0, _r1, _r2, _r3);
+
+            store_c3x4_sse2(dst0, _r0);
+            store_c3x4_sse2(dst0 - stride, _r1);
+            store_c3x4_sse2(dst0 - 2 * stride, _r2);
+            store_c3x4_sse2(dst0 - 3 * stride, _r3);
+
+            src0 += 4 * 3;
+            src1 += 4 * 3;
+            src2 += 4 * 3;
+            src3 += 4 * 3;
+            dst0 -= 4 * stride;
+        }
+        for (; x < srcw; x++)
+        {
+            dst0[0] = src0[0];
+            dst0[1] = src0[1];
+            dst0[2] = src0[2];
+            dst0[3] = src1[0];
+            dst0[4] = src1[1];
+            dst0[5] = src1[2];
+            dst0[6] = src2[0];
+            dst0[7] = src2[1];
+            dst0[8] = src2[2];
+            dst0[9] = src3[0];
+            dst0[10] = src3[1];
+            dst0[11] = src3[2];
+
+            src0 += 3;
+            src1 += 3;
+            src2 += 3;
+            src3 += 3;
+            dst0 -= stride;
+        }
+
+        src0 += srcwgap + 3 * srcstride;
+    }
+#endif // __SSE2__
     for (; y < srch; y++)
     {
         unsigned char* dst0 = dstend + y * 3;
@@ -5898,6 +6395,65 @@ static void kanna_rotate_8_c4(const unsigned char* src, int srcw, int srch, int
         src0 += srcwgap + 7 * srcstride;
     }
 #endif // __ARM_NEON
+#if __SSE2__
+    for (; y + 3 < srch; y += 4)
+    {
+        const unsigned char* src1 = src0 + srcstride;
+        const unsigned char* src2 = src0 + srcstride * 2;
+        const unsigned char* src3 = src0 + srcstride * 3;
+
+        unsigned char* dst0 = dstend + y * 4;
+
+        int x = 0;
+        for (; x + 3 < srcw; x += 4)
+        {
+            __m128i _r0 = _mm_loadu_si128((const __m128i*)src0);
+            __m128i _r1 = _mm_loadu_si128((const __m128i*)src1);
+            __m128i _r2 = _mm_loadu_si128((const __m128i*)src2);
+            __m128i _r3 = _mm_loadu_si128((const __m128i*)src3);
+
+            transpose4x4_epi32_sse2(_r0, _r1, _r2, _r3);
+
+            _mm_storeu_si128((__m128i*)(dst0), _r0);
+            _mm_storeu_si128((__m128i*)(dst0 - stride), _r1);
+            _mm_storeu_si128((__m128i*)(dst0 - 2 * stride), _r2);
+            _mm_storeu_si128((__m128i*)(dst0 - 3 * stride), _r3);
+
+            src0 += 4 * 4;
+            src1 += 4 * 4;
+            src2 += 4 * 4;
+            src3 += 4 * 4;
+            dst0 -= 4 * stride;
+        }
+        for (; x < srcw; x++)
+        {
+            dst0[0] = src0[0];
+            dst0[1] = src0[1];
+            dst0[2] = src0[2];
+            dst0[3] = src0[3];
+            dst0[4] = src1[0];
+            dst0[5] = src1[1];
+            dst0[6] = src1[2];
+            dst0[7] = src1[3];
+            dst0[8] = src2[0];
+            dst0[9] = src2[1];
+            dst0[10] = src2[2];
+            dst0[11] = src2[3];
+            dst0[12] = src3[0];
+            dst0[13] = src3[1];
+            dst0[14] = src3[2];
+            dst0[15] = src3[3];
+
+            src0 += 4;
+            src1 += 4;
+            src2 += 4;
+            src3 += 4;
+            dst0 -= stride;
+        }
+
+        src0 += srcwgap + 3 * srcstride;
+    }
+#endif // __SSE2__
     for (; y < srch; y++)
     {
         unsigned char* dst0 = dstend + y * 4;
@@ -24,16 +24,114 @@
 
 namespace ncnn {
 
+class NetPrivate;
+
+#if NCNN_THREADS
+// runs independent branches of the graph concurrently on a small worker pool
+// each ready layer gets a share of num_threads for its own openmp parallelism
+class BranchScheduler
+{
+public:
+    BranchScheduler(const NetPrivate* _d);
+    ~BranchScheduler();
+
+    int forward(int layer_index, std::vector<Mat>& blob_mats, const Option& opt);
+
+protected:
+    static void* worker_entry(void* args);
+    void worker_loop(int worker_id, int seen_generation);
+
+    // schedule ready layers until the job finishes, lock is held on entry and exit
+    void execute(int worker_id);
+    int pop_layer(int worker_id);
+
+    struct WorkerArgs
+    {
+        BranchScheduler* scheduler;
+        int worker_id;
+        int start_generation;
+    };
+
+    const NetPrivate* d;
+
+    Mutex lock;
+    ConditionVariable condition;
+
+    std::vector<Thread*> threads;
+    std::vector<WorkerArgs*> threads_args;
+    bool quit;
+    bool busy;
+
+    // current job
+    int generation;
+    int job_workers;
+    int active_workers;
+    std::vector<Mat>* blob_mats;
+    const Option* opt;
+
+    // unresolved inputs per layer, -1 for layers not needed by the job
+    std::vector<int> pending;
+    std::vector<std::vector<int> > consumers;
+
+    // per worker ready deque, the owner pops back and thieves steal front
+    std::vector<std::vector<int> > queues;
+    int queued;
+    int running;
+    int remaining;
+    int ret;
+};
+
+// runs create_pipeline of loaded layers on a worker pool while the caller keeps reading weights
+class PipelineCreator
+{
+public:
+    PipelineCreator(const std::vector<Layer*>& layers, const Option& opt);
+    ~PipelineCreator();
+
+    // queue a layer with loaded weights, blocks while enough layers are waiting
+    int create(int layer_index);
+
+    // wait for the queued layers, return the first failure
+    int finish();
+
+protected:
+    static void* worker_entry(void* args);
+    void worker_loop();
+
+    const std::vector<Layer*>& layers;
+    Option opt;
+
+    Mutex lock;
+    ConditionVariable condition;
+
+    std::vector<Thread*> threads;
+    bool quit;
+
+    std::vector<int> queue;
+    size_t queue_head;
+    int max_queued;
+    int running;
+    int ret;
+};
+#endif // NCNN_THREADS
+
 class NetPrivate
 {
 public:
     NetPrivate(Option& _opt);
+    ~NetPrivate();
 
     Option& opt;
 
     friend class Extractor;
     int forward_layer(int layer_index, std::vector<Mat>& blob_mats, const Option& opt) const;
 
+    // forward_layer with independent branches running concurrently
+    int forward_layer_parallel(int layer_index, std::vector<Mat>& blob_mats, const Option& opt) const;
+
+    // forward one layer whose bottom blobs are ready
+    int run_layer(const Layer* layer, std::vector<Mat>& blob_mats, const Option& opt) const;
+
 #if NCNN_VULKAN
     int forward_layer(int layer_index, std::vector<Mat>& blob_mats, std::vector<VkMat>& blob_mats_gpu, VkCompute& cmd, const Option& opt) const;
 #endif // NCNN_VULKAN
@@ -69,6 +167,10 @@ public:
     PoolAllocator* local_blob_allocator;
     PoolAllocator* local_workspace_allocator;
 
+#if NCNN_THREADS
+    BranchScheduler* branch_scheduler;
+#endif // NCNN_THREADS
+
 #if defined _WIN32 || __ANDROID__ || defined __OHOS__ || defined __linux__ || __APPLE__
     MappedFile mapped_model_file;
 #endif
@@ -89,6 +191,10 @@ NetPrivate::NetPrivate(Option& _opt)
     local_blob_allocator = 0;
     local_workspace_allocator = 0;
 
+#if NCNN_THREADS
+    branch_scheduler = new BranchScheduler(this);
+#endif // NCNN_THREADS
+
 #if NCNN_VULKAN
     vkdev = 0;
     weight_vkallocator = 0;
@@ -97,6 +203,13 @@ NetPrivate::NetPrivate(Option& _opt)
 #endif // NCNN_VULKAN
 }
 
+NetPrivate::~NetPrivate()
+{
+#if NCNN_THREADS
+    delete branch_scheduler;
+#endif // NCNN_THREADS
+}
+
 static Option get_masked_option(const Option& opt, int featmask)
 {
     // mask option usage as layer specific featmask
@@ -120,6 +233,42 @@ static Option get_masked_option(const Option& opt, int featmask)
     return opt1;
 }
 
+#if NCNN_BATCH
+static int create_batch_kvcache(const std::vector<Mat>& bottom_blobs, const Mat& cache, int batch, Mat& batch_cache, const Option& opt)
+{
+    // the first sequence grew its slot of the batched past cache in place, keep sharing it
+    for (size_t i = 0; i < bottom_blobs.size(); i++)
+    {
+        const Mat& past = bottom_blobs[i];
+        if (past.n == batch && past.data == cache.data && past.allocator == cache.allocator)
+        {
+            batch_cache = past;
+            batch_cache.h = cache.h;
+            return 0;
+        }
+    }
+
+    if (cache.dims != 3)
+    {
+        batch_cache.create_like(cache, batch, opt.kvcache_allocator);
+        if (batch_cache.empty())
+            return -100;
+
+        return 0;
+    }
+
+    // keep the reserved capacity so that later steps of every sequence grow in place
+    const int capacity = (int)(cache.cstep / cache.w);
+    batch_cache.create(cache.w, capacity, cache.c, cache.elemsize, cache.elempack, batch, opt.kvcache_allocator);
+    if (batch_cache.empty())
+        return -100;
+
+    batch_cache.h = cache.h;
+
+    return 0;
+}
+#endif // NCNN_BATCH
+
 int NetPrivate::forward_layer(int layer_index, std::vector<Mat>& blob_mats, const Option& opt) const
 {
     const Layer* layer = layers[layer_index];
@@ -142,6 +291,11 @@ int NetPrivate::forward_layer(int layer_index, std::vector<Mat>& blob_mats, cons
         }
     }
 
+    return run_layer(layer, blob_mats, opt);
+}
+
+int NetPrivate::run_layer(const Layer* layer, std::vector<Mat>& blob_mats, const Option& opt) const
+{
 #if NCNN_BENCHMARK
     double start = get_current_time();
     Mat bottom_blob;
@@ -188,6 +342,433 @@ int NetPrivate::forward_layer(int layer_index, std::vector<Mat>& blob_mats, cons
     return 0;
 }
 
+int NetPrivate::forward_layer_parallel(int layer_index, std::vector<Mat>& blob_mats, const Option& opt) const
+{
+    if (layers[layer_index]->typeindex == LayerType::Input)
+        return 0;
+
+#if NCNN_THREADS
+    if (opt.num_threads > 1)
+        return branch_scheduler->forward(layer_index, blob_mats, opt);
+#endif // NCNN_THREADS
+
+    return forward_layer(layer_index, blob_mats, opt);
+}
+
+#if NCNN_THREADS
+BranchScheduler::BranchScheduler(const NetPrivate* _d)
+    : d(_d)
+{
+    quit = false;
+    busy = false;
+
+    generation = 0;
+    job_workers = 0;
+    active_workers = 0;
+    blob_mats = 0;
+    opt = 0;
+
+    queued = 0;
+    running = 0;
+    remaining = 0;
+    ret = 0;
+}
+
+BranchScheduler::~BranchScheduler()
+{
+    lock.lock();
+    quit = true;
+    condition.broadcast();
+    lock.unlock();
+
+    for (size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i]->join();
+        delete threads[i];
+        delete threads_args[i];
+    }
+}
+
+void* BranchScheduler::worker_entry(void* args)
+{
+    WorkerArgs* wa = (WorkerArgs*)args;
+    wa->scheduler->worker_loop(wa->worker_id, wa->start_generation);
+    return 0;
+}
+
+void BranchScheduler::worker_loop(int worker_id, int seen_generation)
+{
+    lock.lock();
+
+    while (1)
+    {
+        while (!quit && generation == seen_generation)
+        {
+            condition.wait(lock);
+        }
+
+        if (quit)
+            break;
+
+        seen_generation = generation;
+
+        if (worker_id < job_workers)
+        {
+            active_workers++;
+
+            set_flush_denormals(opt->flush_denormals);
+
+            if (opt->numa_node >= 0)
+            {
+                // openmp threads created from this worker inherit the binding
+                set_numa_node_thread_affinity(opt->numa_node, 1);
+            }
+
+            execute(worker_id);
+
+            active_workers--;
+            condition.broadcast();
+        }
+    }
+
+    lock.unlock();
+}
+
+int BranchScheduler::pop_layer(int worker_id)
+{
+    // continue own branch first, depth first keeps the producer output hot in cache
+    std::vector<int>& own = queues[worker_id];
+    if (!own.empty())
+    {
+        int layer_index = own.back();
+        own.pop_back();
+        queued--;
+        return layer_index;
+    }
+
+    // steal the oldest ready layer from others
+    for (int i = 1; i < job_workers; i++)
+    {
+        std::vector<int>& victim = queues[(worker_id + i) % job_workers];
+        if (!victim.empty())
+        {
+            int layer_index = victim.front();
+            victim.erase(victim.begin());
+            queued--;
+            return layer_index;
+        }
+    }
+
+    return -1;
+}
+
+void BranchScheduler::execute(int worker_id)
+{
+    while (remaining > 0 && ret == 0)
+    {
+        int layer_index = pop_layer(worker_id);
+        if (layer_index == -1)
+        {
+            condition.wait(lock);
+            continue;
+        }
+
+        running++;
+
+        // split the threads between all branches that can run right now
+        Option opt1 = *opt;
+        opt1.num_threads = std::max(1, opt->num_threads / (running + queued));
+
+        lock.unlock();
+
+        int layer_ret = d->run_layer(d->layers[layer_index], *blob_mats, opt1);
+
+        lock.lock();
+
+        running--;
+        remaining--;
+
+        if (layer_ret != 0 && ret == 0)
+            ret = layer_ret;
+
+        const std::vector<int>& layer_consumers = consumers[layer_index];
+        for (size_t i = 0; i < layer_consumers.size(); i++)
+        {
+            int consumer_index = layer_consumers[i];
+            pending[consumer_index]--;
+            if (pending[consumer_index] == 0)
+            {
+                queues[worker_id].push_back(consumer_index);
+                queued++;
+            }
+        }
+
+        condition.broadcast();
+    }
+}
+
+int BranchScheduler::forward(int layer_index, std::vector<Mat>& _blob_mats, const Option& _opt)
+{
+    lock.lock();
+
+    if (busy)
+    {
+        // another extractor is using the workers
+        lock.unlock();
+        return d->forward_layer(layer_index, _blob_mats, _opt);
+    }
+
+    // collect the layers needed for layer_index and their dependencies
+    const int layer_count = (int)d->layers.size();
+    pending.assign(layer_count, -1);
+    consumers.resize(layer_count);
+
+    std::vector<int> stack;
+    stack.push_back(layer_index);
+    pending[layer_index] = 0;
+    consumers[layer_index].clear();
+
+    int needed_count = 0;
+    int width = 1;
+    while (!stack.empty())
+    {
+        int index = stack.back();
+        stack.pop_back();
+        needed_count++;
+
+        const Layer* layer = d->layers[index];
+        for (size_t i = 0; i < layer->bottoms.size(); i++)
+        {
+            int bottom_blob_index = layer->bottoms[i];
+            if (_blob_mats[bottom_blob_index].dims != 0)
+                continue;
+
+            int producer = d->blobs[bottom_blob_index].producer;
+            if (d->layers[producer]->typeindex == LayerType::Input)
+                continue;
+
+            if (pending[producer] == -1)
+            {
+                pending[producer] = 0;
+                consumers[producer].clear();
+                stack.push_back(producer);
+            }
+            else
+            {
+                // every extra consumer may open a new branch
+                width++;
+            }
+
+            consumers[producer].push_back(index);
+            pending[index]++;
+        }
+    }
+
+    // independent layers that are ready at once, like multiple input branches
+    int ready_count = 0;
+    for (int i = 0; i < layer_count; i++)
+    {
+        if (pending[i] == 0)
+            ready_count++;
+    }
+    width += ready_count - 1;
+
+    job_workers = std::min(width, _opt.num_threads);
+    if (job_workers <= 1)
+    {
+        // plain chain, nothing to overlap
+        lock.unlock();
+        return d->forward_layer(layer_index, _blob_mats, _opt);
+    }
+
+    busy = true;
+
+    queues.resize(std::max((int)queues.size(), job_workers));
+    for (int i = 0; i < job_workers; i++)
+    {
+        queues[i].clear();
+    }
+
+    queued = 0;
+    for (int i = 0; i < layer_count; i++)
+    {
+        if (pending[i] == 0)
+        {
+            queues[0].push_back(i);
+            queued++;
+        }
+    }
+
+    running = 0;
+    remaining = needed_count;
+    ret = 0;
+    blob_mats = &_blob_mats;
+    opt = &_opt;
+
+    // spawn the missing workers, they stay alive until the net is destroyed
+    while ((int)threads.size() < job_workers - 1)
+    {
+        WorkerArgs* args = new WorkerArgs;
+        args->scheduler = this;
+        args->worker_id = (int)threads.size() + 1;
+        args->start_generation = generation;
+        threads_args.push_back(args);
+        threads.push_back(new Thread(worker_entry, (void*)args));
+    }
+
+    generation++;
+    condition.broadcast();
+
+    // the calling thread is worker 0
+    execute(0);
+
+    // wait for the layers still running on other workers
+    while (running > 0 || active_workers > 0)
+    {
+        condition.wait(lock);
+    }
+
+    int job_ret = ret;
+
+    blob_mats = 0;
+    opt = 0;
+    job_workers = 0;
+    busy = false;
+
+    lock.unlock();
+
+    return job_ret;
+}
+
+PipelineCreator::PipelineCreator(const std::vector<Layer*>& _layers, const Option& _opt)
+    : layers(_layers), opt(_opt)
+{
+    // weights are prepared concurrently, keep them away from allocators that may not be thread-safe
+    opt.blob_allocator = 0;
+    opt.workspace_allocator = 0;
+
+    quit = false;
+    queue_head = 0;
+    running = 0;
+    ret = 0;
+
+    const int worker_count = std::min(opt.num_threads, (int)layers.size());
+
+    // bound the layers holding raw weights that wait for a worker
+    max_queued = worker_count * 2;
+
+    for (int i = 0; i < worker_count; i++)
+    {
+        threads.push_back(new Thread(worker_entry, (void*)this));
+    }
+}
+
+PipelineCreator::~PipelineCreator()
+{
+    lock.lock();
+    quit = true;
+    condition.broadcast();
+    lock.unlock();
+
+    for (size_t i = 0; i < threads.size(); i++)
+    {
+        threads[i]->join();
+        delete threads[i];
+    }
+}
+
+void* PipelineCreator::worker_entry(void* args)
+{
+    ((PipelineCreator*)args)->worker_loop();
+    return 0;
+}
+
+void PipelineCreator::worker_loop()
+{
+    set_flush_denormals(opt.flush_denormals);
+
+    if (opt.numa_node >= 0)
+    {
+        // openmp threads created from this worker inherit the binding
+        set_numa_node_thread_affinity(opt.numa_node, 1);
+    }
+
+    lock.lock();
+
+    while (1)
+    {
+        while (!quit && queue_head == queue.size())
+        {
+            condition.wait(lock);
+        }
+
+        if (queue_head == queue.size())
+            break;
+
+        int layer_index = queue[queue_head++];
+        running++;
+
+        // split the threads between all layers in flight
+        const int queued = (int)(queue.size() - queue_head);
+        Option opt1 = get_masked_option(opt, layers[layer_index]->featmask);
+        opt1.num_threads = std::min(opt1.num_threads, std::max(1, opt.num_threads / (running + queued)));
+
+        condition.broadcast();
+        lock.unlock();
+
+        int cret = layers[layer_index]->create_pipeline(opt1);
+        if (cret != 0)
+        {
+#if NCNN_STRING
+            NCNN_LOGE("layer create_pipeline %d %s failed", layer_index, layers[layer_index]->name.c_str());
+#else
+            NCNN_LOGE("layer create_pipeline %d failed", layer_index);
+#endif
+        }
+
+        lock.lock();
+
+        running--;
+        if (cret != 0 && ret == 0)
+            ret = cret;
+
+        condition.broadcast();
+    }
+
+    lock.unlock();
+}
+
+int PipelineCreator::create(int layer_index)
+{
+    MutexLockGuard guard(lock);
+
+    while (ret == 0 && (int)(queue.size() - queue_head) >= max_queued)
+    {
+        condition.wait(lock);
+    }
+
+    if (ret != 0)
+        return ret;
+
+    queue.push_back(layer_index);
+    condition.broadcast();
+
+    return 0;
+}
+
+int PipelineCreator::finish()
+{
+    MutexLockGuard guard(lock);
+
+    while (queue_head < queue.size() || running > 0)
+    {
+        condition.wait(lock);
+    }
+
+    return ret;
+}
+#endif // NCNN_THREADS
+
 #if NCNN_VULKAN
 int NetPrivate::forward_layer(int layer_index, std::vector<Mat>& blob_mats, std::vector<VkMat>& blob_mats_gpu, VkCompute& cmd, const Option& opt) const
 {
@@ -685,6 +1266,11 @@ int NetPrivate::do_forward_layer(const Layer* layer, std::vector<Mat>& blob_mats
                 {
                     Mat bottom_b = bottom_blob.batch(b);
                     Mat top_b;
+                    if (b > 0)
+                    {
+                        // let the layer write into the batch slot directly
+                        top_b = top_batch.batch(b);
+                    }
                     int ret = layer->forward(bottom_b, top_b, opt);
                     if (ret != 0)
                         return ret;
@@ -696,7 +1282,11 @@ int NetPrivate::do_forward_layer(const Layer* layer, std::vector<Mat>& blob_mats
                             return -100;
                     }
 
-                    memcpy(top_batch.batch(b), top_b, top_b.total() * top_b.elemsize);
+                    Mat top_batch_b = top_batch.batch(b);
+                    if (top_b.data != top_batch_b.data)
+                    {
+                        memcpy(top_batch_b, top_b, top_b.total() * top_b.elemsize);
+                    }
                 }
 
                 // store top blob
@@ -801,6 +1391,14 @@ int NetPrivate::do_forward_layer(const Layer* layer, std::vector<Mat>& blob_mats
                 }
 
                 std::vector<Mat> top_b(layer->tops.size());
+                if (b > 0)
+                {
+                    // let the layer write into the batch slots directly
+                    for (size_t i = 0; i < top_batches.size(); i++)
+                    {
+                        top_b[i] = top_batches[i].batch(b);
+                    }
+                }
                 int ret = layer->forward(bottom_b, top_b, opt);
                 if (ret != 0)
                     return ret;
@@ -809,6 +1407,15 @@ int NetPrivate::do_forward_layer(const Layer* layer, std::vector<Mat>& blob_mats
                 {
                     for (size_t i = 0; i < top_batches.size(); i++)
                     {
+                        if (opt.kvcache_allocator && top_b[i].allocator == opt.kvcache_allocator)
+                        {
+                            // one padded cache for all sequences, per-sequence lengths are carried by the attention mask
+                            int ret = create_batch_kvcache(bottom_blobs, top_b[i], B, top_batches[i], opt);
+                            if (ret != 0)
+                                return ret;
+                            continue;
+                        }
+
                         top_batches[i].create_like(top_b[i], B, opt.blob_allocator);
                         if (top_batches[i].empty())
                             return -100;
@@ -817,7 +1424,11 @@ int NetPrivate::do_forward_layer(const Layer* layer, std::vector<Mat>& blob_mats
 
                 for (size_t i = 0; i < top_batches.size(); i++)
                 {
-                    memcpy(top_batches[i].batch(b), top_b[i], top_b[i].total() * top_b[i].elemsize);
+                    Mat top_batch_b = top_batches[i].batch(b);
+                    if (top_b[i].data != top_batch_b.data)
+                    {
+                        memcpy(top_batch_b, top_b[i], top_b[i].total() * top_b[i].elemsize);
+                    }
                 }
             }
 
@@ -828,12 +1439,12 @@ int NetPrivate::do_forward_layer(const Layer* layer, std::vector<Mat>& blob_mats
                 blob_mats[top_blob_index] = top_batches[i];
             }
 
-            if (opt.lightmode)
+            if (opt.lightmode || opt.kvcache_allocator)
             {
                 for (size_t i = 0; i < layer->bottoms.size(); i++)
                 {
-                    int bottom_blob_index = layer->bottoms[i];
-                    blob_mats[bottom_blob_index].release();
+                    if (opt.lightmode || bottom_blobs[i].allocator == opt.kvcache_allocator)
+                        blob_mats[layer->bottoms[i]].release();
                 }
             }
         }
@@ -2029,6 +2640,12 @@ int Net::load_model(const DataReader& dr)
 
     int layer_count = (int)d->layers.size();
 
+    if (opt.numa_node >= 0)
+    {
+        // weights are allocated on the node of the thread touching them first
+        set_numa_node_thread_affinity(opt.numa_node, opt.num_threads);
+    }
+
     // load file
     int ret = 0;
 
@@ -2065,6 +2682,15 @@ int Net::load_model(const DataReader& dr)
     }
 #endif // NCNN_VULKAN
 
+#if NCNN_THREADS
+    // autotune measurements and gpu uploads stay sequential
+    PipelineCreator* pipeline_creator = 0;
+    if (opt.use_parallel_create_pipeline && opt.num_threads > 1 && !opt.use_vulkan_compute && !opt.autotune_cache)
+    {
+        pipeline_creator = new PipelineCreator(d->layers, opt);
+    }
+#endif // NCNN_THREADS
+
     ModelBinFromDataReader mb(dr);
     for (int i = 0; i < layer_count; i++)
     {
@@ -2090,6 +2716,20 @@ int Net::load_model(const DataReader& dr)
             break;
         }
 
+#if NCNN_THREADS
+        if (pipeline_creator)
+        {
+            // create_pipeline overlaps with reading the next weights
+            if (pipeline_creator->create(i) != 0)
+            {
+                ret = -1;
+                break;
+            }
+
+            continue;
+        }
+#endif // NCNN_THREADS
+
         Option opt1 = get_masked_option(opt, layer->featmask);
 
         int cret = layer->create_pipeline(opt1);
@@ -2135,6 +2775,16 @@ int Net::load_model(const DataReader& dr)
 #endif // NCNN_VULKAN
     }
 
+#if NCNN_THREADS
+    if (pipeline_creator)
+    {
+        if (pipeline_creator->finish() != 0)
+            ret = -1;
+
+        delete pipeline_creator;
+    }
+#endif // NCNN_THREADS
+
     if (opt.use_local_pool_allocator)
     {
         if (opt.blob_allocator == 0)
@@ -2673,16 +3323,63 @@ Layer* Net::create_overwrite_builtin_layer(int typeindex)
     return layer;
 }
 
+// one extract replays one blob arena plan
+// the plan is chosen by the blobs already present and the blob to extract
+class BlobArenaRun
+{
+public:
+    BlobArenaRun(BlobArenaAllocator* _allocator, const std::vector<Mat>& blob_mats, int blob_index, const Option& opt)
+        : allocator(_allocator)
+    {
+        if (!allocator)
+            return;
+
+        std::vector<int> signature;
+        signature.push_back(blob_index);
+        signature.push_back(opt.lightmode ? 1 : 0);
+        for (size_t i = 0; i < blob_mats.size(); i++)
+        {
+            const Mat& m = blob_mats[i];
+            if (m.dims == 0)
+                continue;
+
+            signature.push_back((int)i);
+            signature.push_back(m.dims);
+            signature.push_back(m.w);
+            signature.push_back(m.h);
+            signature.push_back(m.d);
+            signature.push_back(m.c);
+            signature.push_back((int)m.elemsize);
+            signature.push_back(m.elempack);
+#if NCNN_BATCH
+            signature.push_back(m.n);
+#endif
+        }
+
+        allocator->begin_run(signature);
+    }
+
+    ~BlobArenaRun()
+    {
+        if (allocator)
+            allocator->end_run();
+    }
+
+private:
+    BlobArenaAllocator* allocator;
+};
+
 class ExtractorPrivate
 {
 public:
     ExtractorPrivate(const Net* _net)
-        : net(_net)
+        : net(_net), blob_arena_allocator(0)
     {
     }
     const Net* net;
     std::vector<Mat> blob_mats;
     Option opt;
+    BlobArenaAllocator* blob_arena_allocator;
 
 #if NCNN_VULKAN
     VkAllocator* local_blob_vkallocator;
@@ -2722,6 +3419,7 @@ Extractor::Extractor(const Extractor& rhs)
     d->net = rhs.d->net;
     d->blob_mats = rhs.d->blob_mats;
     d->opt = rhs.d->opt;
+    d->blob_arena_allocator = rhs.d->blob_arena_allocator;
 
 #if NCNN_VULKAN
     d->local_blob_vkallocator = 0;
@@ -2739,6 +3437,7 @@ Extractor& Extractor::operator=(const Extractor& rhs)
     d->net = rhs.d->net;
     d->blob_mats = rhs.d->blob_mats;
     d->opt = rhs.d->opt;
+    d->blob_arena_allocator = rhs.d->blob_arena_allocator;
 
 #if NCNN_VULKAN
     d->local_blob_vkallocator = 0;
@@ -2781,6 +3480,7 @@ void Extractor::set_light_mode(bool enable)
 void Extractor::set_blob_allocator(Allocator* allocator)
 {
     d->opt.blob_allocator = allocator;
+    d->blob_arena_allocator = 0;
 }
 
 void Extractor::set_workspace_allocator(Allocator* allocator)
@@ -2791,6 +3491,7 @@ void Extractor::set_workspace_allocator(Allocator* allocator)
 void Extractor::set_kvcache_allocator(Allocator* allocator)
 {
     d->opt.kvcache_allocator = allocator;
+    d->opt.kvcache_block_seqlen = 0;
 }
 
 void Extractor::set_kvcache_max_seqlen_hint(int max_seqlen_hint)
@@ -2798,6 +3499,18 @@ void Extractor::set_kvcache_max_seqlen_hint(int max_seqlen_hint)
     d->opt.kvcache_max_seqlen_hint = max_seqlen_hint;
 }
 
+void Extractor::set_paged_kvcache_allocator(PagedKVCacheAllocator* allocator)
+{
+    d->opt.kvcache_allocator = allocator;
+    d->opt.kvcache_block_seqlen = allocator ? allocator->block_seqlen() : 0;
+}
+
+void Extractor::set_blob_arena_allocator(BlobArenaAllocator* allocator)
+{
+    d->opt.blob_allocator = allocator;
+    d->blob_arena_allocator = allocator;
+}
+
 #if NCNN_VULKAN
 void Extractor::set_blob_vkallocator(VkAllocator* allocator)
 {
@@ -2880,13 +3593,13 @@ int Extractor::extract(int blob_index, Mat& feat, int type)
     }
 
 #if NCNN_BATCH
-    if (d->opt.kvcache_allocator)
+    if (d->opt.kvcache_allocator && d->opt.kvcache_block_seqlen > 0)
     {
         for (size_t i = 0; i < d->blob_mats.size(); i++)
         {
             if (d->blob_mats[i].n > 1)
             {
-                NCNN_LOGE("kvcache does not support batch");
+                NCNN_LOGE("paged kvcache does not support batch");
                 return -1;
             }
         }
@@ -2899,12 +3612,20 @@ int Extractor::extract(int blob_index, Mat& feat, int type)
     int old_flush_denormals = get_flush_denormals();
     set_flush_denormals(d->opt.flush_denormals);
 
+    BlobArenaRun blob_arena_run(d->blob_arena_allocator, d->blob_mats, blob_index, d->opt);
+
     int ret = 0;
 
     if (d->blob_mats[blob_index].dims == 0)
     {
         int layer_index = d->net->blobs()[blob_index].producer;
 
+        if (d->opt.numa_node >= 0)
+        {
+            // keep the computing threads next to the weights
+            set_numa_node_thread_affinity(d->opt.numa_node, d->opt.num_threads);
+        }
+
         // use local allocator
         if (d->opt.use_local_pool_allocator)
         {
@@ -2967,12 +3688,23 @@ int Extractor::extract(int blob_index, Mat& feat, int type)
 #endif // NCNN_BENCHMARK
             }
         }
+        else if (d->opt.use_parallel_branch)
+        {
+            ret = d->net->d->forward_layer_parallel(layer_index, d->blob_mats, d->opt);
+        }
         else
         {
             ret = d->net->d->forward_layer(layer_index, d->blob_mats, d->opt);
         }
 #else
-        ret = d->net->d->forward_layer(layer_index, d->blob_mats, d->opt);
+        if (d->opt.use_parallel_branch)
+        {
+            ret = d->net->d->forward_layer_parallel(layer_index, d->blob_mats, d->opt);
+        }
+        else
+        {
+            ret = d->net->d->forward_layer(layer_index, d->blob_mats, d->opt);
+        }
 #endif // NCNN_VULKAN
     }
 
@@ -3071,6 +3803,93 @@ int Extractor::extract(int blob_index, Mat& feat, int type)
     return ret;
 }
 
+int Extractor::fork_kvcache(const Mat& cache, Mat& forked) const
+{
+    if (cache.empty())
+    {
+        forked.release();
+        return 0;
+    }
+
+    PagedKVCacheAllocator* paged_allocator = d->opt.kvcache_block_seqlen > 0 ? (PagedKVCacheAllocator*)d->opt.kvcache_allocator : 0;
+    if (paged_allocator && cache.allocator == paged_allocator && paged_allocator->is_table(cache.data))
+    {
+        // share the past blocks, the partially filled last block is copied on the next append
+        const PagedKVCacheTable* table = (const PagedKVCacheTable*)cache.data;
+        const int block_count = (cache.h + table->block_seqlen - 1) / table->block_seqlen;
+
+        PagedKVCacheTable* new_table = paged_allocator->table_fork(table, block_count, table->max_block_count);
+        if (!new_table)
+            return -100;
+
+        Mat m;
+        m.data = new_table;
+        m.refcount = &new_table->refcount;
+        m.elemsize = cache.elemsize;
+        m.elempack = cache.elempack;
+        m.allocator = paged_allocator;
+        m.dims = cache.dims;
+        m.w = cache.w;
+        m.h = cache.h;
+        m.d = cache.d;
+        m.c = cache.c;
+        m.cstep = cache.cstep;
+#if NCNN_BATCH
+        m.nstep = cache.nstep;
+#endif
+
+        forked = m;
+
+        return 0;
+    }
+
+    if (cache.dims != 3)
+    {
+        Mat m = cache.clone(cache.allocator);
+        if (m.empty())
+            return -100;
+
+        forked = m;
+        return 0;
+    }
+
+    // contiguous cache, copy the valid history and keep the reserved capacity
+    const int capacity = (int)(cache.cstep / cache.w);
+#if NCNN_BATCH
+    const int batch = cache.n;
+    Mat m;
+    m.create(cache.w, capacity, cache.c, cache.elemsize, cache.elempack, batch, cache.allocator);
+#else
+    const int batch = 1;
+    Mat m;
+    m.create(cache.w, capacity, cache.c, cache.elemsize, cache.elempack, cache.allocator);
+#endif
+    if (m.empty())
+        return -100;
+
+    m.h = cache.h;
+
+    const size_t valid_head_size = (size_t)cache.w * cache.h * cache.elemsize;
+    for (int b = 0; b < batch; b++)
+    {
+#if NCNN_BATCH
+        const Mat cache_b = cache.batch(b);
+        Mat m_b = m.batch(b);
+#else
+        const Mat& cache_b = cache;
+        Mat& m_b = m;
+#endif
+        for (int q = 0; q < cache.c; q++)
+        {
+            memcpy(m_b.channel(q), cache_b.channel(q), valid_head_size);
+        }
+    }
+
+    forked = m;
+
+    return 0;
+}
+
 #if NCNN_VULKAN
 #if NCNN_STRING
 int Extractor::input(const char* blob_name, const VkMat& in)
@@ -195,6 +195,14 @@ public:
     // set maximum kv cache sequence length hint
     void set_kvcache_max_seqlen_hint(int max_seqlen_hint);
 
+    // set paged kv cache memory allocator
+    // kv caches grow by fixed-size token blocks and never copy the past
+    void set_paged_kvcache_allocator(PagedKVCacheAllocator* allocator);
+
+    // set blob memory allocator with a static memory plan
+    // every extract runs on one pre-sized arena, repeated with the same input shapes it does not malloc
+    void set_blob_arena_allocator(BlobArenaAllocator* allocator);
+
 #if NCNN_VULKAN
     void set_blob_vkallocator(VkAllocator* allocator);
 
@@ -227,6 +235,12 @@ public:
     // type = 1, do not convert fp16/bf16 or / and packing, required for kv cache
     int extract(int blob_index, Mat& feat, int type = 0);
 
+    // fork an extracted kv cache for beam search or a shared prompt prefix
+    // the forked cache grows independently of the original one
+    // paged kv caches share the past blocks and copy on write
+    // return 0 if success
+    int fork_kvcache(const Mat& cache, Mat& forked) const;
+
 #if NCNN_VULKAN
 #if NCNN_STRING
     // set input by blob name
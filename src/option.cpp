@@ -19,6 +19,8 @@ Option::Option()
     workspace_allocator = 0;
     kvcache_allocator = 0;
     kvcache_max_seqlen_hint = 0;
+    kvcache_block_seqlen = 0;
+    use_int8_kvcache = false;
 
 #if NCNN_VULKAN
     blob_vkallocator = 0;
@@ -76,6 +78,16 @@ Option::Option()
     use_int16_packed = true;
     use_int16_storage = true;
     use_reserved_11 = false;
+
+    use_parallel_branch = false;
+
+    use_parallel_create_pipeline = false;
+
+    autotune_cache = 0;
+
+    weight_cache = 0;
+
+    numa_node = -1;
 }
 
 } // namespace ncnn
@@ -14,6 +14,8 @@ class PipelineCache;
 #endif // NCNN_VULKAN
 
 class Allocator;
+class AutotuneCache;
+class WeightCache;
 class NCNN_EXPORT Option
 {
 public:
@@ -49,6 +51,14 @@ public:
     // maximum kv cache sequence length hint
     int kvcache_max_seqlen_hint;
 
+    // tokens per kv cache block, 0 = contiguous kv cache
+    // kvcache_allocator must be a PagedKVCacheAllocator when enabled
+    int kvcache_block_seqlen;
+
+    // store new kv caches as int8 with one scale per token and head
+    // a past kv cache keeps its storage type, x86 SDPA only
+    bool use_int8_kvcache;
+
 #if NCNN_VULKAN
     // blob memory allocator
     VkAllocator* blob_vkallocator;
@@ -158,6 +168,33 @@ public:
     bool use_int16_packed;
     bool use_int16_storage;
     bool use_reserved_11;
+
+    // run independent graph branches concurrently, splitting num_threads between them
+    // blob_allocator and workspace_allocator must be thread-safe when enabled
+    // disabled by default
+    bool use_parallel_branch;
+
+    // run create_pipeline of loaded layers on worker threads during load_model
+    // overlaps weight transforms with reading the following weights, num_threads is split between them
+    // custom layers must have thread-safe create_pipeline when enabled
+    // disabled by default
+    bool use_parallel_create_pipeline;
+
+    // time candidate kernels per layer shape in create_pipeline and keep the fastest
+    // winners are recorded in the cache so later loads skip the measurement
+    // null by default, heuristic kernel selection
+    AutotuneCache* autotune_cache;
+
+    // reuse weights prepared by create_pipeline from a previous run
+    // layers record the prepared weights on miss, the cache can be saved and mapped on next startup
+    // null by default, weights are prepared on every load
+    WeightCache* weight_cache;
+
+    // bind the threads running load_model and extract on this numa node
+    // weights prepared by load_model are first touched and allocated on the node
+    // threads stay bound afterwards, run one net per node for multi-socket servers
+    // -1 by default, no binding
+    int numa_node;
 };
 
 } // namespace ncnn
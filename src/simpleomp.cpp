@@ -6,13 +6,18 @@
 #if NCNN_SIMPLEOMP
 
 #include "simpleomp.h"
-#include "cpu.h" // ncnn::get_cpu_count()
+#include "cpu.h"       // ncnn::get_cpu_count()
+#include "allocator.h" // NCNN_XADD
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
 #include <stdarg.h>
+#include <time.h>
+#if !defined _WIN32
+#include <sched.h>
+#endif
 
 #if __clang__
 extern "C" typedef void (*kmpc_micro)(int32_t* gtid, int32_t* tid, ...);
@@ -88,97 +93,114 @@ public:
     ConditionVariable* finish_condition;
 };
 
-class KMPTaskQueue
+class KMPTaskDeque
 {
 public:
-    KMPTaskQueue(int _max_size)
+    KMPTaskDeque()
     {
-        max_size = _max_size;
-        tasks = new KMPTask*[max_size];
-        size = 0;
+        capacity = 16;
+        tasks = new KMPTask*[capacity];
         front = 0;
-        back = 0;
+        size = 0;
     }
 
-    ~KMPTaskQueue()
+    ~KMPTaskDeque()
     {
         delete[] tasks;
     }
 
-    void dispatch(KMPTask* v, int n)
+    void push_back(KMPTask* v)
     {
         lock.lock();
-
-        if (size + n > max_size)
+        if (size == capacity)
         {
-            lock.unlock();
-
-            for (int i = 0; i < n; i++)
+            // grow ring buffer
+            KMPTask** new_tasks = new KMPTask*[capacity * 2];
+            for (int i = 0; i < size; i++)
             {
-                put(&v[i]);
+                new_tasks[i] = tasks[(front + i) & (capacity - 1)];
             }
-            return;
-        }
-
-        for (int i = 0; i < n; i++)
-        {
-            tasks[back] = &v[i];
-            back++;
-            if (back == max_size)
-                back = 0;
+            delete[] tasks;
+            tasks = new_tasks;
+            capacity = capacity * 2;
+            front = 0;
         }
-
-        size += n;
-
+        tasks[(front + size) & (capacity - 1)] = v;
+        size++;
         lock.unlock();
-
-        condition.signal();
     }
 
-    void put(KMPTask* v)
+    // owner side
+    bool pop_back(KMPTask*& v)
     {
+        if (size == 0)
+            return false;
+
         lock.lock();
-        while (size >= max_size)
+        if (size == 0)
         {
-            condition.wait(lock);
+            lock.unlock();
+            return false;
         }
-        tasks[back] = v;
-        back++;
-        if (back == max_size)
-            back = 0;
-        size++;
+        v = tasks[(front + size - 1) & (capacity - 1)];
+        size--;
         lock.unlock();
-
-        condition.signal();
+        return true;
     }
 
-    void get(KMPTask*& v)
+    // thief side
+    bool pop_front(KMPTask*& v)
     {
+        if (size == 0)
+            return false;
+
         lock.lock();
-        while (size == 0)
+        if (size == 0)
         {
-            condition.wait(lock);
+            lock.unlock();
+            return false;
         }
         v = tasks[front];
-        front++;
-        if (front == max_size)
-            front = 0;
+        front = (front + 1) & (capacity - 1);
         size--;
         lock.unlock();
+        return true;
+    }
 
-        condition.signal();
+    // take back one task forked by the given team, from either end
+    bool pop_team(const int* num_threads_to_wait, KMPTask*& v)
+    {
+        if (size == 0)
+            return false;
+
+        lock.lock();
+        if (size > 0 && tasks[(front + size - 1) & (capacity - 1)]->num_threads_to_wait == num_threads_to_wait)
+        {
+            v = tasks[(front + size - 1) & (capacity - 1)];
+            size--;
+            lock.unlock();
+            return true;
+        }
+        if (size > 0 && tasks[front]->num_threads_to_wait == num_threads_to_wait)
+        {
+            v = tasks[front];
+            front = (front + 1) & (capacity - 1);
+            size--;
+            lock.unlock();
+            return true;
+        }
+        lock.unlock();
+        return false;
     }
 
 private:
     Mutex lock;
-    ConditionVariable condition;
 
-    // ring buffer queue
-    int max_size;
+    // power of two ring buffer
     KMPTask** tasks;
-    int size;
+    int capacity;
     int front;
-    int back;
+    volatile int size;
 };
 
 class KMPGlobal
@@ -189,7 +211,11 @@ public:
         kmp_max_threads = 0;
         kmp_threads = 0;
         kmp_threads_tid = 0;
-        kmp_task_queue = 0;
+        kmp_task_deques = 0;
+        kmp_pending_tasks = 0;
+        kmp_dispatch_cursor = 0;
+        kmp_blocktime = 0;
+        kmp_sleepers = 0;
     }
 
     ~KMPGlobal()
@@ -210,10 +236,10 @@ public:
         // NCNN_LOGE("KMPGlobal init");
         kmp_max_threads = ncnn::get_cpu_count();
 
-        kmp_task_queue = new ncnn::KMPTaskQueue(std::max(kmp_max_threads * 4, 16));
-
         if (kmp_max_threads > 1)
         {
+            kmp_task_deques = new ncnn::KMPTaskDeque[kmp_max_threads - 1];
+
             kmp_threads = new ncnn::Thread*[kmp_max_threads - 1];
             kmp_threads_tid = new int[kmp_max_threads - 1];
             for (int i = 0; i < kmp_max_threads - 1; i++)
@@ -248,8 +274,8 @@ public:
                 tasks[i].finish_condition = 0;
             }
 
-            // dispatch 1 ~ kmp_max_threads
-            kmp_task_queue->dispatch(tasks, kmp_max_threads - 1);
+            // dispatch 1 ~ kmp_max_threads, one quit task per worker
+            dispatch(tasks, kmp_max_threads - 1);
 
             for (int i = 0; i < kmp_max_threads - 1; i++)
             {
@@ -263,16 +289,104 @@ public:
             }
             delete[] kmp_threads;
             delete[] kmp_threads_tid;
+
+            delete[] kmp_task_deques;
         }
+    }
 
-        delete kmp_task_queue;
+    // spread tasks over worker deques and wake up sleeping workers
+    void dispatch(KMPTask* v, int n)
+    {
+        // count pending before publishing so that no worker goes to sleep in between
+        NCNN_XADD(&kmp_pending_tasks, n);
+
+        const int num_deques = kmp_max_threads - 1;
+        const int cursor = NCNN_XADD(&kmp_dispatch_cursor, n);
+        for (int i = 0; i < n; i++)
+        {
+            int d = (int)((unsigned int)(cursor + i) % (unsigned int)num_deques);
+            kmp_task_deques[d].push_back(&v[i]);
+        }
+
+        sleep_lock.lock();
+        if (kmp_sleepers > 0)
+        {
+            if (n >= kmp_sleepers)
+            {
+                sleep_condition.broadcast();
+            }
+            else
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    sleep_condition.signal();
+                }
+            }
+        }
+        sleep_lock.unlock();
+    }
+
+    // worker tid takes from its own deque first, then steals from the others
+    bool get_task(int tid, KMPTask*& v)
+    {
+        const int num_deques = kmp_max_threads - 1;
+        const int self = tid - 1;
+
+        bool got = kmp_task_deques[self].pop_back(v);
+        for (int i = 1; !got && i < num_deques; i++)
+        {
+            got = kmp_task_deques[(self + i) % num_deques].pop_front(v);
+        }
+
+        if (got)
+        {
+            NCNN_XADD(&kmp_pending_tasks, -1);
+        }
+
+        return got;
+    }
+
+    // the forking thread helps with the tasks of its own team that no worker has picked up yet
+    bool get_team_task(const int* num_threads_to_wait, KMPTask*& v)
+    {
+        const int num_deques = kmp_max_threads - 1;
+
+        bool got = false;
+        for (int i = 0; !got && i < num_deques; i++)
+        {
+            got = kmp_task_deques[i].pop_team(num_threads_to_wait, v);
+        }
+
+        if (got)
+        {
+            NCNN_XADD(&kmp_pending_tasks, -1);
+        }
+
+        return got;
     }
 
 public:
     int kmp_max_threads;
     ncnn::Thread** kmp_threads;
     int* kmp_threads_tid;
-    ncnn::KMPTaskQueue* kmp_task_queue;
+
+    // per-worker task deques
+    ncnn::KMPTaskDeque* kmp_task_deques;
+    int kmp_pending_tasks;
+
+    int pending_tasks() const
+    {
+        return *(const volatile int*)&kmp_pending_tasks;
+    }
+
+    int kmp_dispatch_cursor;
+
+    // spin time in ms before idle threads go to sleep, 0 = passive
+    volatile int kmp_blocktime;
+
+    ncnn::Mutex sleep_lock;
+    ncnn::ConditionVariable sleep_condition;
+    int kmp_sleepers;
 };
 
 } // namespace ncnn
@@ -323,17 +437,74 @@ int omp_get_thread_num()
     return (int)reinterpret_cast<size_t>(tls_thread_num.get());
 }
 
-#if __clang__
 int kmp_get_blocktime()
 {
-    return 0;
+    return g_kmp_global.kmp_blocktime;
+}
+
+void kmp_set_blocktime(int blocktime)
+{
+    g_kmp_global.kmp_blocktime = std::max(blocktime, 0);
+}
+
+static uint64_t kmp_get_time_ms()
+{
+#if defined _WIN32
+    return (uint64_t)GetTickCount64();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+#endif
+}
+
+static inline void kmp_cpu_relax()
+{
+#if defined(__i386__) || defined(__x86_64__)
+    __asm__ __volatile__("pause");
+#elif defined(__aarch64__) || (defined(__arm__) && __ARM_ARCH >= 7)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+static inline void kmp_yield()
+{
+#if defined _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
 }
 
-void kmp_set_blocktime(int /*blocktime*/)
+// busy wait until cond returns true or blocktime elapsed
+// return true if cond met
+static bool kmp_spin_wait(bool (*cond)(const void*), const void* arg)
 {
-    // always passive, ignore
+    const int blocktime = g_kmp_global.kmp_blocktime;
+    if (blocktime == 0)
+        return cond(arg);
+
+    const uint64_t deadline = kmp_get_time_ms() + blocktime;
+    for (int i = 1;; i++)
+    {
+        if (cond(arg))
+            return true;
+
+        kmp_cpu_relax();
+
+        if (i % 64 == 0)
+        {
+            // query clock occasionally
+            if (kmp_get_time_ms() >= deadline)
+                return cond(arg);
+
+            // give way to the busy threads in case cpus are oversubscribed
+            kmp_yield();
+        }
+    }
 }
 
+#if __clang__
 static int kmp_invoke_microtask(kmpc_micro fn, int gtid, int tid, int argc, void** argv)
 {
     // fprintf(stderr, "__kmp_invoke_microtask %d %d %d\n", gtid, tid, argc);
@@ -445,43 +616,96 @@ static int kmp_invoke_microtask(kmpc_micro fn, int gtid, int tid, int argc, void
 }
 #endif // __clang__
 
-static void* kmp_threadfunc(void* args)
+static void kmp_run_task(ncnn::KMPTask* task, int tid)
 {
+    tls_num_threads.set(reinterpret_cast<void*>((size_t)task->num_threads));
+    tls_thread_num.set(reinterpret_cast<void*>((size_t)task->thread_num));
+
 #if __clang__
-    int tid = *(int*)args;
+    kmp_invoke_microtask(task->fn, task->thread_num, tid, task->argc, task->argv);
 #else
-    (void)args;
+    (void)tid;
+    task->fn(task->data);
 #endif
 
-    for (;;)
+    // update finished
     {
-        ncnn::KMPTask* task;
-        g_kmp_global.kmp_task_queue->get(task);
+        task->finish_lock->lock();
+        *task->num_threads_to_wait = *task->num_threads_to_wait - 1;
+        if (*task->num_threads_to_wait == 0)
+        {
+            task->finish_condition->signal();
+        }
+        task->finish_lock->unlock();
+    }
+}
 
-        // fprintf(stderr, "get %d\n", tid);
+static bool kmp_has_pending_tasks(const void* /*arg*/)
+{
+    return g_kmp_global.pending_tasks() > 0;
+}
 
-        if (!task->fn)
-            break;
+static bool kmp_team_finished(const void* arg)
+{
+    return *(const volatile int*)arg == 0;
+}
 
-        tls_num_threads.set(reinterpret_cast<void*>((size_t)task->num_threads));
-        tls_thread_num.set(reinterpret_cast<void*>((size_t)task->thread_num));
+// run the not yet started tasks of this team on the forking thread, then wait for the rest
+static void kmp_join_team(int num_threads, int* num_threads_to_wait, ncnn::Mutex& finish_lock, ncnn::ConditionVariable& finish_condition)
+{
+    ncnn::KMPTask* task;
+    while (g_kmp_global.get_team_task(num_threads_to_wait, task))
+    {
+        kmp_run_task(task, 0);
+    }
 
-#if __clang__
-        kmp_invoke_microtask(task->fn, task->thread_num, tid, task->argc, task->argv);
-#else
-        task->fn(task->data);
-#endif
+    // restore master thread context
+    tls_num_threads.set(reinterpret_cast<void*>((size_t)num_threads));
+    tls_thread_num.set(reinterpret_cast<void*>((size_t)0));
 
-        // update finished
+    kmp_spin_wait(kmp_team_finished, num_threads_to_wait);
+
+    // always synchronize with the last finisher before the team context goes away
+    {
+        finish_lock.lock();
+        while (*num_threads_to_wait != 0)
+        {
+            finish_condition.wait(finish_lock);
+        }
+        finish_lock.unlock();
+    }
+}
+
+static void* kmp_threadfunc(void* args)
+{
+    int tid = *(int*)args;
+
+    for (;;)
+    {
+        ncnn::KMPTask* task;
+        if (!g_kmp_global.get_task(tid, task))
         {
-            task->finish_lock->lock();
-            *task->num_threads_to_wait = *task->num_threads_to_wait - 1;
-            if (*task->num_threads_to_wait == 0)
+            // idle, spin for a while and then sleep until new tasks come
+            if (kmp_spin_wait(kmp_has_pending_tasks, 0))
+                continue;
+
+            g_kmp_global.sleep_lock.lock();
+            g_kmp_global.kmp_sleepers++;
+            while (g_kmp_global.pending_tasks() <= 0)
             {
-                task->finish_condition->signal();
+                g_kmp_global.sleep_condition.wait(g_kmp_global.sleep_lock);
             }
-            task->finish_lock->unlock();
+            g_kmp_global.kmp_sleepers--;
+            g_kmp_global.sleep_lock.unlock();
+            continue;
         }
+
+        // fprintf(stderr, "get %d\n", tid);
+
+        if (!task->fn)
+            break;
+
+        kmp_run_task(task, tid);
     }
 
     // fprintf(stderr, "exit\n");
@@ -549,7 +773,7 @@ void __kmpc_fork_call(void* /*loc*/, int32_t argc, kmpc_micro fn, ...)
     }
 
     // dispatch 1 ~ num_threads
-    g_kmp_global.kmp_task_queue->dispatch(tasks, num_threads - 1);
+    g_kmp_global.dispatch(tasks, num_threads - 1);
 
     // dispatch 0
     {
@@ -560,14 +784,7 @@ void __kmpc_fork_call(void* /*loc*/, int32_t argc, kmpc_micro fn, ...)
     }
 
     // wait for finished
-    {
-        finish_lock.lock();
-        if (num_threads_to_wait != 0)
-        {
-            finish_condition.wait(finish_lock);
-        }
-        finish_lock.unlock();
-    }
+    kmp_join_team(num_threads, &num_threads_to_wait, finish_lock, finish_condition);
 }
 
 void __kmpc_for_static_init_4(void* /*loc*/, int32_t gtid, int32_t /*sched*/, int32_t* last, int32_t* lower, int32_t* upper, int32_t* /*stride*/, int32_t /*incr*/, int32_t /*chunk*/)
@@ -645,6 +862,7 @@ static ncnn::ThreadLocalStorage tls_parallel_context;
 
 struct parallel_context
 {
+    int num_threads;
     int num_threads_to_wait;
     ncnn::Mutex finish_lock;
     ncnn::ConditionVariable finish_condition;
@@ -678,6 +896,7 @@ void GOMP_parallel_start(void (*fn)(void*), void* data, unsigned num_threads)
 
     tls_parallel_context.set(pc);
 
+    pc->num_threads = num_threads;
     pc->num_threads_to_wait = num_threads - 1;
 
     pc->tasks = new ncnn::KMPTask[num_threads - 1];
@@ -693,7 +912,7 @@ void GOMP_parallel_start(void (*fn)(void*), void* data, unsigned num_threads)
     }
 
     // dispatch 1 ~ num_threads
-    g_kmp_global.kmp_task_queue->dispatch(pc->tasks, num_threads - 1);
+    g_kmp_global.dispatch(pc->tasks, num_threads - 1);
 
     // dispatch 0
     {
@@ -708,15 +927,12 @@ void GOMP_parallel_end()
     parallel_context* pc = (parallel_context*)tls_parallel_context.get();
     tls_parallel_context.set(0);
 
+    // parallel_start ran serially
+    if (!pc)
+        return;
+
     // wait for finished
-    {
-        pc->finish_lock.lock();
-        if (pc->num_threads_to_wait != 0)
-        {
-            pc->finish_condition.wait(pc->finish_lock);
-        }
-        pc->finish_lock.unlock();
-    }
+    kmp_join_team(pc->num_threads, &pc->num_threads_to_wait, pc->finish_lock, pc->finish_condition);
 
     delete[] pc->tasks;
     delete pc;
@@ -763,7 +979,7 @@ void GOMP_parallel(void (*fn)(void*), void* data, unsigned num_threads, unsigned
     }
 
     // dispatch 1 ~ num_threads
-    g_kmp_global.kmp_task_queue->dispatch(tasks, num_threads - 1);
+    g_kmp_global.dispatch(tasks, num_threads - 1);
 
     // dispatch 0
     {
@@ -774,14 +990,7 @@ void GOMP_parallel(void (*fn)(void*), void* data, unsigned num_threads, unsigned
     }
 
     // wait for finished
-    {
-        finish_lock.lock();
-        if (num_threads_to_wait != 0)
-        {
-            finish_condition.wait(finish_lock);
-        }
-        finish_lock.unlock();
-    }
+    kmp_join_team(num_threads, &num_threads_to_wait, finish_lock, finish_condition);
 }
 #endif // __clang__
 
@@ -0,0 +1,589 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "weightcache.h"
+
+#include "autotunecache.h"
+
+#include <limits.h>
+#include <string.h>
+
+#if NCNN_STDIO
+#include <stdio.h>
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#endif
+
+namespace ncnn {
+
+#define NCNN_WEIGHT_CACHE_FILE_MAGIC   0x5457434e
+#define NCNN_WEIGHT_CACHE_FILE_VERSION 1
+#define NCNN_WEIGHT_CACHE_FILE_ENDIAN  0x12345678
+#define NCNN_WEIGHT_CACHE_DATA_ALIGN   64
+
+struct weight_cache_file_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t endian;
+    uint32_t pointer_size;
+    uint32_t entry_count;
+    uint64_t index_size;
+    char cpu_signature[224];
+};
+
+struct weight_cache_entry_header
+{
+    uint32_t key_size;
+    uint32_t mat_count;
+};
+
+struct weight_cache_mat_header
+{
+    int32_t dims;
+    int32_t w;
+    int32_t h;
+    int32_t d;
+    int32_t c;
+    int32_t elempack;
+    uint64_t elemsize;
+    uint64_t cstep;
+    uint64_t offset;
+};
+
+struct weight_cache_entry
+{
+    std::string key;
+    std::vector<Mat> weights;
+};
+
+class WeightCachePrivate
+{
+public:
+    void unmap_all();
+
+    mutable Mutex lock;
+    std::vector<weight_cache_entry> entries;
+    bool modified;
+
+    // mapped cache files, entries may reference any of them
+    std::vector<void*> mapped_data;
+    std::vector<size_t> mapped_size;
+};
+
+void WeightCachePrivate::unmap_all()
+{
+#if NCNN_STDIO
+    for (size_t i = 0; i < mapped_data.size(); i++)
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile(mapped_data[i]);
+#else
+        munmap(mapped_data[i], mapped_size[i]);
+#endif
+    }
+#endif // NCNN_STDIO
+
+    mapped_data.clear();
+    mapped_size.clear();
+}
+
+static size_t align_offset(size_t offset)
+{
+    return (offset + NCNN_WEIGHT_CACHE_DATA_ALIGN - 1) / NCNN_WEIGHT_CACHE_DATA_ALIGN * NCNN_WEIGHT_CACHE_DATA_ALIGN;
+}
+
+static size_t mat_data_size(const Mat& m)
+{
+    return m.cstep * m.c * m.elemsize;
+}
+
+static void append_data(std::vector<unsigned char>& data, const void* ptr, size_t size)
+{
+    if (size == 0)
+        return;
+
+    const unsigned char* p = (const unsigned char*)ptr;
+    data.insert(data.end(), p, p + size);
+}
+
+static Mat mat_from_header(const weight_cache_mat_header& mh, void* data)
+{
+    Mat m;
+    if (mh.dims == 1) m = Mat(mh.w, data, (size_t)mh.elemsize, mh.elempack);
+    if (mh.dims == 2) m = Mat(mh.w, mh.h, data, (size_t)mh.elemsize, mh.elempack);
+    if (mh.dims == 3) m = Mat(mh.w, mh.h, mh.c, data, (size_t)mh.elemsize, mh.elempack);
+    if (mh.dims == 4) m = Mat(mh.w, mh.h, mh.d, mh.c, data, (size_t)mh.elemsize, mh.elempack);
+
+    // keep the channel step of the stored layout
+    m.cstep = (size_t)mh.cstep;
+#if NCNN_BATCH
+    m.nstep = m.total();
+#endif
+
+    return m;
+}
+
+WeightCache::WeightCache()
+    : d(new WeightCachePrivate)
+{
+    d->modified = false;
+}
+
+WeightCache::~WeightCache()
+{
+    clear();
+
+    delete d;
+}
+
+WeightCache::WeightCache(const WeightCache&)
+    : d(0)
+{
+}
+
+WeightCache& WeightCache::operator=(const WeightCache&)
+{
+    return *this;
+}
+
+void WeightCache::clear()
+{
+    MutexLockGuard lock(d->lock);
+
+    d->entries.clear();
+    d->modified = false;
+
+    d->unmap_all();
+}
+
+size_t WeightCache::size() const
+{
+    MutexLockGuard lock(d->lock);
+
+    return d->entries.size();
+}
+
+bool WeightCache::modified() const
+{
+    MutexLockGuard lock(d->lock);
+
+    return d->modified;
+}
+
+int WeightCache::save_cache(std::vector<unsigned char>& data) const
+{
+    MutexLockGuard lock(d->lock);
+
+    // index first, the weight data follows at aligned offsets
+    std::vector<unsigned char> index;
+    std::vector<weight_cache_mat_header> mat_headers;
+    size_t index_size = 0;
+    for (size_t i = 0; i < d->entries.size(); i++)
+    {
+        const weight_cache_entry& e = d->entries[i];
+        index_size += sizeof(weight_cache_entry_header) + e.key.size() + e.weights.size() * sizeof(weight_cache_mat_header);
+    }
+
+    size_t offset = align_offset(sizeof(weight_cache_file_header) + index_size);
+    for (size_t i = 0; i < d->entries.size(); i++)
+    {
+        const weight_cache_entry& e = d->entries[i];
+
+        weight_cache_entry_header eh;
+        memset(&eh, 0, sizeof(eh));
+        eh.key_size = (uint32_t)e.key.size();
+        eh.mat_count = (uint32_t)e.weights.size();
+
+        append_data(index, &eh, sizeof(eh));
+        append_data(index, e.key.data(), e.key.size());
+
+        for (size_t j = 0; j < e.weights.size(); j++)
+        {
+            const Mat& m = e.weights[j];
+
+            weight_cache_mat_header mh;
+            memset(&mh, 0, sizeof(mh));
+            mh.dims = m.empty() ? 0 : m.dims;
+            mh.w = m.w;
+            mh.h = m.h;
+            mh.d = m.d;
+            mh.c = m.c;
+            mh.elempack = m.elempack;
+            mh.elemsize = m.elemsize;
+            mh.cstep = m.cstep;
+            mh.offset = m.empty() ? 0 : offset;
+
+            append_data(index, &mh, sizeof(mh));
+
+            if (!m.empty())
+                offset = align_offset(offset + mat_data_size(m));
+        }
+    }
+
+    weight_cache_file_header header;
+    memset(&header, 0, sizeof(header));
+    header.magic = NCNN_WEIGHT_CACHE_FILE_MAGIC;
+    header.version = NCNN_WEIGHT_CACHE_FILE_VERSION;
+    header.header_size = sizeof(header);
+    header.endian = NCNN_WEIGHT_CACHE_FILE_ENDIAN;
+    header.pointer_size = sizeof(void*);
+    header.entry_count = (uint32_t)d->entries.size();
+    header.index_size = index.size();
+    strncpy(header.cpu_signature, AutotuneCache::cpu_signature(), sizeof(header.cpu_signature) - 1);
+
+    data.clear();
+    data.reserve(offset);
+    append_data(data, &header, sizeof(header));
+    append_data(data, index.data(), index.size());
+
+    for (size_t i = 0; i < d->entries.size(); i++)
+    {
+        const weight_cache_entry& e = d->entries[i];
+        for (size_t j = 0; j < e.weights.size(); j++)
+        {
+            const Mat& m = e.weights[j];
+            if (m.empty())
+                continue;
+
+            data.resize(align_offset(data.size()), 0);
+            append_data(data, m.data, mat_data_size(m));
+        }
+    }
+    data.resize(align_offset(data.size()), 0);
+
+    d->modified = false;
+
+    return 0;
+}
+
+int WeightCache::load_cache(const unsigned char* data, size_t size)
+{
+    if (!data || size < sizeof(weight_cache_file_header))
+        return -1;
+
+    if ((size_t)data % NCNN_WEIGHT_CACHE_DATA_ALIGN != 0)
+    {
+        NCNN_LOGE("weight cache data must be %d byte aligned", NCNN_WEIGHT_CACHE_DATA_ALIGN);
+        return -1;
+    }
+
+    weight_cache_file_header header;
+    memcpy(&header, data, sizeof(header));
+
+    if (header.magic != NCNN_WEIGHT_CACHE_FILE_MAGIC || header.header_size != sizeof(header) || header.endian != NCNN_WEIGHT_CACHE_FILE_ENDIAN || header.pointer_size != sizeof(void*))
+    {
+        NCNN_LOGE("invalid weight cache file");
+        return -1;
+    }
+
+    if (header.version != NCNN_WEIGHT_CACHE_FILE_VERSION)
+    {
+        NCNN_LOGE("weight cache version %u mismatch, expect %d", header.version, NCNN_WEIGHT_CACHE_FILE_VERSION);
+        return -1;
+    }
+
+    header.cpu_signature[sizeof(header.cpu_signature) - 1] = '\0';
+    if (strncmp(header.cpu_signature, AutotuneCache::cpu_signature(), sizeof(header.cpu_signature) - 1) != 0)
+    {
+        // weights were prepared for another isa or cache size, prepare again
+        NCNN_LOGE("weight cache was built on %s, skipped", header.cpu_signature);
+        return -1;
+    }
+
+    if (header.index_size > size - sizeof(header))
+        return -1;
+
+    std::vector<weight_cache_entry> entries(header.entry_count);
+
+    const unsigned char* p = data + sizeof(header);
+    const unsigned char* index_end = p + header.index_size;
+    for (uint32_t i = 0; i < header.entry_count; i++)
+    {
+        weight_cache_entry_header eh;
+        if (p + sizeof(eh) > index_end)
+            return -1;
+        memcpy(&eh, p, sizeof(eh));
+        p += sizeof(eh);
+
+        if (eh.key_size > (size_t)(index_end - p))
+            return -1;
+
+        weight_cache_entry& e = entries[i];
+        e.key = std::string((const char*)p, eh.key_size);
+        p += eh.key_size;
+
+        if (eh.mat_count > (size_t)(index_end - p) / sizeof(weight_cache_mat_header))
+            return -1;
+
+        e.weights.resize(eh.mat_count);
+        for (uint32_t j = 0; j < eh.mat_count; j++)
+        {
+            weight_cache_mat_header mh;
+            memcpy(&mh, p, sizeof(mh));
+            p += sizeof(mh);
+
+            if (mh.dims == 0)
+                continue;
+
+            if (mh.dims < 1 || mh.dims > 4 || mh.w <= 0 || mh.h <= 0 || mh.d <= 0 || mh.c <= 0 || mh.elemsize == 0 || mh.elempack <= 0)
+                return -1;
+
+            const uint64_t mat_size = mh.cstep * mh.c * mh.elemsize;
+            if (mh.offset % NCNN_WEIGHT_CACHE_DATA_ALIGN != 0 || mh.offset > size || mat_size > size - mh.offset)
+                return -1;
+
+            e.weights[j] = mat_from_header(mh, (void*)(data + mh.offset));
+        }
+    }
+
+    MutexLockGuard lock(d->lock);
+
+    d->entries = entries;
+    d->modified = false;
+
+    return 0;
+}
+
+#if NCNN_STDIO
+static Mutex g_tmp_path_lock;
+static unsigned int g_tmp_path_index = 0;
+
+int WeightCache::save_cache(const char* path) const
+{
+    if (!path)
+        return -1;
+
+    std::vector<unsigned char> data;
+    int ret = save_cache(data);
+    if (ret != 0)
+        return ret;
+
+    char tmp_path_suffix[64];
+    {
+        MutexLockGuard lock(g_tmp_path_lock);
+#if defined(_WIN32)
+        snprintf(tmp_path_suffix, sizeof(tmp_path_suffix), ".tmp.%u.%u", (unsigned int)_getpid(), ++g_tmp_path_index);
+#else
+        snprintf(tmp_path_suffix, sizeof(tmp_path_suffix), ".tmp.%u.%u", (unsigned int)getpid(), ++g_tmp_path_index);
+#endif
+    }
+    const std::string tmp_path = std::string(path) + tmp_path_suffix;
+
+    FILE* fp = fopen(tmp_path.c_str(), "wb");
+    if (!fp)
+    {
+        NCNN_LOGE("fopen %s failed", tmp_path.c_str());
+        return -1;
+    }
+
+    if (fwrite(data.data(), 1, data.size(), fp) != data.size())
+    {
+        fclose(fp);
+        remove(tmp_path.c_str());
+        return -1;
+    }
+
+    if (fclose(fp) != 0)
+    {
+        remove(tmp_path.c_str());
+        return -1;
+    }
+
+    // the old file may still be mapped by this or other processes, replace the name only
+#if defined(_WIN32)
+    ret = MoveFileExA(tmp_path.c_str(), path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) ? 0 : -1;
+#else
+    ret = rename(tmp_path.c_str(), path);
+#endif
+    if (ret != 0)
+    {
+        NCNN_LOGE("replace %s failed", path);
+        remove(tmp_path.c_str());
+        return -1;
+    }
+
+    return 0;
+}
+
+int WeightCache::load_cache(const char* path)
+{
+    if (!path)
+        return -1;
+
+    void* ptr = 0;
+    size_t size = 0;
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return -1;
+
+    LARGE_INTEGER file_size;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+    {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping)
+        {
+            ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            size = (size_t)file_size.QuadPart;
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        ptr = mmap(0, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (ptr == MAP_FAILED)
+            ptr = 0;
+        size = (size_t)st.st_size;
+    }
+    close(fd);
+#endif
+
+    if (!ptr)
+    {
+        NCNN_LOGE("map %s failed", path);
+        return -1;
+    }
+
+    int ret = load_cache((const unsigned char*)ptr, size);
+    if (ret != 0)
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile(ptr);
+#else
+        munmap(ptr, size);
+#endif
+        return ret;
+    }
+
+    MutexLockGuard lock(d->lock);
+
+    d->mapped_data.push_back(ptr);
+    d->mapped_size.push_back(size);
+
+    return 0;
+}
+#endif // NCNN_STDIO
+
+int WeightCache::query(const char* key, std::vector<Mat>& weights) const
+{
+    MutexLockGuard lock(d->lock);
+
+    for (size_t i = 0; i < d->entries.size(); i++)
+    {
+        const weight_cache_entry& e = d->entries[i];
+        if (e.key != key)
+            continue;
+
+        weights = e.weights;
+        return 0;
+    }
+
+    return -1;
+}
+
+void WeightCache::update(const char* key, const std::vector<Mat>& weights)
+{
+    MutexLockGuard lock(d->lock);
+
+    weight_cache_entry* e = 0;
+    for (size_t i = 0; i < d->entries.size(); i++)
+    {
+        if (d->entries[i].key == key)
+        {
+            e = &d->entries[i];
+            break;
+        }
+    }
+
+    if (!e)
+    {
+        d->entries.push_back(weight_cache_entry());
+        e = &d->entries.back();
+        e->key = key;
+    }
+
+    e->weights = weights;
+
+    d->modified = true;
+}
+
+uint64_t WeightCache::fingerprint(const Mat& m, uint64_t seed)
+{
+    // https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function#FNV-1a_hash
+    // on 64bit words, fast enough to hash every raw weight at load time
+    uint64_t h = seed ^ 0xcbf29ce484222325ULL;
+
+    const int shape[6] = {m.dims, m.w, m.h, m.d, m.c, (int)m.elemsize};
+    for (int i = 0; i < 6; i++)
+    {
+        h ^= (uint64_t)(uint32_t)shape[i];
+        h *= 0x100000001b3ULL;
+    }
+
+    if (m.empty())
+        return h;
+
+    // skip the channel padding
+    const size_t channel_size = (size_t)m.w * m.h * m.d * m.elemsize;
+    for (int q = 0; q < m.c; q++)
+    {
+        const unsigned char* ptr = (const unsigned char*)m.data + m.cstep * m.elemsize * q;
+
+        size_t i = 0;
+        for (; i + 7 < channel_size; i += 8)
+        {
+            uint64_t v;
+            memcpy(&v, ptr + i, 8);
+            h ^= v;
+            h *= 0x100000001b3ULL;
+        }
+        for (; i < channel_size; i++)
+        {
+            h ^= ptr[i];
+            h *= 0x100000001b3ULL;
+        }
+    }
+
+    return h;
+}
+
+unsigned int WeightCache::option_flags(const Option& opt)
+{
+    unsigned int flags = 0;
+    flags |= opt.use_packing_layout << 0;
+    flags |= opt.use_winograd_convolution << 1;
+    flags |= opt.use_winograd23_convolution << 2;
+    flags |= opt.use_winograd43_convolution << 3;
+    flags |= opt.use_winograd63_convolution << 4;
+    flags |= opt.use_sgemm_convolution << 5;
+    flags |= opt.use_int8_inference << 6;
+    flags |= opt.use_int8_packed << 7;
+    flags |= opt.use_int8_storage << 8;
+    flags |= opt.use_int8_arithmetic << 9;
+    flags |= opt.use_fp16_packed << 10;
+    flags |= opt.use_fp16_storage << 11;
+    flags |= opt.use_fp16_arithmetic << 12;
+    flags |= opt.use_bf16_packed << 13;
+    flags |= opt.use_bf16_storage << 14;
+    flags |= (opt.autotune_cache != 0) << 15;
+
+    return flags;
+}
+
+} // namespace ncnn
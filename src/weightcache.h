@@ -0,0 +1,66 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef NCNN_WEIGHTCACHE_H
+#define NCNN_WEIGHTCACHE_H
+
+#include "platform.h"
+
+#include "mat.h"
+#include "option.h"
+
+namespace ncnn {
+
+// weights prepared by create_pipeline, like packed, winograd transformed or int8 repacked kernels
+// layers consult it when Option::weight_cache is set, a hit skips the weight transform
+// the cache file is mapped into memory, weights reference the mapped pages and are shared between processes
+// the cache must outlive the nets using it
+class WeightCachePrivate;
+class NCNN_EXPORT WeightCache
+{
+public:
+    WeightCache();
+
+    virtual ~WeightCache();
+
+    void clear();
+    size_t size() const;
+
+    // true when layers recorded new weights since the last load or save
+    bool modified() const;
+
+    // data must stay valid while the cache is used, entries reference it without copy
+    // data is 64 byte aligned for direct use by simd kernels
+    int save_cache(std::vector<unsigned char>& data) const;
+    int load_cache(const unsigned char* data, size_t size);
+
+#if NCNN_STDIO
+    // the file is written to a temporary path and renamed, so a mapped file stays intact
+    int save_cache(const char* path) const;
+    // map the file, entries built for another cpu are skipped
+    int load_cache(const char* path);
+#endif // NCNN_STDIO
+
+    // return 0 and fill weights when key has been recorded, -1 otherwise
+    int query(const char* key, std::vector<Mat>& weights) const;
+
+    // record the prepared weights for key
+    void update(const char* key, const std::vector<Mat>& weights);
+
+    // hash of shape and content, layers put the fingerprint of raw weights and params into the key
+    static uint64_t fingerprint(const Mat& m, uint64_t seed = 0);
+
+    // option bits that change how layers prepare weights
+    static unsigned int option_flags(const Option& opt);
+
+private:
+    WeightCache(const WeightCache&);
+    WeightCache& operator=(const WeightCache&);
+
+private:
+    WeightCachePrivate* const d;
+};
+
+} // namespace ncnn
+
+#endif // NCNN_WEIGHTCACHE_H
@@ -0,0 +1,47 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "perfutil.h"
+
+// block quantized constant B, the decode shape of llm projections
+static void perf_gemm_wq(int M, int N, int K, int bits, int block_size)
+{
+    const int block_count = (K + block_size - 1) / block_size;
+    const int packed_k_bytes = (K * bits + 7) / 8;
+    const int block_size_code = block_size == 32 ? 0 : block_size == 64 ? 1 : 2;
+
+    ncnn::ParamDict pd;
+    pd.set(2, 0);  // transA
+    pd.set(3, 1);  // transB
+    pd.set(4, 0);  // constantA
+    pd.set(5, 1);  // constantB
+    pd.set(6, 0);  // constantC
+    pd.set(7, M);
+    pd.set(8, N);
+    pd.set(9, K);
+    pd.set(10, -1); // broadcast_type_C
+    pd.set(18, bits * 100 + block_size_code);
+
+    std::vector<ncnn::Mat> weights(2);
+    weights[0].create(packed_k_bytes * N, (size_t)1u);
+    unsigned char* p = weights[0];
+    for (int i = 0; i < packed_k_bytes * N; i++)
+    {
+        p[i] = (unsigned char)(i * 37 + 11);
+    }
+    weights[1] = PerfMat(block_count * N, 64.f);
+
+    perf_layer("Gemm", pd, weights, PerfMat(K, M), "M=%d N=%d K=%d bits=%d block=%d", M, N, K, bits, block_size);
+}
+
+int main()
+{
+    perf_gemm_wq(1, 4096, 4096, 4, 32);
+    perf_gemm_wq(1, 4096, 4096, 6, 32);
+    perf_gemm_wq(1, 4096, 4096, 8, 32);
+    perf_gemm_wq(1, 11008, 4096, 4, 128);
+    perf_gemm_wq(16, 4096, 4096, 4, 64);
+    perf_gemm_wq(16, 4096, 4096, 8, 64);
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "perfutil.h"
+
+static void perf_gru(int T, int size, int num_output, int direction)
+{
+    const int num_directions = direction == 2 ? 2 : 1;
+
+    ncnn::ParamDict pd;
+    pd.set(0, num_output);
+    pd.set(1, num_output * size * 3 * num_directions);
+    pd.set(2, direction);
+
+    std::vector<ncnn::Mat> weights(3);
+    weights[0] = PerfMat(size, num_output * 3, num_directions);
+    weights[1] = PerfMat(num_output, 4, num_directions);
+    weights[2] = PerfMat(num_output, num_output * 3, num_directions);
+
+    perf_layer("GRU", pd, weights, PerfMat(size, T), "T=%d size=%d num_output=%d direction=%d", T, size, num_output, direction);
+}
+
+static void perf_rnn(int T, int size, int num_output, int direction)
+{
+    const int num_directions = direction == 2 ? 2 : 1;
+
+    ncnn::ParamDict pd;
+    pd.set(0, num_output);
+    pd.set(1, num_output * size * num_directions);
+    pd.set(2, direction);
+
+    std::vector<ncnn::Mat> weights(3);
+    weights[0] = PerfMat(size, num_output, num_directions);
+    weights[1] = PerfMat(num_output, 1, num_directions);
+    weights[2] = PerfMat(num_output, num_output, num_directions);
+
+    perf_layer("RNN", pd, weights, PerfMat(size, T), "T=%d size=%d num_output=%d direction=%d", T, size, num_output, direction);
+}
+
+int main()
+{
+    // streaming speech
+    perf_gru(100, 80, 256, 0);
+    perf_gru(100, 256, 256, 2);
+    perf_gru(500, 64, 128, 0);
+
+    perf_rnn(100, 80, 256, 0);
+    perf_rnn(500, 64, 128, 2);
+
+    return 0;
+}
@@ -0,0 +1,260 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "perfutil.h"
+
+#include "benchmark.h"
+
+#include <stdio.h>
+#include <vector>
+
+#define WARMUP_COUNT 3
+#define RUN_COUNT    20
+
+// one preprocessing call on fixed buffers
+class PixelFunc
+{
+public:
+    virtual ~PixelFunc()
+    {
+    }
+
+    virtual void run() = 0;
+};
+
+static void perf_pixel(PixelFunc& func, const char* name, int w, int h)
+{
+    for (int i = 0; i < WARMUP_COUNT; i++)
+    {
+        func.run();
+    }
+
+    double times[RUN_COUNT];
+    double time_avg = 0.0;
+    for (int i = 0; i < RUN_COUNT; i++)
+    {
+        double start = ncnn::get_current_time();
+        func.run();
+        double end = ncnn::get_current_time();
+
+        times[i] = end - start;
+        time_avg += times[i];
+    }
+
+    for (int i = 1; i < RUN_COUNT; i++)
+    {
+        double key = times[i];
+        int j = i - 1;
+        while (j >= 0 && times[j] > key)
+        {
+            times[j + 1] = times[j];
+            j--;
+        }
+        times[j + 1] = key;
+    }
+    time_avg /= RUN_COUNT;
+
+    char tag[128];
+    snprintf(tag, sizeof(tag), "%-24s %dx%d", name, w, h);
+    fprintf(stdout, "%-72s  min = %8.2f  max = %8.2f  avg = %8.2f  median = %8.2f\n", tag, times[0], times[RUN_COUNT - 1], time_avg, times[RUN_COUNT / 2]);
+}
+
+static void fill_pixels(std::vector<unsigned char>& pixels)
+{
+    for (size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = (unsigned char)(i * 37 + (i >> 8) * 11);
+    }
+}
+
+class FromPixels : public PixelFunc
+{
+public:
+    FromPixels(int _type, int _channels, int _w, int _h)
+        : type(_type), w(_w), h(_h), pixels(_w * _h * _channels)
+    {
+        fill_pixels(pixels);
+    }
+
+    virtual void run()
+    {
+        m = ncnn::Mat::from_pixels(&pixels[0], type, w, h);
+    }
+
+    int type;
+    int w;
+    int h;
+    std::vector<unsigned char> pixels;
+    ncnn::Mat m;
+};
+
+class ToPixels : public PixelFunc
+{
+public:
+    ToPixels(int _type, int _channels, int _outchannels, int _w, int _h)
+        : type(_type), m(PerfMat(_w, _h, _channels, 100.f)), pixels(_w * _h * _outchannels)
+    {
+    }
+
+    virtual void run()
+    {
+        m.to_pixels(&pixels[0], type);
+    }
+
+    int type;
+    ncnn::Mat m;
+    std::vector<unsigned char> pixels;
+};
+
+class Yuv420sp2rgb : public PixelFunc
+{
+public:
+    Yuv420sp2rgb(int _w, int _h)
+        : w(_w), h(_h), yuv(_w * _h * 3 / 2), rgb(_w * _h * 3)
+    {
+        fill_pixels(yuv);
+    }
+
+    virtual void run()
+    {
+        ncnn::yuv420sp2rgb(&yuv[0], w, h, &rgb[0]);
+    }
+
+    int w;
+    int h;
+    std::vector<unsigned char> yuv;
+    std::vector<unsigned char> rgb;
+};
+
+class WarpaffineBilinear : public PixelFunc
+{
+public:
+    WarpaffineBilinear(int _channels, int _srcw, int _srch, int _w, int _h)
+        : channels(_channels), srcw(_srcw), srch(_srch), w(_w), h(_h), src(_srcw * _srch * _channels), dst(_w * _h * _channels)
+    {
+        fill_pixels(src);
+
+        // mild rotation and scale, like face alignment
+        ncnn::get_rotation_matrix(15.f, (float)w / srcw, srcw * 0.5f, srch * 0.5f, tm);
+        tm[2] -= (srcw - w) * 0.5f;
+        tm[5] -= (srch - h) * 0.5f;
+        ncnn::invert_affine_transform(tm, tm_inv);
+    }
+
+    virtual void run()
+    {
+        if (channels == 3)
+            ncnn::warpaffine_bilinear_c3(&src[0], srcw, srch, &dst[0], w, h, tm_inv);
+        else
+            ncnn::warpaffine_bilinear_c4(&src[0], srcw, srch, &dst[0], w, h, tm_inv);
+    }
+
+    int channels;
+    int srcw;
+    int srch;
+    int w;
+    int h;
+    std::vector<unsigned char> src;
+    std::vector<unsigned char> dst;
+    float tm[6];
+    float tm_inv[6];
+};
+
+class KannaRotate : public PixelFunc
+{
+public:
+    KannaRotate(int _channels, int _srcw, int _srch, int _type)
+        : channels(_channels), srcw(_srcw), srch(_srch), type(_type), src(_srcw * _srch * _channels), dst(_srcw * _srch * _channels)
+    {
+        fill_pixels(src);
+
+        w = type > 4 ? srch : srcw;
+        h = type > 4 ? srcw : srch;
+    }
+
+    virtual void run()
+    {
+        if (channels == 3)
+            ncnn::kanna_rotate_c3(&src[0], srcw, srch, &dst[0], w, h, type);
+        else
+            ncnn::kanna_rotate_c4(&src[0], srcw, srch, &dst[0], w, h, type);
+    }
+
+    int channels;
+    int srcw;
+    int srch;
+    int type;
+    int w;
+    int h;
+    std::vector<unsigned char> src;
+    std::vector<unsigned char> dst;
+};
+
+int main()
+{
+    const int w = 1280;
+    const int h = 720;
+
+    {
+        FromPixels f(ncnn::Mat::PIXEL_RGB, 3, w, h);
+        perf_pixel(f, "from_pixels rgb", w, h);
+    }
+    {
+        FromPixels f(ncnn::Mat::PIXEL_BGR2RGB, 3, w, h);
+        perf_pixel(f, "from_pixels bgr2rgb", w, h);
+    }
+    {
+        FromPixels f(ncnn::Mat::PIXEL_RGBA2RGB, 4, w, h);
+        perf_pixel(f, "from_pixels rgba2rgb", w, h);
+    }
+    {
+        FromPixels f(ncnn::Mat::PIXEL_BGR2GRAY, 3, w, h);
+        perf_pixel(f, "from_pixels bgr2gray", w, h);
+    }
+    {
+        FromPixels f(ncnn::Mat::PIXEL_GRAY, 1, w, h);
+        perf_pixel(f, "from_pixels gray", w, h);
+    }
+    {
+        ToPixels f(ncnn::Mat::PIXEL_RGB, 3, 3, w, h);
+        perf_pixel(f, "to_pixels rgb", w, h);
+    }
+    {
+        ToPixels f(ncnn::Mat::PIXEL_RGB2BGR, 3, 3, w, h);
+        perf_pixel(f, "to_pixels rgb2bgr", w, h);
+    }
+    {
+        ToPixels f(ncnn::Mat::PIXEL_RGB2RGBA, 3, 4, w, h);
+        perf_pixel(f, "to_pixels rgb2rgba", w, h);
+    }
+    {
+        Yuv420sp2rgb f(w, h);
+        perf_pixel(f, "yuv420sp2rgb", w, h);
+    }
+    {
+        WarpaffineBilinear f(3, w, h, 640, 640);
+        perf_pixel(f, "warpaffine_bilinear_c3", 640, 640);
+    }
+    {
+        WarpaffineBilinear f(4, w, h, 640, 640);
+        perf_pixel(f, "warpaffine_bilinear_c4", 640, 640);
+    }
+    {
+        KannaRotate f(3, w, h, 2);
+        perf_pixel(f, "kanna_rotate_c3 type=2", w, h);
+    }
+    {
+        KannaRotate f(3, w, h, 6);
+        perf_pixel(f, "kanna_rotate_c3 type=6", w, h);
+    }
+    {
+        KannaRotate f(3, w, h, 8);
+        perf_pixel(f, "kanna_rotate_c3 type=8", w, h);
+    }
+    {
+        KannaRotate f(4, w, h, 6);
+        perf_pixel(f, "kanna_rotate_c4 type=6", w, h);
+    }
+
+    return 0;
+}
@@ -4,7 +4,7 @@
 #include "perfutil.h"
 
 // decode phase: src_seqlen=1, with kv_cache and various past_seqlen
-static void perf_sdpa_decode(int embed_dim, int num_heads, int num_groups, int past_seqlen)
+static void perf_sdpa_decode(int embed_dim, int num_heads, int num_groups, int past_seqlen, int int8_scale_term = 0)
 {
     const int src_seqlen = 1;
     const int cur_seqlen = 1;
@@ -15,6 +15,7 @@ static void perf_sdpa_decode(int embed_dim, int num_heads, int num_groups, int p
     pd.set(5, 0);   // attn_mask = 0
     pd.set(6, 0.f); // scale = 0 (default 1/sqrt(embed_dim))
     pd.set(7, 1);   // kv_cache = 1
+    pd.set(18, int8_scale_term);
 
     std::vector<ncnn::Mat> weights(0);
 
@@ -27,8 +28,8 @@ static void perf_sdpa_decode(int embed_dim, int num_heads, int num_groups, int p
     inputs[4] = PerfMat(out_embed_dim, past_seqlen, num_groups); // past_v
 
     perf_layer("SDPA", pd, weights, inputs, 3,
-               "embed=%d heads=%d groups=%d past=%d",
-               embed_dim, num_heads, num_groups, past_seqlen);
+               "embed=%d heads=%d groups=%d past=%d%s",
+               embed_dim, num_heads, num_groups, past_seqlen, int8_scale_term ? " int8" : "");
 }
 
 int main()
@@ -80,5 +81,14 @@ int main()
     perf_sdpa_decode(4096, 32, 4, 16384);
     perf_sdpa_decode(4096, 32, 4, 32768);
 
+#if NCNN_INT8
+    // dynamic quantized attention, per-token cost of the gemm path
+    perf_sdpa_decode(128, 4, 4, 0, 2);
+    perf_sdpa_decode(128, 4, 4, 128, 2);
+    perf_sdpa_decode(512, 8, 8, 128, 2);
+    perf_sdpa_decode(4096, 32, 32, 128, 2);
+    perf_sdpa_decode(4096, 32, 4, 512, 2);
+#endif // NCNN_INT8
+
     return 0;
 }
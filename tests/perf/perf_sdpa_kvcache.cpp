@@ -41,6 +41,7 @@ struct SessionResult
     double time;
     int relocation_count;
     int allocation_count;
+    size_t kvcache_size;
 };
 
 static void print_session_result(const char* device, const char* cache_type, int embed_dim, int num_heads, int num_groups, int prefill_seqlen, int decode_steps, const SessionResult* results)
@@ -74,6 +75,8 @@ static void print_session_result(const char* device, const char* cache_type, int
     if (results[SESSION_RUN_COUNT - 1].allocation_count >= 0)
         fprintf(stdout, "  kvcache_alloc=%d", results[SESSION_RUN_COUNT - 1].allocation_count);
 
+    fprintf(stdout, "  kvcache=%.1fKB", results[SESSION_RUN_COUNT - 1].kvcache_size / 1024.0);
+
     fprintf(stdout, "\n");
 }
 
@@ -131,6 +134,7 @@ static int run_sdpa_cpu_session(ncnn::Layer* op, const ncnn::Option& opt, KVCach
         bottom_blobs[4].release();
     }
     result.time = ncnn::get_current_time() - time_start;
+    result.kvcache_size = (key_cache.cstep * key_cache.c + value_cache.cstep * value_cache.c) * key_cache.elemsize;
     result.allocation_count = opt.kvcache_allocator ? allocator.allocation_count - allocation_count : -1;
 
     key_cache.release();
@@ -139,13 +143,14 @@ static int run_sdpa_cpu_session(ncnn::Layer* op, const ncnn::Option& opt, KVCach
     return 0;
 }
 
-static void perf_sdpa_kvcache_cpu(int embed_dim, int num_heads, int num_groups, int prefill_seqlen, int decode_steps, int max_seqlen_hint)
+static void perf_sdpa_kvcache_cpu(int embed_dim, int num_heads, int num_groups, int prefill_seqlen, int decode_steps, int max_seqlen_hint, bool int8_kvcache = false)
 {
     KVCachePerfAllocator allocator;
 
     ncnn::Option opt;
     opt.kvcache_allocator = max_seqlen_hint >= 0 ? &allocator : 0;
     opt.kvcache_max_seqlen_hint = max_seqlen_hint > 0 ? max_seqlen_hint : 0;
+    opt.use_int8_kvcache = int8_kvcache;
 
     ncnn::Layer* op = ncnn::create_layer_cpu("SDPA");
     if (!op)
@@ -180,6 +185,8 @@ static void perf_sdpa_kvcache_cpu(int embed_dim, int num_heads, int num_groups,
         const char* cache_type = "legacy";
         if (opt.kvcache_allocator)
             cache_type = max_seqlen_hint > 0 ? "allocator-hint" : "allocator";
+        if (int8_kvcache)
+            cache_type = "int8-hint";
         print_session_result("cpu", cache_type, embed_dim, num_heads, num_groups, prefill_seqlen, decode_steps, results);
     }
 
@@ -194,6 +201,7 @@ static void perf_sdpa_kvcache(int embed_dim, int num_heads, int num_groups, int
     perf_sdpa_kvcache_cpu(embed_dim, num_heads, num_groups, prefill_seqlen, decode_steps, -1);
     perf_sdpa_kvcache_cpu(embed_dim, num_heads, num_groups, prefill_seqlen, decode_steps, 0);
     perf_sdpa_kvcache_cpu(embed_dim, num_heads, num_groups, prefill_seqlen, decode_steps, max_seqlen_hint);
+    perf_sdpa_kvcache_cpu(embed_dim, num_heads, num_groups, prefill_seqlen, decode_steps, max_seqlen_hint, true);
 }
 
 int main()
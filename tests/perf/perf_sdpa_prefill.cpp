@@ -3,6 +3,96 @@
 
 #include "perfutil.h"
 
+#include "modelbin.h"
+
+#include <stdio.h>
+
+class WorkspacePeakAllocator : public ncnn::Allocator
+{
+public:
+    WorkspacePeakAllocator()
+        : current_size(0), peak_size(0)
+    {
+    }
+
+    virtual void* fastMalloc(size_t size)
+    {
+        // stash the size in front of the payload so that fastFree can account for it
+        unsigned char* ptr = (unsigned char*)ncnn::fastMalloc(size + NCNN_MALLOC_ALIGN);
+        if (!ptr)
+            return 0;
+
+        *(size_t*)ptr = size;
+
+        current_size += size;
+        if (current_size > peak_size)
+            peak_size = current_size;
+
+        return ptr + NCNN_MALLOC_ALIGN;
+    }
+
+    virtual void fastFree(void* ptr)
+    {
+        unsigned char* p = (unsigned char*)ptr - NCNN_MALLOC_ALIGN;
+        current_size -= *(size_t*)p;
+        ncnn::fastFree(p);
+    }
+
+    size_t current_size;
+    size_t peak_size;
+};
+
+// peak workspace of one fp32 forward, compared with the qk_cross score matrix a non-streaming path would hold
+static void perf_sdpa_prefill_memory(int embed_dim, int num_heads, int num_groups, int src_seqlen)
+{
+    ncnn::ParamDict pd;
+    pd.set(5, 0);
+    pd.set(6, 0.f);
+    pd.set(7, 0);
+
+    ncnn::Layer* op = ncnn::create_layer_cpu("SDPA");
+    if (!op)
+        return;
+
+    op->load_param(pd);
+
+    std::vector<ncnn::Mat> weights(0);
+    ncnn::ModelBinFromMatArray mb(weights.data());
+    op->load_model(mb);
+
+    WorkspacePeakAllocator workspace_allocator;
+
+    ncnn::Option opt;
+    opt.num_threads = 1;
+    opt.use_packing_layout = true;
+    opt.use_bf16_storage = false;
+    opt.use_fp16_storage = false;
+    opt.workspace_allocator = &workspace_allocator;
+
+    op->create_pipeline(opt);
+
+    std::vector<ncnn::Mat> bottom_blobs(3);
+    bottom_blobs[0] = PerfMat(embed_dim, src_seqlen, num_heads);
+    bottom_blobs[1] = PerfMat(embed_dim, src_seqlen, num_groups);
+    bottom_blobs[2] = PerfMat(embed_dim, src_seqlen, num_groups);
+
+    std::vector<ncnn::Mat> top_blobs(1);
+    int ret = op->forward(bottom_blobs, top_blobs, opt);
+
+    op->destroy_pipeline(opt);
+    delete op;
+
+    if (ret != 0)
+        return;
+
+    const double qk_cross_size = (double)src_seqlen * src_seqlen * num_heads * sizeof(float);
+
+    fprintf(stdout, "SDPA workspace  embed=%d heads=%d groups=%d seqlen=%d  peak = %10.3f MB  qk_cross = %10.3f MB\n",
+            embed_dim, num_heads, num_groups, src_seqlen,
+            workspace_allocator.peak_size / 1024.0 / 1024.0, qk_cross_size / 1024.0 / 1024.0);
+    fflush(stdout);
+}
+
 // prefill phase: larger src_seqlen, no kv_cache (past_seqlen=0)
 static void perf_sdpa_prefill(int embed_dim, int num_heads, int num_groups, int src_seqlen)
 {
@@ -85,5 +175,13 @@ int main()
     perf_sdpa_prefill(4096, 32, 4, 16384);
     perf_sdpa_prefill(4096, 32, 4, 32768);
 
+    // workspace memory of the streaming attention path
+    // format: (head_dim, num_heads, num_groups, src_seqlen)
+    perf_sdpa_prefill_memory(128, 4, 4, 512);
+    perf_sdpa_prefill_memory(128, 32, 32, 1024);
+    perf_sdpa_prefill_memory(128, 32, 32, 4096);
+    perf_sdpa_prefill_memory(128, 32, 8, 4096);
+    perf_sdpa_prefill_memory(128, 32, 8, 8192);
+
     return 0;
 }
@@ -0,0 +1,50 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "perfutil.h"
+
+static void perf_spectrogram(int size, int n_fft, int hoplen, int power)
+{
+    ncnn::ParamDict pd;
+    pd.set(0, n_fft);
+    pd.set(1, power);
+    pd.set(2, hoplen);
+    pd.set(3, n_fft);
+    pd.set(4, 1); // hann
+    pd.set(5, 1); // center
+    pd.set(6, 2); // reflect
+
+    std::vector<ncnn::Mat> weights(0);
+
+    perf_layer("Spectrogram", pd, weights, PerfMat(size), "size=%d n_fft=%d hop=%d power=%d", size, n_fft, hoplen, power);
+}
+
+static void perf_inversespectrogram(int frames, int n_fft, int hoplen)
+{
+    ncnn::ParamDict pd;
+    pd.set(0, n_fft);
+    pd.set(1, 1); // real
+    pd.set(2, hoplen);
+    pd.set(3, n_fft);
+    pd.set(4, 1); // hann
+    pd.set(5, 1); // center
+
+    std::vector<ncnn::Mat> weights(0);
+
+    perf_layer("InverseSpectrogram", pd, weights, PerfMat(2, frames, n_fft / 2 + 1), "frames=%d n_fft=%d hop=%d", frames, n_fft, hoplen);
+}
+
+int main()
+{
+    // whisper, 30s of 16khz audio
+    perf_spectrogram(480000, 400, 160, 2);
+    perf_spectrogram(480000, 400, 160, 0);
+    perf_spectrogram(160000, 512, 128, 1);
+    perf_spectrogram(160000, 1024, 256, 1);
+
+    // vocoder istft
+    perf_inversespectrogram(1000, 400, 160);
+    perf_inversespectrogram(1000, 1024, 256);
+
+    return 0;
+}
@@ -0,0 +1,231 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "allocator.h"
+#include "net.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static int check_chunk(const unsigned char* ptr, size_t size, unsigned char tag)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        if (ptr[i] != tag)
+            return -1;
+    }
+    return 0;
+}
+
+static int test_threadcache_pool_allocator_sizes(bool use_hugepage)
+{
+    ncnn::ThreadCachePoolAllocator allocator;
+    allocator.set_use_hugepage(use_hugepage);
+
+    // class boundaries, odd sizes, hugepage sized and unpooled chunks
+    const size_t sizes[] = {1, 63, 64, 65, 80, 81, 127, 128, 129, 1000, 4096, 4097, 65535, 1000000, 2 * 1024 * 1024 + 17, 9 * 1024 * 1024};
+    const int count = sizeof(sizes) / sizeof(sizes[0]);
+
+    for (int loop = 0; loop < 3; loop++)
+    {
+        std::vector<void*> ptrs(count);
+        for (int i = 0; i < count; i++)
+        {
+            ptrs[i] = allocator.fastMalloc(sizes[i]);
+            if (!ptrs[i] || (size_t)ptrs[i] % NCNN_MALLOC_ALIGN != 0)
+            {
+                fprintf(stderr, "test_threadcache_pool_allocator_sizes bad chunk %p for size %zu\n", ptrs[i], sizes[i]);
+                return -1;
+            }
+
+            memset(ptrs[i], i + 1, sizes[i]);
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            if (check_chunk((const unsigned char*)ptrs[i], sizes[i], (unsigned char)(i + 1)) != 0)
+            {
+                fprintf(stderr, "test_threadcache_pool_allocator_sizes chunk %d overwritten\n", i);
+                return -1;
+            }
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            allocator.fastFree(ptrs[i]);
+        }
+
+        if (loop == 1)
+            allocator.clear();
+    }
+
+    allocator.fastFree(0);
+
+    return 0;
+}
+
+struct StressArgs
+{
+    ncnn::Allocator* allocator;
+    int seed;
+    int ret;
+};
+
+// every thread mixes sizes, holds chunks for a while and validates their content
+static void* stress_entry(void* args)
+{
+    StressArgs* sa = (StressArgs*)args;
+
+    unsigned int seed = (unsigned int)sa->seed;
+
+    const int slot_count = 32;
+    void* slots[slot_count];
+    size_t slot_sizes[slot_count];
+    memset(slots, 0, sizeof(slots));
+
+    for (int i = 0; i < 4000; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        const int s = (seed >> 16) % slot_count;
+
+        if (slots[s])
+        {
+            if (check_chunk((const unsigned char*)slots[s], slot_sizes[s], (unsigned char)s) != 0)
+            {
+                sa->ret = -1;
+                return 0;
+            }
+
+            sa->allocator->fastFree(slots[s]);
+            slots[s] = 0;
+            continue;
+        }
+
+        seed = seed * 1103515245 + 12345;
+        const size_t size = 16 + ((seed >> 8) % (s < 4 ? 600000 : 6000));
+
+        slots[s] = sa->allocator->fastMalloc(size);
+        if (!slots[s])
+        {
+            sa->ret = -1;
+            return 0;
+        }
+
+        slot_sizes[s] = size;
+        memset(slots[s], s, size);
+    }
+
+    for (int s = 0; s < slot_count; s++)
+    {
+        sa->allocator->fastFree(slots[s]);
+    }
+
+    return 0;
+}
+
+static int test_threadcache_pool_allocator_threads(int num_threads)
+{
+    ncnn::ThreadCachePoolAllocator allocator;
+
+    // small caches to go through the shared pool and the budget drop a lot
+    allocator.set_thread_cache_size(64 * 1024);
+    allocator.set_pool_cache_size(1024 * 1024);
+
+    std::vector<StressArgs> args(num_threads);
+    std::vector<ncnn::Thread*> threads(num_threads);
+    for (int i = 0; i < num_threads; i++)
+    {
+        args[i].allocator = &allocator;
+        args[i].seed = 7767517 + i;
+        args[i].ret = 0;
+        threads[i] = new ncnn::Thread(stress_entry, &args[i]);
+    }
+
+    int ret = 0;
+    for (int i = 0; i < num_threads; i++)
+    {
+        threads[i]->join();
+        delete threads[i];
+        ret |= args[i].ret;
+    }
+
+    if (ret != 0)
+    {
+        fprintf(stderr, "test_threadcache_pool_allocator_threads failed num_threads=%d\n", num_threads);
+        return -1;
+    }
+
+    return 0;
+}
+
+static const char allocator_param[] = "7767517\n"
+                                      "4 4\n"
+                                      "Input data_input 0 1 data\n"
+                                      "Convolution conv 1 1 data c0 0=16 1=3 4=1 5=1 6=432\n"
+                                      "Pooling pool 1 1 c0 p0 0=0 1=2 2=2\n"
+                                      "Softmax softmax 1 1 p0 out 0=0 1=1\n";
+
+static int test_threadcache_pool_allocator_extract()
+{
+    // raw float32 flag, weights and bias, referenced by the net without copy
+    std::vector<float> model(1 + 432 + 16);
+    model[0] = 0.f;
+    for (size_t i = 1; i < model.size(); i++)
+    {
+        model[i] = RandomFloat(-1.f, 1.f);
+    }
+
+    ncnn::Net net;
+    net.opt.use_vulkan_compute = false;
+    net.opt.num_threads = 2;
+
+    if (net.load_param_mem(allocator_param) != 0)
+        return -1;
+
+    net.load_model((const unsigned char*)model.data());
+
+    const ncnn::Mat data = RandomMat(24, 20, 3);
+
+    ncnn::Mat reference;
+    {
+        ncnn::Extractor ex = net.create_extractor();
+        ex.input("data", data);
+        ex.extract("out", reference);
+    }
+
+    ncnn::ThreadCachePoolAllocator allocator;
+
+    for (int i = 0; i < 4; i++)
+    {
+        ncnn::Mat out;
+        {
+            ncnn::Extractor ex = net.create_extractor();
+            ex.set_blob_allocator(&allocator);
+            ex.set_workspace_allocator(&allocator);
+            ex.input("data", data);
+            ex.extract("out", out);
+        }
+
+        if (CompareMat(reference, out, 0.001f) != 0)
+        {
+            fprintf(stderr, "test_threadcache_pool_allocator_extract output mismatch\n");
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int main()
+{
+    SRAND(7767517);
+
+    return 0
+           || test_threadcache_pool_allocator_sizes(false)
+           || test_threadcache_pool_allocator_sizes(true)
+           || test_threadcache_pool_allocator_threads(1)
+           || test_threadcache_pool_allocator_threads(4)
+           || test_threadcache_pool_allocator_threads(9)
+           || test_threadcache_pool_allocator_extract();
+}
@@ -0,0 +1,184 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "autotunecache.h"
+#include "net.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// winograd, 1x1 sgemm and strided packed candidates
+static const char conv_param[] = "7767517\n"
+                                 "4 4\n"
+                                 "Input data 0 1 data -23330=4,3,20,18,16\n"
+                                 "Convolution conv0 1 1 data c0 0=24 1=3 4=1 5=1 6=3456 9=1 -23330=4,3,20,18,24\n"
+                                 "Convolution conv1 1 1 c0 c1 0=32 1=1 5=1 6=768 -23330=4,3,20,18,32\n"
+                                 "Convolution conv2 1 1 c1 out 0=8 1=5 3=2 4=2 5=1 6=6400\n";
+
+// constant B and C, M comes from the input shape hint
+static const char gemm_param[] = "7767517\n"
+                                 "2 2\n"
+                                 "Input data 0 1 data -23330=3,2,48,40\n"
+                                 "Gemm gemm0 1 1 data out 5=1 6=1 8=56 9=48 10=4\n";
+
+static void append_weight(std::vector<unsigned char>& model, int size, bool flag)
+{
+    if (flag)
+    {
+        // raw float32 tag
+        const unsigned int tag = 0;
+        const unsigned char* p = (const unsigned char*)&tag;
+        model.insert(model.end(), p, p + sizeof(tag));
+    }
+
+    ncnn::Mat m = RandomMat(size);
+    const unsigned char* p = (const unsigned char*)m.data;
+    model.insert(model.end(), p, p + size * sizeof(float));
+}
+
+static int run_net(const char* param, const std::vector<unsigned char>& model, ncnn::AutotuneCache* cache, int num_threads, const ncnn::Mat& in, ncnn::Mat& out)
+{
+    ncnn::Net net;
+    net.opt.use_vulkan_compute = false;
+    net.opt.use_bf16_storage = false;
+    net.opt.use_fp16_storage = false;
+    net.opt.num_threads = num_threads;
+    net.opt.autotune_cache = cache;
+
+    if (net.load_param_mem(param) != 0)
+        return -1;
+
+    if (net.load_model(&model[0]) != model.size())
+        return -1;
+
+    ncnn::Extractor ex = net.create_extractor();
+    ex.input("data", in);
+
+    int ret = ex.extract("out", out);
+    if (ret != 0)
+        return ret;
+
+    out = out.clone();
+
+    return 0;
+}
+
+static int test_autotune(const char* param, const std::vector<unsigned char>& model, const ncnn::Mat& in, int num_threads, int entry_count)
+{
+    ncnn::Mat ref;
+    int ret = run_net(param, model, 0, num_threads, in, ref);
+    if (ret != 0)
+    {
+        fprintf(stderr, "test_autotune reference failed ret=%d\n", ret);
+        return -1;
+    }
+
+    // measure and record
+    ncnn::AutotuneCache cache;
+    ncnn::Mat out;
+    ret = run_net(param, model, &cache, num_threads, in, out);
+    if (ret != 0 || CompareMat(ref, out, 0.01f) != 0)
+    {
+        fprintf(stderr, "test_autotune tuned output mismatch ret=%d num_threads=%d\n", ret, num_threads);
+        return -1;
+    }
+
+    if ((int)cache.size() != entry_count)
+    {
+        fprintf(stderr, "test_autotune expect %d entries but got %d\n", entry_count, (int)cache.size());
+        return -1;
+    }
+
+    // round trip through the cache file and load with recorded choices
+    FILE* fp = tmpfile();
+    if (!fp)
+        return 0;
+
+    ncnn::AutotuneCache cache2;
+    ret = cache.save_cache(fp);
+    rewind(fp);
+    ret |= cache2.load_cache(fp);
+    fclose(fp);
+
+    if (ret != 0 || cache2.size() != cache.size())
+    {
+        fprintf(stderr, "test_autotune cache round trip failed ret=%d\n", ret);
+        return -1;
+    }
+
+    ncnn::Mat out2;
+    ret = run_net(param, model, &cache2, num_threads, in, out2);
+    if (ret != 0 || CompareMat(out, out2, 0.001f) != 0 || cache2.size() != cache.size())
+    {
+        fprintf(stderr, "test_autotune cached output mismatch ret=%d num_threads=%d\n", ret, num_threads);
+        return -1;
+    }
+
+    return 0;
+}
+
+static int test_autotune_conv(int num_threads)
+{
+    std::vector<unsigned char> model;
+    append_weight(model, 3456, true);
+    append_weight(model, 24, false);
+    append_weight(model, 768, true);
+    append_weight(model, 32, false);
+    append_weight(model, 6400, true);
+    append_weight(model, 8, false);
+
+    return test_autotune(conv_param, model, RandomMat(20, 18, 16), num_threads, 3);
+}
+
+static int test_autotune_gemm(int num_threads)
+{
+    std::vector<unsigned char> model;
+    append_weight(model, 56 * 48, true);
+    append_weight(model, 56, true);
+
+    return test_autotune(gemm_param, model, RandomMat(48, 40), num_threads, 1);
+}
+
+static int test_autotune_signature()
+{
+    FILE* fp = tmpfile();
+    if (!fp)
+        return 0;
+
+    fprintf(fp, "ncnn-autotune-cache 1\nsome_other_cpu+avx\nConvolution_x86_fp32_test 1 5\n");
+    rewind(fp);
+
+    // entries measured elsewhere are dropped
+    ncnn::AutotuneCache cache;
+    int ret = cache.load_cache(fp);
+    fclose(fp);
+
+    if (ret != 0 || cache.size() != 0)
+    {
+        fprintf(stderr, "test_autotune_signature failed ret=%d size=%d\n", ret, (int)cache.size());
+        return -1;
+    }
+
+    int value = 0;
+    cache.update("key", &value, 1);
+    if (cache.query("key", &value, 1) != 0 || cache.query("missing", &value, 1) == 0)
+    {
+        fprintf(stderr, "test_autotune_signature query failed\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+int main()
+{
+    SRAND(7767517);
+
+    return 0
+           || test_autotune_signature()
+           || test_autotune_conv(1)
+           || test_autotune_conv(4)
+           || test_autotune_gemm(1)
+           || test_autotune_gemm(2);
+}
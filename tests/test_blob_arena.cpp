@@ -0,0 +1,208 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "net.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// branches joined by concat, in-place layers and a residual tail
+static const char arena_param[] = "7767517\n"
+                                  "13 16\n"
+                                  "Input data_input 0 1 data\n"
+                                  "Split split0 1 3 data a0 b0 c0\n"
+                                  "Pooling pool_a 1 1 a0 a1 0=0 1=3 2=1 3=1\n"
+                                  "Sigmoid sigmoid_a 1 1 a1 a2\n"
+                                  "UnaryOp square_b 1 1 b0 b1 0=4\n"
+                                  "Pooling pool_b 1 1 b1 b2 0=1 1=3 2=1 3=1\n"
+                                  "BinaryOp mul_c 1 1 c0 c1 0=2 1=1 2=0.5\n"
+                                  "ReLU relu_c 1 1 c1 c2\n"
+                                  "Concat concat 3 1 a2 b2 c2 cat\n"
+                                  "Split split1 1 2 cat d0 e0\n"
+                                  "Softmax softmax_d 1 1 d0 d1 0=0 1=1\n"
+                                  "Eltwise sum 2 1 d1 e0 sum0 0=1\n"
+                                  "BinaryOp out 1 1 sum0 out 0=0 1=1 2=0.25\n";
+
+static const unsigned int empty_model[1] = {0};
+
+static int load_arena_net(ncnn::Net& net, bool lightmode, bool parallel_branch)
+{
+    net.opt.use_vulkan_compute = false;
+    net.opt.lightmode = lightmode;
+    net.opt.use_parallel_branch = parallel_branch;
+    net.opt.num_threads = parallel_branch ? 2 : 1;
+
+    if (net.load_param_mem(arena_param) != 0)
+        return -1;
+
+    net.load_model((const unsigned char*)empty_model);
+
+    return 0;
+}
+
+// the first extract runs a partial graph, the second resumes from it
+static int run_arena_net(const ncnn::Net& net, ncnn::Allocator* blob_allocator, ncnn::BlobArenaAllocator* arena, const ncnn::Mat& data, ncnn::Mat& b2, ncnn::Mat& out)
+{
+    ncnn::Extractor ex = net.create_extractor();
+    if (arena)
+        ex.set_blob_arena_allocator(arena);
+    else
+        ex.set_blob_allocator(blob_allocator);
+
+    ex.input("data", data);
+
+    int ret = ex.extract("b2", b2);
+    if (ret != 0)
+        return ret;
+
+    return ex.extract("out", out);
+}
+
+static int test_blob_arena(bool lightmode, bool parallel_branch, bool hold_outputs)
+{
+    // alternate two input shapes, each gets its own plan
+    std::vector<ncnn::Mat> inputs(12);
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        inputs[i] = i % 2 == 0 ? RandomMat(13, 11, 8) : RandomMat(7, 9, 16);
+    }
+
+    ncnn::Net net;
+    if (load_arena_net(net, lightmode, parallel_branch) != 0)
+        return -1;
+
+    ncnn::PoolAllocator pool_allocator;
+
+    std::vector<ncnn::Mat> reference_outputs;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        ncnn::Mat b2;
+        ncnn::Mat out;
+        int ret = run_arena_net(net, &pool_allocator, 0, inputs[i], b2, out);
+        if (ret != 0)
+        {
+            fprintf(stderr, "test_blob_arena reference failed ret=%d\n", ret);
+            return -1;
+        }
+
+        reference_outputs.push_back(b2.clone());
+        reference_outputs.push_back(out.clone());
+    }
+
+    std::vector<ncnn::Mat> outputs;
+    {
+        ncnn::BlobArenaAllocator arena;
+
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            ncnn::Mat b2;
+            ncnn::Mat out;
+            int ret = run_arena_net(net, 0, &arena, inputs[i], b2, out);
+            if (ret != 0)
+            {
+                fprintf(stderr, "test_blob_arena failed ret=%d lightmode=%d parallel_branch=%d hold_outputs=%d\n", ret, lightmode, parallel_branch, hold_outputs);
+                return -1;
+            }
+
+            // blobs held across runs must never be overwritten by the next run
+            outputs.push_back(hold_outputs ? b2 : b2.clone());
+            outputs.push_back(hold_outputs ? out : out.clone());
+
+            if (i >= 6 && !parallel_branch && !hold_outputs)
+            {
+                // plans are settled, the arena serves every blob
+                if (arena.heap_alloc_count() != 0 || arena.planned_size() == 0)
+                {
+                    fprintf(stderr, "test_blob_arena not replayed heap_alloc_count=%d planned_size=%d lightmode=%d\n", arena.heap_alloc_count(), (int)arena.planned_size(), lightmode);
+                    return -1;
+                }
+            }
+        }
+
+        if (arena.arena_size() < arena.planned_size())
+        {
+            fprintf(stderr, "test_blob_arena arena_size=%d planned_size=%d\n", (int)arena.arena_size(), (int)arena.planned_size());
+            return -1;
+        }
+
+        if (CompareMat(reference_outputs, outputs, 0.001f) != 0)
+        {
+            fprintf(stderr, "test_blob_arena output mismatch lightmode=%d parallel_branch=%d hold_outputs=%d\n", lightmode, parallel_branch, hold_outputs);
+            return -1;
+        }
+
+        // release before the arena goes away
+        outputs.clear();
+    }
+
+    return 0;
+}
+
+static int test_blob_arena_plan()
+{
+    // c0 and c1 die before c2 is allocated, so c2 reuses their space
+    ncnn::BlobArenaAllocator arena;
+
+    std::vector<int> signature(1, 1);
+    for (int i = 0; i < 3; i++)
+    {
+        arena.begin_run(signature);
+
+        void* p0 = arena.fastMalloc(1000);
+        void* p1 = arena.fastMalloc(3000);
+        arena.fastFree(p0);
+        void* p2 = arena.fastMalloc(4000);
+        arena.fastFree(p1);
+        void* p3 = arena.fastMalloc(2000);
+        arena.fastFree(p2);
+        arena.fastFree(p3);
+
+        arena.end_run();
+
+        if (i == 0)
+            continue;
+
+        // 3000 + 4000 live together, p0 fits before p1 and p3 reuses p1
+        const size_t expected = ncnn::alignSize(3000, NCNN_MALLOC_ALIGN) + ncnn::alignSize(4000, NCNN_MALLOC_ALIGN);
+        if (arena.planned_size() != expected || arena.heap_alloc_count() != (i == 1 ? 1 : 0))
+        {
+            fprintf(stderr, "test_blob_arena_plan planned_size=%d expected=%d heap_alloc_count=%d\n", (int)arena.planned_size(), (int)expected, arena.heap_alloc_count());
+            return -1;
+        }
+    }
+
+    // a different allocation sequence falls back to heap, then gets a new plan
+    for (int i = 0; i < 3; i++)
+    {
+        arena.begin_run(signature);
+
+        void* p0 = arena.fastMalloc(5000);
+        memset(p0, 0, 5000);
+        arena.fastFree(p0);
+
+        arena.end_run();
+
+        if (i == 2 && arena.heap_alloc_count() != 0)
+        {
+            fprintf(stderr, "test_blob_arena_plan replan heap_alloc_count=%d\n", arena.heap_alloc_count());
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int main()
+{
+    SRAND(7767517);
+
+    return 0
+           || test_blob_arena_plan()
+           || test_blob_arena(true, false, false)
+           || test_blob_arena(false, false, false)
+           || test_blob_arena(true, false, true)
+           || test_blob_arena(false, false, true)
+           || test_blob_arena(true, true, false)
+           || test_blob_arena(true, true, true);
+}
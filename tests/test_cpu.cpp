@@ -104,6 +104,65 @@ static int test_cpu_powersave()
     }
 }
 
+static int test_cpu_numa()
+{
+    const int node_count = ncnn::get_numa_node_count();
+    if (node_count < 1)
+    {
+        fprintf(stderr, "There must be at least one numa node\n");
+        return 1;
+    }
+
+    int cpu_count_on_nodes = 0;
+    for (int i = 0; i < node_count; i++)
+    {
+        const ncnn::CpuSet& mask = ncnn::get_numa_node_cpu_mask(i);
+        for (int j = 0; j < ncnn::get_cpu_count(); j++)
+        {
+            if (!mask.is_enabled(j))
+                continue;
+
+            if (ncnn::get_cpu_numa_node(j) != i)
+            {
+                fprintf(stderr, "cpu %d is in the mask of numa node %d but reported on node %d\n", j, i, ncnn::get_cpu_numa_node(j));
+                return 1;
+            }
+
+            cpu_count_on_nodes++;
+        }
+    }
+
+    if (cpu_count_on_nodes == 0 || cpu_count_on_nodes > ncnn::get_cpu_count())
+    {
+        fprintf(stderr, "numa nodes hold %d cpus of %d\n", cpu_count_on_nodes, ncnn::get_cpu_count());
+        return 1;
+    }
+
+    if (ncnn::set_numa_node_thread_affinity(-1, 1) == 0 || ncnn::set_numa_node_thread_affinity(node_count, 1) == 0)
+    {
+        fprintf(stderr, "Binding on an invalid numa node should fail\n");
+        return 1;
+    }
+
+    // node of the cpu running the test
+    for (int i = 0; i < node_count; i++)
+    {
+        if (ncnn::get_numa_node_cpu_mask(i).num_enabled() == 0)
+            continue;
+
+        if (ncnn::set_numa_node_thread_affinity(i, 2) != 0)
+        {
+            fprintf(stderr, "Binding on numa node %d failed\n", i);
+            return 1;
+        }
+
+        // restore
+        return ncnn::set_cpu_thread_affinity(ncnn::get_cpu_thread_affinity_mask(0)) == 0 ? 0 : 1;
+    }
+
+    return 0;
+}
+
 #else
 
 #if defined _WIN32
@@ -149,6 +208,11 @@ static int test_cpu_powersave()
     return 0;
 }
 
+static int test_cpu_numa()
+{
+    return 0;
+}
+
 #endif
 
 int main()
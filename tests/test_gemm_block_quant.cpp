@@ -619,7 +619,14 @@ static int test_gemm_0()
            || test_gemm(4, 7, 67, 6, 64)
            || test_gemm(2, 4, 31, 6, 32, 1)
            || test_gemm(3, 4, 129, 6, 128)
-           || test_gemm_bias(4, 7, 67, 6, 64, RandomMat(7, 4), 0.7f, 1.3f, 1, 0, 0, 0);
+           || test_gemm_bias(4, 7, 67, 6, 64, RandomMat(7, 4), 0.7f, 1.3f, 1, 0, 0, 0)
+           || test_gemm(1, 19, 200, 4, 32)
+           || test_gemm(1, 17, 257, 6, 128, 1)
+           || test_gemm(9, 13, 161, 4, 64, 1)
+           || test_gemm(6, 9, 96, 6, 32)
+           || test_gemm_bias(5, 11, 99, 4, 32, RandomMat(11), 1.f, 0.5f, 0, 0, 0, 1)
+           || test_gemm_bias(8, 6, 70, 6, 64, RandomMat(1, 8), 0.7f, 1.f, 1, 0, 0, 0)
+           || test_gemm_bias(7, 5, 45, 4, 32, RandomMat(7), 1.3f, 0.7f, 0, 0, 0, 0);
 }
 
 static int test_gemm_1(int M, int N, int K, int block_size)
@@ -0,0 +1,339 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "inferenceserver.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static const char server_param[] = "7767517\n"
+                                   "5 5\n"
+                                   "Input data_input 0 1 data\n"
+                                   "BinaryOp mul 1 1 data d0 0=2 1=1 2=0.5\n"
+                                   "Pooling pool 1 1 d0 d1 0=0 1=2 2=2\n"
+                                   "Softmax softmax 1 1 d1 d2 0=0 1=1\n"
+                                   "Sigmoid sigmoid 1 1 d2 out\n";
+
+static const unsigned int empty_model[1] = {0};
+
+static int load_server_net(ncnn::Net& net)
+{
+    net.opt.use_vulkan_compute = false;
+
+    if (net.load_param_mem(server_param) != 0)
+        return -1;
+
+    net.load_model((const unsigned char*)empty_model);
+
+    return 0;
+}
+
+static int compute_reference(const std::vector<ncnn::Mat>& inputs, std::vector<ncnn::Mat>& outputs)
+{
+    ncnn::Net net;
+    if (load_server_net(net) != 0)
+        return -1;
+
+    outputs.resize(inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        ncnn::Extractor ex = net.create_extractor();
+        ex.input("data", inputs[i]);
+        int ret = ex.extract("out", outputs[i]);
+        if (ret != 0)
+            return ret;
+    }
+
+    return 0;
+}
+
+struct ClientArgs
+{
+    ncnn::InferenceServer* server;
+    const std::vector<ncnn::Mat>* inputs;
+    std::vector<ncnn::Mat>* outputs;
+    int client_id;
+    int num_clients;
+    int ret;
+};
+
+static void* client_entry(void* args)
+{
+    ClientArgs* ca = (ClientArgs*)args;
+
+    // interleave the requests of all clients
+    for (size_t i = ca->client_id; i < ca->inputs->size(); i += ca->num_clients)
+    {
+        std::vector<ncnn::Mat> in(1, (*ca->inputs)[i]);
+        std::vector<ncnn::Mat> out;
+        int ret = ca->server->infer(in, out);
+        if (ret != 0 || out.size() != 1)
+        {
+            ca->ret = -1;
+            return 0;
+        }
+
+        (*ca->outputs)[i] = out[0];
+    }
+
+    return 0;
+}
+
+static int test_inferenceserver_infer(int num_lanes, int max_batch_size, int num_clients)
+{
+    // two input shapes to exercise shape bucketing
+    std::vector<ncnn::Mat> inputs(48);
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        inputs[i] = i % 3 == 0 ? RandomMat(10, 8, 5) : RandomMat(12, 6, 5);
+    }
+
+    std::vector<ncnn::Mat> reference_outputs;
+    if (compute_reference(inputs, reference_outputs) != 0)
+    {
+        fprintf(stderr, "test_inferenceserver_infer reference failed\n");
+        return -1;
+    }
+
+    ncnn::InferenceServer server;
+    if (load_server_net(server.net()) != 0)
+        return -1;
+
+    ncnn::ServerOption opt;
+    opt.num_lanes = num_lanes;
+    opt.num_threads = num_lanes;
+    opt.max_batch_size = max_batch_size;
+    opt.max_batch_delay_us = 1000;
+
+    if (server.start(opt) != 0)
+    {
+        fprintf(stderr, "test_inferenceserver_infer start failed\n");
+        return -1;
+    }
+
+    std::vector<ncnn::Mat> outputs(inputs.size());
+    std::vector<ClientArgs> args(num_clients);
+    std::vector<ncnn::Thread*> clients(num_clients);
+    for (int i = 0; i < num_clients; i++)
+    {
+        args[i].server = &server;
+        args[i].inputs = &inputs;
+        args[i].outputs = &outputs;
+        args[i].client_id = i;
+        args[i].num_clients = num_clients;
+        args[i].ret = 0;
+        clients[i] = new ncnn::Thread(client_entry, &args[i]);
+    }
+
+    int ret = 0;
+    for (int i = 0; i < num_clients; i++)
+    {
+        clients[i]->join();
+        delete clients[i];
+        ret |= args[i].ret;
+    }
+
+    ncnn::ServerStats stats = server.stats();
+
+    server.stop();
+
+    if (ret != 0)
+    {
+        fprintf(stderr, "test_inferenceserver_infer request failed num_lanes=%d max_batch_size=%d num_clients=%d\n", num_lanes, max_batch_size, num_clients);
+        return -1;
+    }
+
+    if (CompareMat(reference_outputs, outputs, 0.001f) != 0)
+    {
+        fprintf(stderr, "test_inferenceserver_infer output mismatch num_lanes=%d max_batch_size=%d num_clients=%d\n", num_lanes, max_batch_size, num_clients);
+        return -1;
+    }
+
+    if (stats.completed != (int)inputs.size() || stats.failed != 0 || stats.batches < 1 || stats.avg_batch_size < 1.0 || stats.avg_batch_size > max_batch_size)
+    {
+        fprintf(stderr, "test_inferenceserver_infer bad counters completed=%d failed=%d batches=%d avg_batch_size=%f\n", stats.completed, stats.failed, stats.batches, stats.avg_batch_size);
+        return -1;
+    }
+
+    if (stats.latency_p50 <= 0.0 || stats.latency_p50 > stats.latency_p99 || stats.latency_p99 > stats.latency_max)
+    {
+        fprintf(stderr, "test_inferenceserver_infer bad latency p50=%f p99=%f max=%f\n", stats.latency_p50, stats.latency_p99, stats.latency_max);
+        return -1;
+    }
+
+    return 0;
+}
+
+struct SubmitResult
+{
+    ncnn::Mutex lock;
+    int finished;
+    int failed;
+    std::vector<ncnn::Mat> outputs;
+};
+
+struct SubmitTicket
+{
+    SubmitResult* result;
+    int index;
+};
+
+static void submit_callback(int ret, std::vector<ncnn::Mat>& outputs, void* userdata)
+{
+    SubmitTicket* t = (SubmitTicket*)userdata;
+
+    ncnn::MutexLockGuard guard(t->result->lock);
+    if (ret != 0 || outputs.size() != 1)
+    {
+        t->result->failed++;
+    }
+    else
+    {
+        t->result->outputs[t->index] = outputs[0];
+    }
+    t->result->finished++;
+}
+
+static int test_inferenceserver_submit()
+{
+    std::vector<ncnn::Mat> inputs(24);
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        inputs[i] = RandomMat(9, 7, 4);
+    }
+
+    std::vector<ncnn::Mat> reference_outputs;
+    if (compute_reference(inputs, reference_outputs) != 0)
+        return -1;
+
+    ncnn::InferenceServer server;
+    if (load_server_net(server.net()) != 0)
+        return -1;
+
+    ncnn::ServerOption opt;
+    opt.num_lanes = 2;
+    opt.num_threads = 2;
+    opt.max_batch_size = 4;
+    opt.max_batch_delay_us = 500;
+    opt.max_queue_size = 6;
+
+    if (server.start(opt) != 0)
+        return -1;
+
+    SubmitResult result;
+    result.finished = 0;
+    result.failed = 0;
+    result.outputs.resize(inputs.size());
+
+    std::vector<SubmitTicket> tickets(inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        tickets[i].result = &result;
+        tickets[i].index = (int)i;
+
+        std::vector<ncnn::Mat> in(1, inputs[i]);
+        if (server.submit(in, submit_callback, &tickets[i]) != 0)
+        {
+            fprintf(stderr, "test_inferenceserver_submit submit failed\n");
+            return -1;
+        }
+    }
+
+    // stop drains the queue
+    server.stop();
+
+    if (result.finished != (int)inputs.size() || result.failed != 0)
+    {
+        fprintf(stderr, "test_inferenceserver_submit finished=%d failed=%d\n", result.finished, result.failed);
+        return -1;
+    }
+
+    if (CompareMat(reference_outputs, result.outputs, 0.001f) != 0)
+    {
+        fprintf(stderr, "test_inferenceserver_submit output mismatch\n");
+        return -1;
+    }
+
+    // no more requests after stop
+    std::vector<ncnn::Mat> in(1, inputs[0]);
+    if (server.submit(in, submit_callback, &tickets[0]) == 0)
+    {
+        fprintf(stderr, "test_inferenceserver_submit accepted request after stop\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+#if NCNN_BATCH
+static int test_inferenceserver_batched_request()
+{
+    // a client sends a pre-batched request, the server keeps it together
+    ncnn::Mat batched(10, 8, 5, 4u, 1, 3);
+    std::vector<ncnn::Mat> singles(3);
+    for (int b = 0; b < 3; b++)
+    {
+        singles[b] = RandomMat(10, 8, 5);
+        memcpy(batched.batch(b), singles[b], singles[b].total() * singles[b].elemsize);
+    }
+
+    std::vector<ncnn::Mat> reference_outputs;
+    if (compute_reference(singles, reference_outputs) != 0)
+        return -1;
+
+    ncnn::InferenceServer server;
+    if (load_server_net(server.net()) != 0)
+        return -1;
+
+    ncnn::ServerOption opt;
+    opt.num_lanes = 1;
+    opt.num_threads = 1;
+    opt.max_batch_size = 4;
+
+    if (server.start(opt) != 0)
+        return -1;
+
+    std::vector<ncnn::Mat> in(1, batched);
+    std::vector<ncnn::Mat> out;
+    int ret = server.infer(in, out);
+
+    server.stop();
+
+    if (ret != 0 || out.size() != 1 || out[0].n != 3)
+    {
+        fprintf(stderr, "test_inferenceserver_batched_request failed ret=%d\n", ret);
+        return -1;
+    }
+
+    std::vector<ncnn::Mat> outputs(3);
+    for (int b = 0; b < 3; b++)
+    {
+        outputs[b] = out[0].batch(b);
+    }
+
+    if (CompareMat(reference_outputs, outputs, 0.001f) != 0)
+    {
+        fprintf(stderr, "test_inferenceserver_batched_request output mismatch\n");
+        return -1;
+    }
+
+    return 0;
+}
+#endif // NCNN_BATCH
+
+int main()
+{
+    SRAND(7767517);
+
+    return 0
+           || test_inferenceserver_infer(1, 1, 1)
+           || test_inferenceserver_infer(1, 4, 4)
+           || test_inferenceserver_infer(2, 8, 6)
+           || test_inferenceserver_infer(3, 2, 8)
+           || test_inferenceserver_submit()
+#if NCNN_BATCH
+           || test_inferenceserver_batched_request()
+#endif
+           ;
+}
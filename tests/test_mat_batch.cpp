@@ -4530,6 +4530,184 @@ static int test_batch_forward_pooling()
     return 0;
 }
 
+static int test_batch_forward_weights(const char* name, const char* param_str, const std::vector<float>& weights, const ncnn::Mat& input_batch, bool use_packing_layout)
+{
+    const int B = input_batch.n;
+
+    ncnn::Net net;
+    net.opt.use_packing_layout = use_packing_layout;
+    net.opt.use_fp16_storage = false;
+    net.opt.use_fp16_arithmetic = false;
+    net.opt.use_bf16_storage = false;
+    net.load_param_mem(param_str);
+    net.load_model((const unsigned char*)&weights[0]);
+
+    ncnn::Mat output_batch;
+    {
+        ncnn::Extractor ex = net.create_extractor();
+        ex.input("data", input_batch);
+
+        int ret = ex.extract("output", output_batch);
+        if (ret != 0)
+        {
+            fprintf(stderr, "%s extract failed ret=%d\n", name, ret);
+            return -1;
+        }
+    }
+
+    if (output_batch.n != B)
+    {
+        fprintf(stderr, "%s batch mismatch expect %d but got %d\n", name, B, output_batch.n);
+        return -1;
+    }
+
+    // reference, one sample at a time
+    for (int b = 0; b < B; b++)
+    {
+        ncnn::Extractor ex = net.create_extractor();
+        ex.input("data", input_batch.batch(b).clone());
+
+        ncnn::Mat output_ref;
+        int ret = ex.extract("output", output_ref);
+        if (ret != 0)
+        {
+            fprintf(stderr, "%s reference extract failed ret=%d\n", name, ret);
+            return -1;
+        }
+
+        if (CompareMat(output_ref, output_batch.batch(b), 0.001f) != 0)
+        {
+            fprintf(stderr, "%s value mismatch at batch %d use_packing_layout=%d\n", name, b, (int)use_packing_layout);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static std::vector<float> random_weights(int size0, int size1)
+{
+    // type 0 weight with a zero tag for raw fp32, followed by raw bias
+    std::vector<float> weights(1 + size0 + size1);
+    weights[0] = 0.f;
+    for (size_t i = 1; i < weights.size(); i++)
+    {
+        weights[i] = RandomFloat(-1.f, 1.f);
+    }
+    return weights;
+}
+
+static ncnn::Mat random_batch(int w, int h, int c, int B)
+{
+    ncnn::Mat m;
+    if (h == 0)
+        m.create(w, (size_t)4u, 1, B);
+    else if (c == 0)
+        m.create(w, h, 4u, 1, B);
+    else
+        m.create(w, h, c, 4u, 1, B);
+
+    for (int b = 0; b < B; b++)
+    {
+        ncnn::Mat sub = m.batch(b);
+        Randomize(sub);
+    }
+    return m;
+}
+
+static int test_batch_forward_innerproduct()
+{
+    const char param_1d[] = "7767517\n"
+                            "2 2\n"
+                            "Input        input 0 1 data\n"
+                            "InnerProduct fc    1 1 data output 0=48 1=1 2=3072 9=1\n";
+
+    const char param_3d[] = "7767517\n"
+                            "2 2\n"
+                            "Input        input 0 1 data\n"
+                            "InnerProduct fc    1 1 data output 0=16 1=1 2=2048\n";
+
+    const char param_2d[] = "7767517\n"
+                            "2 2\n"
+                            "Input        input 0 1 data\n"
+                            "InnerProduct fc    1 1 data output 0=24 1=1 2=768\n";
+
+    std::vector<float> weights_1d = random_weights(3072, 48);
+    std::vector<float> weights_3d = random_weights(2048, 16);
+    std::vector<float> weights_2d = random_weights(768, 24);
+
+    for (int i = 0; i < 2; i++)
+    {
+        const bool use_packing_layout = i == 1;
+
+        int ret = 0
+                  || test_batch_forward_weights("test_batch_forward_innerproduct_1d_b8", param_1d, weights_1d, random_batch(64, 0, 0, 8), use_packing_layout)
+                  || test_batch_forward_weights("test_batch_forward_innerproduct_1d_b3", param_1d, weights_1d, random_batch(64, 0, 0, 3), use_packing_layout)
+                  || test_batch_forward_weights("test_batch_forward_innerproduct_3d_b4", param_3d, weights_3d, random_batch(4, 4, 8, 4), use_packing_layout)
+                  || test_batch_forward_weights("test_batch_forward_innerproduct_2d_b3", param_2d, weights_2d, random_batch(32, 8, 0, 3), use_packing_layout);
+        if (ret != 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+static int test_batch_forward_gemm()
+{
+    // constant B 32x24 and constant C broadcast along N
+    const char param_str[] = "7767517\n"
+                             "2 2\n"
+                             "Input input 0 1 data\n"
+                             "Gemm  gemm  1 1 data output 0=0.5 3=1 5=1 6=1 8=24 9=32 10=4\n";
+
+    std::vector<float> weights = random_weights(32 * 24, 1 + 24);
+    weights[1 + 32 * 24] = 0.f;
+
+    for (int i = 0; i < 2; i++)
+    {
+        const bool use_packing_layout = i == 1;
+
+        int ret = 0
+                  || test_batch_forward_weights("test_batch_forward_gemm_m8_b4", param_str, weights, random_batch(32, 8, 0, 4), use_packing_layout)
+                  || test_batch_forward_weights("test_batch_forward_gemm_m5_b3", param_str, weights, random_batch(32, 5, 0, 3), use_packing_layout);
+        if (ret != 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+static int test_batch_forward_convolution()
+{
+    const char param_1x1[] = "7767517\n"
+                             "2 2\n"
+                             "Input       input 0 1 data\n"
+                             "Convolution conv  1 1 data output 0=24 1=1 5=1 6=384 9=1\n";
+
+    const char param_3x3[] = "7767517\n"
+                             "2 2\n"
+                             "Input       input 0 1 data\n"
+                             "Convolution conv  1 1 data output 0=16 1=3 4=1 5=1 6=1152\n";
+
+    std::vector<float> weights_1x1 = random_weights(384, 24);
+    std::vector<float> weights_3x3 = random_weights(1152, 16);
+
+    for (int i = 0; i < 2; i++)
+    {
+        const bool use_packing_layout = i == 1;
+
+        int ret = 0
+                  || test_batch_forward_weights("test_batch_forward_convolution_1x1_b4", param_1x1, weights_1x1, random_batch(4, 3, 16, 4), use_packing_layout)
+                  || test_batch_forward_weights("test_batch_forward_convolution_1x1_b3", param_1x1, weights_1x1, random_batch(1, 1, 16, 3), use_packing_layout)
+                  || test_batch_forward_weights("test_batch_forward_convolution_1x1_b2", param_1x1, weights_1x1, random_batch(7, 7, 16, 2), use_packing_layout)
+                  || test_batch_forward_weights("test_batch_forward_convolution_3x3_b3", param_3x3, weights_3x3, random_batch(7, 6, 8, 3), use_packing_layout);
+        if (ret != 0)
+            return -1;
+    }
+
+    return 0;
+}
+
 #if NCNN_VULKAN
 static int test_vkmat_create_batch_basic()
 {
@@ -5940,7 +6118,10 @@ static int test_batch_forward()
            || test_batch_forward_flatten()
            || test_batch_forward_shape_ops()
            || test_batch_forward_relu()
-           || test_batch_forward_pooling();
+           || test_batch_forward_pooling()
+           || test_batch_forward_innerproduct()
+           || test_batch_forward_gemm()
+           || test_batch_forward_convolution();
 }
 
 #if NCNN_VULKAN
@@ -5973,6 +6154,8 @@ static int test_vkmat_batch()
 
 int main()
 {
+    SRAND(7767517);
+
     int ret = test_mat_batch_cpu();
     if (ret != 0)
         return ret;
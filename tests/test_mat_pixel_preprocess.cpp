@@ -0,0 +1,147 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "mat.h"
+#include "testutil.h"
+
+static ncnn::Mat RandomPixels(int w, int h, int elempack)
+{
+    ncnn::Mat m(w, h, (size_t)elempack, elempack);
+
+    unsigned char* p = m;
+    for (int i = 0; i < w * h * elempack; i++)
+    {
+        p[i] = RAND() % 256;
+    }
+
+    return m;
+}
+
+static int test_mat_pixel_preprocess(int w, int h, int type, int roix, int roiy, int roiw, int roih, int target_width, int target_height, int elempack, int elemtype, int num_threads)
+{
+    const int type_from = type & ncnn::Mat::PIXEL_FORMAT_MASK;
+    const int inch = type_from == ncnn::Mat::PIXEL_GRAY ? 1 : (type_from == ncnn::Mat::PIXEL_RGBA || type_from == ncnn::Mat::PIXEL_BGRA) ? 4 : 3;
+
+    // padded rows
+    const int stride = w * inch + 5;
+    ncnn::Mat pixels = RandomPixels(stride, h, 1);
+
+    const float mean_vals[4] = {104.f, 117.f, 123.f, 127.5f};
+    const float norm_vals[4] = {0.017f, 0.018f, 0.019f, 1 / 127.5f};
+
+    ncnn::Option opt;
+    opt.num_threads = 1;
+
+    // the multi-pass way
+    ncnn::Mat ref = ncnn::Mat::from_pixels_roi_resize(pixels, type, w, h, stride, roix, roiy, roiw, roih, target_width, target_height);
+    ref.substract_mean_normalize(mean_vals, norm_vals);
+
+    ncnn::Option opt_fused;
+    opt_fused.num_threads = num_threads;
+
+    ncnn::Mat out;
+    int ret = ncnn::from_pixels_roi_resize_normalize(pixels, type, w, h, stride, roix, roiy, roiw, roih, target_width, target_height, mean_vals, norm_vals, out, elempack, elemtype, opt_fused);
+    if (ret != 0 || out.dims != 3 || out.w != target_width || out.h != target_height || out.c * out.elempack != ref.c || out.elempack != elempack)
+    {
+        fprintf(stderr, "test_mat_pixel_preprocess failed ret=%d type=%d elempack=%d elemtype=%d\n", ret, type, elempack, elemtype);
+        return -1;
+    }
+
+    ncnn::Mat out32 = out;
+    float epsilon = 0.001f;
+    if (elemtype == 1)
+    {
+        ncnn::cast_float16_to_float32(out, out32, opt);
+        epsilon = 0.01f;
+    }
+    if (elemtype == 2)
+    {
+        ncnn::cast_bfloat16_to_float32(out, out32, opt);
+        epsilon = 0.05f;
+    }
+
+    if (CompareMat(ref, out32, epsilon) != 0)
+    {
+        fprintf(stderr, "test_mat_pixel_preprocess failed w=%d h=%d type=%d roi=[%d %d %d %d] target=[%d %d] elempack=%d elemtype=%d num_threads=%d\n", w, h, type, roix, roiy, roiw, roih, target_width, target_height, elempack, elemtype, num_threads);
+        return -1;
+    }
+
+    return 0;
+}
+
+static int test_mat_pixel_preprocess_0()
+{
+    const int types[] = {
+        ncnn::Mat::PIXEL_RGB,
+        ncnn::Mat::PIXEL_BGR2RGB,
+        ncnn::Mat::PIXEL_RGB2GRAY,
+        ncnn::Mat::PIXEL_BGR2GRAY,
+        ncnn::Mat::PIXEL_GRAY,
+        ncnn::Mat::PIXEL_GRAY2RGB,
+        ncnn::Mat::PIXEL_RGBA2RGB,
+        ncnn::Mat::PIXEL_BGRA2RGB,
+        ncnn::Mat::PIXEL_RGBA2GRAY,
+        ncnn::Mat::PIXEL_RGBA,
+        ncnn::Mat::PIXEL_BGRA2RGBA,
+        ncnn::Mat::PIXEL_RGB2RGBA,
+        ncnn::Mat::PIXEL_GRAY2RGBA,
+    };
+
+    for (int i = 0; i < (int)(sizeof(types) / sizeof(int)); i++)
+    {
+        int ret = 0
+                  || test_mat_pixel_preprocess(64, 48, types[i], 0, 0, 64, 48, 64, 48, 1, 0, 1)
+                  || test_mat_pixel_preprocess(64, 48, types[i], 3, 5, 41, 33, 27, 19, 1, 0, 1)
+                  || test_mat_pixel_preprocess(50, 40, types[i], 1, 2, 47, 37, 96, 71, 1, 0, 3)
+                  || test_mat_pixel_preprocess(35, 29, types[i], 7, 4, 17, 13, 17, 13, 1, 1, 2)
+                  || test_mat_pixel_preprocess(35, 29, types[i], 0, 0, 35, 29, 16, 16, 1, 2, 4);
+
+        if (ret != 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+static int test_mat_pixel_preprocess_1()
+{
+    // packed rgba
+    return 0
+           || test_mat_pixel_preprocess(64, 48, ncnn::Mat::PIXEL_RGBA, 2, 3, 50, 40, 32, 32, 4, 0, 1)
+           || test_mat_pixel_preprocess(64, 48, ncnn::Mat::PIXEL_BGRA2RGBA, 0, 0, 64, 48, 64, 48, 4, 0, 2)
+           || test_mat_pixel_preprocess(64, 48, ncnn::Mat::PIXEL_RGB2RGBA, 5, 1, 30, 40, 61, 23, 4, 1, 4)
+           || test_mat_pixel_preprocess(64, 48, ncnn::Mat::PIXEL_GRAY2RGBA, 0, 0, 64, 48, 13, 77, 4, 2, 3);
+}
+
+static int test_mat_pixel_preprocess_2()
+{
+    ncnn::Mat pixels = RandomPixels(16, 16, 3);
+
+    ncnn::Mat out;
+
+    // 3 channels cannot be packed by 4
+    if (ncnn::from_pixels_roi_resize_normalize(pixels, ncnn::Mat::PIXEL_RGB, 16, 16, 16 * 3, 0, 0, 16, 16, 8, 8, 0, 0, out, 4, 0) == 0)
+    {
+        fprintf(stderr, "test_mat_pixel_preprocess_2 accepted elempack 4 for rgb\n");
+        return -1;
+    }
+
+    // roi out of image
+    if (ncnn::from_pixels_roi_resize_normalize(pixels, ncnn::Mat::PIXEL_RGB, 16, 16, 16 * 3, 4, 4, 16, 16, 8, 8, 0, 0, out, 1, 0) == 0)
+    {
+        fprintf(stderr, "test_mat_pixel_preprocess_2 accepted roi out of image\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+int main()
+{
+    SRAND(7767517);
+
+    return 0
+           || test_mat_pixel_preprocess_0()
+           || test_mat_pixel_preprocess_1()
+           || test_mat_pixel_preprocess_2();
+}
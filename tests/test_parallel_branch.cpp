@@ -0,0 +1,112 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "net.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// inception style block, three branches joined by concat and a residual tail
+// a second input runs an independent chain into the final add
+static const char branch_param[] = "7767517\n"
+                                   "15 18\n"
+                                   "Input data_input 0 1 data\n"
+                                   "Input aux_input 0 1 aux\n"
+                                   "Split split0 1 3 data a0 b0 c0\n"
+                                   "Pooling pool_a 1 1 a0 a1 0=0 1=3 2=1 3=1\n"
+                                   "Sigmoid sigmoid_a 1 1 a1 a2\n"
+                                   "UnaryOp square_b 1 1 b0 b1 0=4\n"
+                                   "Pooling pool_b 1 1 b1 b2 0=1 1=3 2=1 3=1\n"
+                                   "BinaryOp mul_c 1 1 c0 c1 0=2 1=1 2=0.5\n"
+                                   "ReLU relu_c 1 1 c1 c2\n"
+                                   "Concat concat 3 1 a2 b2 c2 cat\n"
+                                   "Split split1 1 2 cat d0 e0\n"
+                                   "Softmax softmax_d 1 1 d0 d1 0=0 1=1\n"
+                                   "BinaryOp add_aux 1 1 aux aux1 0=0 1=1 2=0.25\n"
+                                   "Eltwise sum 2 1 d1 e0 sum0 0=1\n"
+                                   "BinaryOp out 2 1 sum0 aux1 out 0=0\n";
+
+static const unsigned int empty_model[1] = {0};
+
+static int run_branch_net(bool parallel_branch, int num_threads, bool lightmode, const ncnn::Mat& data, const ncnn::Mat& aux, std::vector<ncnn::Mat>& outputs)
+{
+    ncnn::Net net;
+    net.opt.use_vulkan_compute = false;
+    net.opt.use_parallel_branch = parallel_branch;
+    net.opt.num_threads = num_threads;
+    net.opt.lightmode = lightmode;
+
+    if (net.load_param_mem(branch_param) != 0)
+        return -1;
+
+    net.load_model((const unsigned char*)empty_model);
+
+    outputs.clear();
+
+    // repeat to shake out scheduling races
+    for (int i = 0; i < 8; i++)
+    {
+        ncnn::Extractor ex = net.create_extractor();
+        ex.input("data", data);
+        ex.input("aux", aux);
+
+        // the first extract runs a partial graph, the second resumes from it
+        ncnn::Mat b2;
+        int ret = ex.extract("b2", b2);
+        if (ret != 0)
+            return ret;
+
+        ncnn::Mat out;
+        ret = ex.extract("out", out);
+        if (ret != 0)
+            return ret;
+
+        outputs.push_back(b2.clone());
+        outputs.push_back(out.clone());
+    }
+
+    return 0;
+}
+
+static int test_parallel_branch(int num_threads, bool lightmode)
+{
+    ncnn::Mat data = RandomMat(13, 11, 8);
+    ncnn::Mat aux = RandomMat(13, 11, 24);
+
+    std::vector<ncnn::Mat> reference_outputs;
+    int ret = run_branch_net(false, 1, lightmode, data, aux, reference_outputs);
+    if (ret != 0)
+    {
+        fprintf(stderr, "test_parallel_branch reference failed ret=%d\n", ret);
+        return -1;
+    }
+
+    std::vector<ncnn::Mat> outputs;
+    ret = run_branch_net(true, num_threads, lightmode, data, aux, outputs);
+    if (ret != 0)
+    {
+        fprintf(stderr, "test_parallel_branch failed ret=%d num_threads=%d lightmode=%d\n", ret, num_threads, lightmode);
+        return -1;
+    }
+
+    if (CompareMat(reference_outputs, outputs, 0.001f) != 0)
+    {
+        fprintf(stderr, "test_parallel_branch output mismatch num_threads=%d lightmode=%d\n", num_threads, lightmode);
+        return -1;
+    }
+
+    return 0;
+}
+
+int main()
+{
+    SRAND(7767517);
+
+    return 0
+           || test_parallel_branch(1, true)
+           || test_parallel_branch(2, true)
+           || test_parallel_branch(3, false)
+           || test_parallel_branch(4, true)
+           || test_parallel_branch(8, false);
+}
@@ -0,0 +1,145 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "datareader.h"
+#include "net.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// layers with heavy weight transforms, mixed with cheap ones
+static const char param[] = "7767517\n"
+                            "8 8\n"
+                            "Input data 0 1 data\n"
+                            "Convolution conv0 1 1 data c0 0=16 1=3 4=1 5=1 6=1152 9=1\n"
+                            "Convolution conv1 1 1 c0 c1 0=24 1=1 5=1 6=384\n"
+                            "ConvolutionDepthWise dw0 1 1 c1 c2 0=24 1=3 4=1 5=1 6=216 7=24 9=2 -23310=1,0.1\n"
+                            "Convolution conv2 1 1 c2 c3 0=32 1=3 3=2 4=1 5=1 6=6912 9=1\n"
+                            "Pooling pool0 1 1 c3 p0 0=1 4=1\n"
+                            "InnerProduct fc0 1 1 p0 fc0 0=40 1=1 2=1280\n"
+                            "InnerProduct fc1 1 1 fc0 out 0=10 1=1 2=400\n";
+
+static void append_weight(std::vector<unsigned char>& model, int size, bool flag)
+{
+    if (flag)
+    {
+        // raw float32 tag
+        const unsigned int tag = 0;
+        const unsigned char* p = (const unsigned char*)&tag;
+        model.insert(model.end(), p, p + sizeof(tag));
+    }
+
+    ncnn::Mat m = RandomMat(size);
+    const unsigned char* p = (const unsigned char*)m.data;
+    model.insert(model.end(), p, p + size * sizeof(float));
+}
+
+// stops after limit bytes like a truncated model file
+class DataReaderFromTruncatedMemory : public ncnn::DataReader
+{
+public:
+    DataReaderFromTruncatedMemory(const std::vector<unsigned char>& _model, size_t _limit)
+        : model(_model), offset(0), limit(_limit)
+    {
+    }
+
+    virtual size_t read(void* buf, size_t size) const
+    {
+        size_t n = std::min(size, limit - offset);
+        memcpy(buf, &model[offset], n);
+        offset += n;
+        return n;
+    }
+
+    const std::vector<unsigned char>& model;
+    mutable size_t offset;
+    size_t limit;
+};
+
+static int run_net(const std::vector<unsigned char>& model, size_t limit, bool parallel, int num_threads, const ncnn::Mat& in, ncnn::Mat& out)
+{
+    ncnn::Net net;
+    net.opt.use_vulkan_compute = false;
+    net.opt.use_parallel_create_pipeline = parallel;
+    net.opt.num_threads = num_threads;
+
+    if (net.load_param_mem(param) != 0)
+        return -1;
+
+    DataReaderFromTruncatedMemory dr(model, limit);
+    int ret = net.load_model(dr);
+    if (ret != 0)
+        return ret;
+
+    ncnn::Extractor ex = net.create_extractor();
+    ex.input("data", in);
+
+    ret = ex.extract("out", out);
+    if (ret != 0)
+        return ret;
+
+    out = out.clone();
+
+    return 0;
+}
+
+static int test_parallel_create_pipeline(int num_threads)
+{
+    std::vector<unsigned char> model;
+    append_weight(model, 1152, true);
+    append_weight(model, 16, false);
+    append_weight(model, 384, true);
+    append_weight(model, 24, false);
+    append_weight(model, 216, true);
+    append_weight(model, 24, false);
+    append_weight(model, 6912, true);
+    append_weight(model, 32, false);
+    append_weight(model, 1280, true);
+    append_weight(model, 40, false);
+    append_weight(model, 400, true);
+    append_weight(model, 10, false);
+
+    ncnn::Mat in = RandomMat(15, 13, 8);
+
+    ncnn::Mat ref;
+    int ret = run_net(model, model.size(), false, num_threads, in, ref);
+    if (ret != 0)
+    {
+        fprintf(stderr, "test_parallel_create_pipeline reference failed ret=%d\n", ret);
+        return -1;
+    }
+
+    // repeat to shake out scheduling races
+    for (int i = 0; i < 4; i++)
+    {
+        ncnn::Mat out;
+        ret = run_net(model, model.size(), true, num_threads, in, out);
+        if (ret != 0 || CompareMat(ref, out, 0.001f) != 0)
+        {
+            fprintf(stderr, "test_parallel_create_pipeline output mismatch ret=%d num_threads=%d\n", ret, num_threads);
+            return -1;
+        }
+    }
+
+    // a truncated model fails without waiting forever on the workers
+    ncnn::Mat out;
+    ret = run_net(model, model.size() / 2, true, num_threads, in, out);
+    if (ret == 0)
+    {
+        fprintf(stderr, "test_parallel_create_pipeline truncated model loaded num_threads=%d\n", num_threads);
+        return -1;
+    }
+
+    return 0;
+}
+
+int main()
+{
+    SRAND(7767517);
+
+    return 0
+           || test_parallel_create_pipeline(1)
+           || test_parallel_create_pipeline(2)
+           || test_parallel_create_pipeline(4);
+}
@@ -50,6 +50,16 @@ static int test_sdpa_0()
            || test_sdpa(RandomMat(28, 17, 15), RandomMat(28, 32, 5), RandomMat(11, 32, 5), 1, -0.4f);
 }
 
+static int test_sdpa_2()
+{
+    // decode with a few query rows
+    return 0
+           || test_sdpa(RandomMat(64, 1, 8), RandomMat(64, 300, 8), RandomMat(64, 300, 8), 0)
+           || test_sdpa(RandomMat(64, 1, 12), RandomMat(64, 257, 2), RandomMat(48, 257, 2), 1)
+           || test_sdpa(RandomMat(28, 2, 15), RandomMat(28, 65, 5), RandomMat(11, 65, 5), 1, 0.1f)
+           || test_sdpa(RandomMat(13, 3, 4), RandomMat(13, 7, 1), RandomMat(21, 7, 1), 0, -0.4f);
+}
+
 #if NCNN_INT8
 static int test_sdpa_int8(const ncnn::Mat& q, const ncnn::Mat& k, const ncnn::Mat& v, int attn_mask, float scale = 0.f)
 {
@@ -105,8 +115,8 @@ int main()
     SRAND(7767517);
 
 #if NCNN_INT8
-    return test_sdpa_0() || test_sdpa_1();
+    return test_sdpa_0() || test_sdpa_1() || test_sdpa_2();
 #else
-    return test_sdpa_0();
+    return test_sdpa_0() || test_sdpa_2();
 #endif
 }
@@ -56,6 +56,103 @@ static int test_sdpa_0()
            || test_sdpa_kvcache(RandomMat(28, 17, 15), RandomMat(28, 32, 5), RandomMat(11, 32, 5), 1, 5);
 }
 
+static int run_sdpa_kvcache_session(ncnn::Layer* op, const ncnn::Option& opt, const std::vector<ncnn::Mat>& qs, const std::vector<ncnn::Mat>& ks, const std::vector<ncnn::Mat>& vs, std::vector<ncnn::Mat>& outputs)
+{
+    ncnn::Mat key_cache;
+    ncnn::Mat value_cache;
+    outputs.resize(qs.size());
+    for (size_t i = 0; i < qs.size(); i++)
+    {
+        std::vector<ncnn::Mat> bottom_blobs(5);
+        bottom_blobs[0] = qs[i];
+        bottom_blobs[1] = ks[i];
+        bottom_blobs[2] = vs[i];
+        bottom_blobs[3] = key_cache;
+        bottom_blobs[4] = value_cache;
+
+        std::vector<ncnn::Mat> top_blobs(3);
+        int ret = op->forward(bottom_blobs, top_blobs, opt);
+        if (ret != 0)
+            return ret;
+
+        outputs[i] = top_blobs[0];
+        key_cache = top_blobs[1];
+        value_cache = top_blobs[2];
+    }
+
+    return 0;
+}
+
+static int test_sdpa_kvcache_session(int embed_dim, int out_embed_dim, int num_heads, int num_group, int prefill_seqlen, int decode_steps, bool int8_kvcache, int num_threads)
+{
+    std::vector<ncnn::Mat> qs(decode_steps + 1);
+    std::vector<ncnn::Mat> ks(decode_steps + 1);
+    std::vector<ncnn::Mat> vs(decode_steps + 1);
+    for (int i = 0; i <= decode_steps; i++)
+    {
+        const int seqlen = i == 0 ? prefill_seqlen : 1;
+        qs[i] = RandomMat(embed_dim, seqlen, num_heads);
+        ks[i] = RandomMat(embed_dim, seqlen, num_group);
+        vs[i] = RandomMat(out_embed_dim, seqlen, num_group);
+    }
+
+    ncnn::ParamDict pd;
+    pd.set(7, 1); // kv_cache
+
+    ncnn::Option opt;
+    opt.num_threads = num_threads;
+    opt.use_packing_layout = false;
+    opt.use_bf16_storage = false;
+
+    ncnn::Option opt_int8 = opt;
+    opt_int8.use_int8_kvcache = int8_kvcache;
+
+    ncnn::Layer* op_ref = ncnn::create_layer_naive("SDPA");
+    ncnn::Layer* op = ncnn::create_layer_cpu("SDPA");
+    op_ref->load_param(pd);
+    op->load_param(pd);
+    op_ref->load_model(ncnn::ModelBinFromMatArray(0));
+    op->load_model(ncnn::ModelBinFromMatArray(0));
+    op_ref->create_pipeline(opt);
+    op->create_pipeline(opt_int8);
+
+    std::vector<ncnn::Mat> outputs_ref;
+    std::vector<ncnn::Mat> outputs;
+    int ret = run_sdpa_kvcache_session(op_ref, opt, qs, ks, vs, outputs_ref);
+    if (ret == 0)
+        ret = run_sdpa_kvcache_session(op, opt_int8, qs, ks, vs, outputs);
+
+    for (size_t i = 0; ret == 0 && i < outputs.size(); i++)
+    {
+        if (CompareMat(outputs_ref[i], outputs[i], int8_kvcache ? 0.01f : 0.001f) != 0)
+            ret = -1;
+    }
+
+    op_ref->destroy_pipeline(opt);
+    op->destroy_pipeline(opt_int8);
+    delete op_ref;
+    delete op;
+
+    if (ret != 0)
+    {
+        fprintf(stderr, "test_sdpa_kvcache_session failed embed_dim=%d out_embed_dim=%d num_heads=%d num_group=%d prefill_seqlen=%d decode_steps=%d int8_kvcache=%d num_threads=%d\n", embed_dim, out_embed_dim, num_heads, num_group, prefill_seqlen, decode_steps, int8_kvcache, num_threads);
+    }
+
+    return ret;
+}
+
+static int test_sdpa_2()
+{
+    return 0
+           || test_sdpa_kvcache_session(32, 20, 8, 8, 11, 3, false, 1)
+           || test_sdpa_kvcache_session(64, 64, 12, 2, 300, 4, false, 4)
+           || test_sdpa_kvcache_session(28, 11, 15, 5, 517, 2, false, 3)
+           || test_sdpa_kvcache_session(32, 20, 8, 8, 11, 3, true, 1)
+           || test_sdpa_kvcache_session(64, 64, 12, 2, 33, 4, true, 1)
+           || test_sdpa_kvcache_session(26, 55, 4, 4, 1, 5, true, 1)
+           || test_sdpa_kvcache_session(28, 11, 15, 5, 417, 2, true, 4);
+}
+
 #if NCNN_INT8
 static int test_sdpa_int8_kvcache(const ncnn::Mat& q, const ncnn::Mat& k, const ncnn::Mat& v, int attn_mask, int past_seqlen)
 {
@@ -117,8 +214,8 @@ int main()
     SRAND(7767517);
 
 #if NCNN_INT8
-    return test_sdpa_0() || test_sdpa_1();
+    return test_sdpa_0() || test_sdpa_1() || test_sdpa_2();
 #else
-    return test_sdpa_0();
+    return test_sdpa_0() || test_sdpa_2();
 #endif
 }
@@ -9,7 +9,9 @@
 #include "gpu.h"
 #endif // NCNN_VULKAN
 
+#include <math.h>
 #include <stdio.h>
+#include <string.h>
 
 static const char sdpa_param[] = "7767517\n"
                                  "5 8\n"
@@ -170,44 +172,366 @@ static int test_kvcache_allocator_alias()
     return 0;
 }
 
-#if NCNN_BATCH
-static int test_kvcache_batch_rejected()
+static int test_paged_kvcache()
 {
+    std::vector<ncnn::Mat> reference_outputs;
+    int ret = run_extractor_kvcache(0, 1, reference_outputs);
+
     ncnn::Net net;
     net.opt.lightmode = false;
     net.opt.use_vulkan_compute = false;
 
-    if (net.load_param_mem(sdpa_param) != 0)
-        return -1;
-    net.load_model((const unsigned char*)empty_model);
+    if (ret == 0 && net.load_param_mem(sdpa_param) != 0)
+        ret = -1;
+    if (ret == 0)
+        net.load_model((const unsigned char*)empty_model);
+
+    {
+        // small blocks so that the block table has to grow too
+        ncnn::PagedKVCacheAllocator kvcache_allocator(4);
+
+        ncnn::Mat key_cache;
+        ncnn::Mat value_cache;
+        const int append_lengths[] = {15, 2, 1};
+        for (int i = 0; ret == 0 && i < 3; i++)
+        {
+            ncnn::Mat query(8, append_lengths[i], 4);
+            ncnn::Mat key(8, append_lengths[i], 2);
+            ncnn::Mat value(6, append_lengths[i], 2);
+            fill_sdpa_input(query, 0.1f + i * 0.17f);
+            fill_sdpa_input(key, -0.2f + i * 0.13f);
+            fill_sdpa_input(value, 0.3f - i * 0.11f);
+
+            ncnn::Extractor ex = net.create_extractor();
+            ex.set_paged_kvcache_allocator(&kvcache_allocator);
+            ex.input("q", query);
+            ex.input("k", key);
+            ex.input("v", value);
+            if (!key_cache.empty())
+            {
+                ex.input("past_k", key_cache);
+                ex.input("past_v", value_cache);
+                key_cache.release();
+                value_cache.release();
+            }
+
+            ncnn::Mat output;
+            ret = ex.extract("out", output);
+            if (ret == 0)
+                ret = ex.extract("out_k", key_cache, 1);
+            if (ret == 0)
+                ret = ex.extract("out_v", value_cache, 1);
+
+            if (ret == 0 && CompareMat(reference_outputs[i], output, 0.001f) != 0)
+                ret = -1;
+            if (ret == 0 && (!kvcache_allocator.is_table(key_cache.data) || !kvcache_allocator.is_table(value_cache.data)))
+                ret = -1;
+        }
 
-    ncnn::Mat query;
-    ncnn::Mat key;
-    ncnn::Mat value;
-    query.create(8, 1, 4, 4u, 1, 2);
-    key.create(8, 1, 2, 4u, 1, 2);
-    value.create(6, 1, 2, 4u, 1, 2);
-    query.fill(0.1f);
-    key.fill(0.2f);
-    value.fill(0.3f);
+        key_cache.release();
+        value_cache.release();
+    }
+
+    if (ret != 0)
+        fprintf(stderr, "test_paged_kvcache failed ret=%d\n", ret);
+
+    return ret;
+}
+
+static int run_fork_step(ncnn::Net& net, ncnn::Allocator* kvcache_allocator, bool paged, int cur_seqlen, float base, ncnn::Mat& output, ncnn::Mat& key_cache, ncnn::Mat& value_cache)
+{
+    ncnn::Mat query(8, cur_seqlen, 4);
+    ncnn::Mat key(8, cur_seqlen, 2);
+    ncnn::Mat value(6, cur_seqlen, 2);
+    fill_sdpa_input(query, 0.1f + base * 0.17f);
+    fill_sdpa_input(key, -0.2f + base * 0.13f);
+    fill_sdpa_input(value, 0.3f - base * 0.11f);
 
-    ncnn::UnlockedPoolAllocator kvcache_allocator;
     ncnn::Extractor ex = net.create_extractor();
-    ex.set_kvcache_allocator(&kvcache_allocator);
-    ex.set_kvcache_max_seqlen_hint(16);
+    if (paged)
+    {
+        ex.set_paged_kvcache_allocator((ncnn::PagedKVCacheAllocator*)kvcache_allocator);
+    }
+    else
+    {
+        ex.set_kvcache_allocator(kvcache_allocator);
+        ex.set_kvcache_max_seqlen_hint(32);
+    }
+
     ex.input("q", query);
     ex.input("k", key);
     ex.input("v", value);
+    if (!key_cache.empty())
+    {
+        ex.input("past_k", key_cache);
+        ex.input("past_v", value_cache);
+    }
 
-    ncnn::Mat output;
     int ret = ex.extract("out", output);
-    if (ret != -1)
+    if (ret == 0)
+        ret = ex.extract("out_k", key_cache, 1);
+    if (ret == 0)
+        ret = ex.extract("out_v", value_cache, 1);
+
+    return ret;
+}
+
+static int fork_kvcache(ncnn::Net& net, ncnn::Allocator* kvcache_allocator, bool paged, const ncnn::Mat& cache, ncnn::Mat& forked)
+{
+    ncnn::Extractor ex = net.create_extractor();
+    if (paged)
+        ex.set_paged_kvcache_allocator((ncnn::PagedKVCacheAllocator*)kvcache_allocator);
+    else
+        ex.set_kvcache_allocator(kvcache_allocator);
+
+    return ex.fork_kvcache(cache, forked);
+}
+
+static int test_kvcache_fork(bool paged)
+{
+    std::vector<ncnn::Mat> reference_outputs;
+    int ret = run_extractor_kvcache(0, 1, reference_outputs);
+
+    ncnn::Net net;
+    net.opt.lightmode = false;
+    net.opt.use_vulkan_compute = false;
+
+    if (ret == 0 && net.load_param_mem(sdpa_param) != 0)
+        ret = -1;
+    if (ret == 0)
+        net.load_model((const unsigned char*)empty_model);
+
     {
-        fprintf(stderr, "test_kvcache_batch_rejected failed ret=%d\n", ret);
+        ncnn::PagedKVCacheAllocator paged_allocator(4);
+        ncnn::UnlockedPoolAllocator pool_allocator;
+        ncnn::Allocator* kvcache_allocator = paged ? (ncnn::Allocator*)&paged_allocator : (ncnn::Allocator*)&pool_allocator;
+
+        // shared prefix of 15 tokens, the last block is partially filled
+        ncnn::Mat output;
+        ncnn::Mat key_cache;
+        ncnn::Mat value_cache;
+        if (ret == 0)
+            ret = run_fork_step(net, kvcache_allocator, paged, 15, 0.f, output, key_cache, value_cache);
+
+        ncnn::Mat key_cache_a;
+        ncnn::Mat value_cache_a;
+        ncnn::Mat key_cache_b;
+        ncnn::Mat value_cache_b;
+        if (ret == 0)
+            ret = fork_kvcache(net, kvcache_allocator, paged, key_cache, key_cache_a);
+        if (ret == 0)
+            ret = fork_kvcache(net, kvcache_allocator, paged, value_cache, value_cache_a);
+        if (ret == 0)
+            ret = fork_kvcache(net, kvcache_allocator, paged, key_cache, key_cache_b);
+        if (ret == 0)
+            ret = fork_kvcache(net, kvcache_allocator, paged, value_cache, value_cache_b);
+
+        // branch b appends different tokens between the two steps of branch a
+        ncnn::Mat output_a1;
+        ncnn::Mat output_b;
+        ncnn::Mat output_a2;
+        if (ret == 0)
+            ret = run_fork_step(net, kvcache_allocator, paged, 2, 1.f, output_a1, key_cache_a, value_cache_a);
+        if (ret == 0)
+            ret = run_fork_step(net, kvcache_allocator, paged, 3, 5.f, output_b, key_cache_b, value_cache_b);
+        if (ret == 0)
+            ret = run_fork_step(net, kvcache_allocator, paged, 1, 2.f, output_a2, key_cache_a, value_cache_a);
+
+        if (ret == 0 && (CompareMat(reference_outputs[1], output_a1, 0.001f) != 0 || CompareMat(reference_outputs[2], output_a2, 0.001f) != 0))
+            ret = -1;
+        if (ret == 0 && (key_cache.h != 15 || key_cache_a.h != 18 || key_cache_b.h != 18))
+            ret = -1;
+
+        if (ret == 0 && paged)
+        {
+            // full prefix blocks are shared, the partial one is copied
+            const ncnn::PagedKVCacheTable* table = (const ncnn::PagedKVCacheTable*)key_cache.data;
+            const ncnn::PagedKVCacheTable* table_a = (const ncnn::PagedKVCacheTable*)key_cache_a.data;
+            const ncnn::PagedKVCacheTable* table_b = (const ncnn::PagedKVCacheTable*)key_cache_b.data;
+            for (int i = 0; i < 3; i++)
+            {
+                if (table_a->blocks[i] != table->blocks[i] || table_b->blocks[i] != table->blocks[i])
+                    ret = -1;
+            }
+            if (table_a->blocks[3] == table->blocks[3] || table_b->blocks[3] == table->blocks[3] || table_a->blocks[3] == table_b->blocks[3])
+                ret = -1;
+        }
+
+        key_cache.release();
+        value_cache.release();
+        key_cache_a.release();
+        value_cache_a.release();
+        key_cache_b.release();
+        value_cache_b.release();
+    }
+
+    if (ret != 0)
+        fprintf(stderr, "test_kvcache_fork paged=%d failed ret=%d\n", paged, ret);
+
+    return ret;
+}
+
+#if NCNN_BATCH
+static const char sdpa_mask_param[] = "7767517\n"
+                                      "6 9\n"
+                                      "Input q_input 0 1 q\n"
+                                      "Input k_input 0 1 k\n"
+                                      "Input v_input 0 1 v\n"
+                                      "Input mask_input 0 1 mask\n"
+                                      "Input cache_input 0 2 past_k past_v\n"
+                                      "SDPA sdpa 6 3 q k v mask past_k past_v out out_k out_v 5=1 7=1\n";
+
+// mask out the keys in [valid_seqlen, pad_end) for every query row
+static void make_padding_mask(ncnn::Mat& mask, int dst_seqlen, int cur_seqlen, int valid_seqlen, int pad_end)
+{
+    mask.create(dst_seqlen, cur_seqlen);
+    mask.fill(0.f);
+    for (int y = 0; y < cur_seqlen; y++)
+    {
+        float* ptr = mask.row(y);
+        for (int x = valid_seqlen; x < pad_end; x++)
+            ptr[x] = -INFINITY;
+    }
+}
+
+static ncnn::Mat stack_batch(const ncnn::Mat& a, const ncnn::Mat& b)
+{
+    ncnn::Mat m;
+    if (a.dims == 2)
+        m.create(a.w, a.h, (size_t)4u, 1, 2);
+    else
+        m.create(a.w, a.h, a.c, (size_t)4u, 1, 2);
+    memcpy(m.batch(0), a, a.total() * a.elemsize);
+    memcpy(m.batch(1), b, b.total() * b.elemsize);
+    return m;
+}
+
+static int run_sdpa_mask_step(ncnn::Net& net, const ncnn::Mat& query, const ncnn::Mat& key, const ncnn::Mat& value, const ncnn::Mat& mask, ncnn::Mat& output, ncnn::Mat& key_cache, ncnn::Mat& value_cache, ncnn::Allocator* kvcache_allocator)
+{
+    ncnn::Extractor ex = net.create_extractor();
+    ex.set_kvcache_allocator(kvcache_allocator);
+    ex.set_kvcache_max_seqlen_hint(32);
+
+    ex.input("q", query);
+    ex.input("k", key);
+    ex.input("v", value);
+    ex.input("mask", mask);
+    if (!key_cache.empty())
+    {
+        ex.input("past_k", key_cache);
+        ex.input("past_v", value_cache);
+    }
+
+    int ret = ex.extract("out", output);
+    if (ret != 0)
+        return ret;
+    ret = ex.extract("out_k", key_cache, 1);
+    if (ret != 0)
+        return ret;
+
+    return ex.extract("out_v", value_cache, 1);
+}
+
+static int test_kvcache_batch()
+{
+    ncnn::Net net;
+    net.opt.lightmode = false;
+    net.opt.use_vulkan_compute = false;
+
+    if (net.load_param_mem(sdpa_mask_param) != 0)
         return -1;
+    net.load_model((const unsigned char*)empty_model);
+
+    ncnn::UnlockedPoolAllocator kvcache_allocator;
+
+    // two sessions with different prompt lengths, the shorter one is padded in the batch
+    const int prompt_lengths[2] = {15, 11};
+    const int append_lengths[] = {15, 2, 1};
+
+    std::vector<ncnn::Mat> reference_outputs[2];
+    int ret = 0;
+    for (int s = 0; ret == 0 && s < 2; s++)
+    {
+        ncnn::Mat key_cache;
+        ncnn::Mat value_cache;
+        int past_seqlen = 0;
+        reference_outputs[s].resize(3);
+        for (int i = 0; ret == 0 && i < 3; i++)
+        {
+            const int cur_seqlen = i == 0 ? prompt_lengths[s] : append_lengths[i];
+            ncnn::Mat query(8, cur_seqlen, 4);
+            ncnn::Mat key(8, cur_seqlen, 2);
+            ncnn::Mat value(6, cur_seqlen, 2);
+            fill_sdpa_input(query, 0.1f + i * 0.17f + s * 0.05f);
+            fill_sdpa_input(key, -0.2f + i * 0.13f - s * 0.07f);
+            fill_sdpa_input(value, 0.3f - i * 0.11f + s * 0.09f);
+
+            ncnn::Mat mask;
+            make_padding_mask(mask, past_seqlen + cur_seqlen, cur_seqlen, 0, 0);
+
+            ret = run_sdpa_mask_step(net, query, key, value, mask, reference_outputs[s][i], key_cache, value_cache, &kvcache_allocator);
+            past_seqlen += cur_seqlen;
+        }
     }
 
-    return 0;
+    ncnn::Mat key_cache;
+    ncnn::Mat value_cache;
+    int past_seqlen = 0;
+    for (int i = 0; ret == 0 && i < 3; i++)
+    {
+        const int cur_seqlen = append_lengths[i];
+
+        ncnn::Mat queries[2];
+        ncnn::Mat keys[2];
+        ncnn::Mat values[2];
+        ncnn::Mat masks[2];
+        for (int s = 0; s < 2; s++)
+        {
+            queries[s].create(8, cur_seqlen, 4);
+            keys[s].create(8, cur_seqlen, 2);
+            values[s].create(6, cur_seqlen, 2);
+            fill_sdpa_input(queries[s], 0.1f + i * 0.17f + s * 0.05f);
+            fill_sdpa_input(keys[s], -0.2f + i * 0.13f - s * 0.07f);
+            fill_sdpa_input(values[s], 0.3f - i * 0.11f + s * 0.09f);
+
+            // keys past the prompt of the shorter session are padding
+            make_padding_mask(masks[s], past_seqlen + cur_seqlen, cur_seqlen, prompt_lengths[s], append_lengths[0]);
+        }
+
+        ncnn::Mat output;
+        ret = run_sdpa_mask_step(net, stack_batch(queries[0], queries[1]), stack_batch(keys[0], keys[1]), stack_batch(values[0], values[1]), stack_batch(masks[0], masks[1]), output, key_cache, value_cache, &kvcache_allocator);
+        past_seqlen += cur_seqlen;
+
+        if (ret == 0 && (output.n != 2 || key_cache.n != 2 || value_cache.n != 2))
+            ret = -1;
+        if (ret == 0 && (key_cache.allocator != &kvcache_allocator || value_cache.allocator != &kvcache_allocator))
+            ret = -1;
+        if (ret == 0 && (key_cache.h != past_seqlen || key_cache.cstep < (size_t)key_cache.w * 32))
+            ret = -1;
+
+        for (int s = 0; ret == 0 && s < 2; s++)
+        {
+            const ncnn::Mat& reference = reference_outputs[s][i];
+
+            // compare the rows of real tokens only
+            ncnn::Mat out_s(reference.w, reference.h, reference.c);
+            for (int q = 0; q < reference.c; q++)
+            {
+                memcpy(out_s.channel(q), output.batch(s).channel(q), reference.w * reference.h * sizeof(float));
+            }
+
+            if (CompareMat(reference, out_s, 0.001f) != 0)
+                ret = -1;
+        }
+    }
+
+    key_cache.release();
+    value_cache.release();
+
+    if (ret != 0)
+        fprintf(stderr, "test_kvcache_batch failed ret=%d\n", ret);
+
+    return ret;
 }
 #endif // NCNN_BATCH
 
@@ -387,8 +711,11 @@ int main()
     return 0
            || test_extractor_kvcache()
            || test_kvcache_allocator_alias()
+           || test_paged_kvcache()
+           || test_kvcache_fork(false)
+           || test_kvcache_fork(true)
 #if NCNN_BATCH
-           || test_kvcache_batch_rejected()
+           || test_kvcache_batch()
 #endif
 #if NCNN_VULKAN
            || test_legacy_vulkan_extractor_kvcache()
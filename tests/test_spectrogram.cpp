@@ -36,7 +36,10 @@ static int test_spectrogram_0()
            || test_spectrogram(39, 17, 0, 7, 15, 0, 0, 0, 1, 0)
            || test_spectrogram(128, 10, 0, 2, 7, 1, 1, 1, 1, 1)
            || test_spectrogram(255, 17, 1, 14, 17, 2, 0, 0, 0, 1)
-           || test_spectrogram(124, 55, 2, 12, 55, 1, 1, 2, 2, 0);
+           || test_spectrogram(124, 55, 2, 12, 55, 1, 1, 2, 2, 0)
+           || test_spectrogram(4000, 400, 2, 160, 400, 1, 1, 2, 0, 1)
+           || test_spectrogram(3001, 512, 0, 128, 400, 2, 0, 0, 1, 1)
+           || test_spectrogram(1111, 96, 1, 33, 96, 1, 1, 1, 2, 0);
 }
 
 int main()
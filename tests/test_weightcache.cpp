@@ -0,0 +1,213 @@
+// Copyright 2026 Tencent
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "net.h"
+#include "testutil.h"
+#include "weightcache.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// winograd convolution, innerproduct and constant B gemm
+static const char param[] = "7767517\n"
+                            "5 5\n"
+                            "Input data 0 1 data -23330=4,3,8,8,16\n"
+                            "Convolution conv0 1 1 data c0 0=16 1=3 4=1 5=1 6=2304 9=1\n"
+                            "InnerProduct fc0 1 1 c0 fc0 0=32 1=1 2=32768\n"
+                            "Input data2 0 1 data2\n"
+                            "Gemm gemm0 1 1 data2 gemm0 5=1 6=1 8=24 9=40 10=4\n";
+
+static void append_weight(std::vector<unsigned char>& model, int size, bool flag)
+{
+    if (flag)
+    {
+        // raw float32 tag
+        const unsigned int tag = 0;
+        const unsigned char* p = (const unsigned char*)&tag;
+        model.insert(model.end(), p, p + sizeof(tag));
+    }
+
+    ncnn::Mat m = RandomMat(size);
+    const unsigned char* p = (const unsigned char*)m.data;
+    model.insert(model.end(), p, p + size * sizeof(float));
+}
+
+static void make_model(std::vector<unsigned char>& model)
+{
+    model.clear();
+    append_weight(model, 2304, true);
+    append_weight(model, 16, false);
+    append_weight(model, 32768, true);
+    append_weight(model, 32, false);
+    append_weight(model, 24 * 40, true);
+    append_weight(model, 24, true);
+}
+
+static int run_net(const std::vector<unsigned char>& model, ncnn::WeightCache* cache, int num_threads, const ncnn::Mat& in, const ncnn::Mat& in2, ncnn::Mat& out, ncnn::Mat& out2)
+{
+    ncnn::Net net;
+    net.opt.use_vulkan_compute = false;
+    net.opt.use_bf16_storage = false;
+    net.opt.use_fp16_storage = false;
+    net.opt.num_threads = num_threads;
+    net.opt.weight_cache = cache;
+
+    if (net.load_param_mem(param) != 0)
+        return -1;
+
+    if (net.load_model(&model[0]) != model.size())
+        return -1;
+
+    ncnn::Extractor ex = net.create_extractor();
+    ex.input("data", in);
+    ex.input("data2", in2);
+
+    int ret = ex.extract("fc0", out);
+    ret |= ex.extract("gemm0", out2);
+    if (ret != 0)
+        return ret;
+
+    out = out.clone();
+    out2 = out2.clone();
+
+    return 0;
+}
+
+static int test_weightcache(int num_threads)
+{
+    std::vector<unsigned char> model;
+    make_model(model);
+
+    const ncnn::Mat in = RandomMat(8, 8, 16);
+    const ncnn::Mat in2 = RandomMat(40, 20);
+
+    ncnn::Mat ref;
+    ncnn::Mat ref2;
+    int ret = run_net(model, 0, num_threads, in, in2, ref, ref2);
+    if (ret != 0)
+    {
+        fprintf(stderr, "test_weightcache reference failed ret=%d\n", ret);
+        return -1;
+    }
+
+    // prepare and record
+    ncnn::WeightCache cache;
+    ncnn::Mat out;
+    ncnn::Mat out2;
+    ret = run_net(model, &cache, num_threads, in, in2, out, out2);
+    if (ret != 0 || CompareMat(ref, out, 0.001f) != 0 || CompareMat(ref2, out2, 0.001f) != 0)
+    {
+        fprintf(stderr, "test_weightcache record output mismatch ret=%d num_threads=%d\n", ret, num_threads);
+        return -1;
+    }
+
+    if (cache.size() != 3 || !cache.modified())
+    {
+        fprintf(stderr, "test_weightcache expect 3 entries but got %d\n", (int)cache.size());
+        return -1;
+    }
+
+    std::vector<unsigned char> data;
+    if (cache.save_cache(data) != 0 || cache.modified())
+    {
+        fprintf(stderr, "test_weightcache save_cache failed\n");
+        return -1;
+    }
+
+    // reuse the prepared weights from an aligned copy
+    std::vector<unsigned char> storage(data.size() + 64);
+    unsigned char* aligned_data = (unsigned char*)(((size_t)&storage[0] + 63) & ~(size_t)63);
+    memcpy(aligned_data, &data[0], data.size());
+
+    ncnn::WeightCache cache2;
+    ret = cache2.load_cache(aligned_data, data.size());
+    if (ret != 0 || cache2.size() != 3)
+    {
+        fprintf(stderr, "test_weightcache load_cache failed ret=%d\n", ret);
+        return -1;
+    }
+
+    ret = run_net(model, &cache2, num_threads, in, in2, out, out2);
+    if (ret != 0 || CompareMat(ref, out, 0.001f) != 0 || CompareMat(ref2, out2, 0.001f) != 0 || cache2.modified())
+    {
+        fprintf(stderr, "test_weightcache cached output mismatch ret=%d num_threads=%d\n", ret, num_threads);
+        return -1;
+    }
+
+    // changed weights are prepared again and recorded beside the old ones
+    std::vector<unsigned char> model2;
+    make_model(model2);
+
+    ret = run_net(model2, 0, num_threads, in, in2, ref, ref2);
+    ret |= run_net(model2, &cache2, num_threads, in, in2, out, out2);
+    if (ret != 0 || CompareMat(ref, out, 0.001f) != 0 || CompareMat(ref2, out2, 0.001f) != 0 || !cache2.modified() || cache2.size() != 6)
+    {
+        fprintf(stderr, "test_weightcache stale weights used ret=%d num_threads=%d\n", ret, num_threads);
+        return -1;
+    }
+
+    return 0;
+}
+
+static int test_weightcache_file()
+{
+    std::vector<unsigned char> model;
+    make_model(model);
+
+    const ncnn::Mat in = RandomMat(8, 8, 16);
+    const ncnn::Mat in2 = RandomMat(40, 20);
+
+    const char* path = "test_weightcache.bin";
+
+    ncnn::Mat ref;
+    ncnn::Mat ref2;
+    ncnn::WeightCache cache;
+    int ret = run_net(model, &cache, 1, in, in2, ref, ref2);
+    if (ret != 0 || cache.save_cache(path) != 0)
+    {
+        fprintf(stderr, "test_weightcache_file save failed ret=%d\n", ret);
+        return -1;
+    }
+
+    // mapped file
+    ncnn::Mat out;
+    ncnn::Mat out2;
+    {
+        ncnn::WeightCache cache2;
+        ret = cache2.load_cache(path);
+        ret |= run_net(model, &cache2, 1, in, in2, out, out2);
+    }
+
+    remove(path);
+
+    if (ret != 0 || CompareMat(ref, out, 0.001f) != 0 || CompareMat(ref2, out2, 0.001f) != 0)
+    {
+        fprintf(stderr, "test_weightcache_file output mismatch ret=%d\n", ret);
+        return -1;
+    }
+
+    // garbage is rejected
+    std::vector<unsigned char> garbage(1024, 0x5a);
+    std::vector<unsigned char> storage(garbage.size() + 64);
+    unsigned char* aligned_data = (unsigned char*)(((size_t)&storage[0] + 63) & ~(size_t)63);
+    memcpy(aligned_data, &garbage[0], garbage.size());
+
+    ncnn::WeightCache cache3;
+    if (cache3.load_cache(aligned_data, garbage.size()) == 0 || cache3.size() != 0)
+    {
+        fprintf(stderr, "test_weightcache_file garbage accepted\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+int main()
+{
+    SRAND(7767517);
+
+    return 0
+           || test_weightcache(1)
+           || test_weightcache(4)
+           || test_weightcache_file();
+}